@@ -64,6 +64,32 @@ ifeq ($(TOOLCHAIN),ARM)
   DEFINES+=MCUBOOT_SKIP_CLEANUP_RAM=1
 endif
 
+# Experimental: place the DeepSleep wake path functions of the CM33
+# non-secure and CM55 applications in SRAM and ITCM instead of executing them
+# from external flash (1), see shared/include/wake_path.h. Also places the
+# interrupt handlers of the POWER_MANAGER partition in SRAM, see
+# proj_cm33_s/Makefile. The PDL, FreeRTOS and the SPM dispatch stay in the
+# external flash, so the wake-up is not faster yet.
+APP_RAM_WAKE_PATH?=0
+DEFINES+=APP_RAM_WAKE_PATH=$(APP_RAM_WAKE_PATH)
+
+# Let CM55 read the wake-up sources of the POWER_MANAGER partition through
+# its TF-M NS interface (1), see proj_cm55/cm55_wake.h
+APP_CM55_POWER_MANAGER?=0
+DEFINES+=APP_CM55_POWER_MANAGER=$(APP_CM55_POWER_MANAGER)
+
+# Client ID range that the NS mailbox agent of the TF-M configuration gives
+# the CM55 calls. There is no default: with APP_CM55_POWER_MANAGER=1, set both
+# to the range of your TF-M configuration, or the TF-M build fails.
+APP_CM55_CLIENT_ID_MIN?=
+APP_CM55_CLIENT_ID_MAX?=
+
+# Record the DeepSleep entries, wake-ups and application state changes and
+# log them as a timeline for the host simulation (1), see
+# proj_cm33_ns/wake_recorder.h
+APP_WAKE_RECORDER?=0
+DEFINES+=APP_WAKE_RECORDER=$(APP_WAKE_RECORDER)
+
 #Config file for postbuild sign and merge operations.
 #NOTE:Check the JSON file for the command parameters
 COMBINE_SIGN_JSON?=
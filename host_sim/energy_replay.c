@@ -0,0 +1,306 @@
+/*****************************************************************************
+* File Name        : energy_replay.c
+*
+* Description      : Host energy simulator. Replays a recorded power state
+*                    timeline through the energy model of the CM33
+*                    non-secure application and reports the energy per
+*                    application state cycle and the battery life.
+*
+* Related Document : See docs/host_simulation.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "energy_model.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+#define LINE_BUFFER_SIZE        (128)
+
+/* Default battery capacity used for the battery life figure */
+#define DEFAULT_CAPACITY_MAH    (1000U)
+
+/*******************************************************************************
+* Function Name: lookup
+********************************************************************************
+* Summary:
+*  Finds a name in a table of names returned by a name function.
+*
+* Parameters:
+*  name      - name to look up
+*  count     - number of entries
+*  name_of   - returns the name of an entry
+*
+* Return:
+*  int - entry index, or -1 if not found
+*
+*******************************************************************************/
+static int lookup(const char *name, uint32_t count, const char *(*name_of)(uint32_t))
+{
+    uint32_t i;
+
+    for (i = 0U; i < count; i++)
+    {
+        if (0 == strcmp(name, name_of(i)))
+        {
+            return (int)i;
+        }
+    }
+
+    return -1;
+}
+
+static const char *state_name(uint32_t i)
+{
+    return energy_model_state_name((energy_state_t)i);
+}
+
+static const char *load_name(uint32_t i)
+{
+    return energy_model_load_name((energy_load_t)i);
+}
+
+static const char *transition_name(uint32_t i)
+{
+    return energy_model_transition_name((energy_transition_t)i);
+}
+
+/*******************************************************************************
+* Function Name: print_estimate
+********************************************************************************
+* Summary:
+*  Prints one line per cycle, or the detailed breakdown of the total.
+*
+* Parameters:
+*  label    - line label
+*  estimate - energy estimate
+*  detailed - print the breakdown
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void print_estimate(const char *label, const energy_estimate_t *estimate,
+                           int detailed)
+{
+    uint32_t i;
+
+    printf("%-8s %10llu ms %12llu uJ %8u uA\n", label,
+           (unsigned long long)(estimate->duration_us / 1000U),
+           (unsigned long long)(estimate->total_nj / 1000U),
+           estimate->average_ua);
+
+    if (!detailed)
+    {
+        return;
+    }
+
+    for (i = 0U; i < (uint32_t)ENERGY_STATE_COUNT; i++)
+    {
+        printf("  state      %-10s %12llu uJ\n", state_name(i),
+               (unsigned long long)(estimate->state_nj[i] / 1000U));
+    }
+    for (i = 0U; i < (uint32_t)ENERGY_LOAD_COUNT; i++)
+    {
+        printf("  load       %-10s %12llu uJ\n", load_name(i),
+               (unsigned long long)(estimate->load_nj[i] / 1000U));
+    }
+    for (i = 0U; i < (uint32_t)ENERGY_TRANSITION_COUNT; i++)
+    {
+        printf("  transition %-10s %12llu uJ\n", transition_name(i),
+               (unsigned long long)(estimate->transition_nj[i] / 1000U));
+    }
+}
+
+/*******************************************************************************
+* Function Name: add_account
+********************************************************************************
+* Summary:
+*  Adds the counters of one account to another.
+*
+* Parameters:
+*  total   - accumulated account
+*  account - account to add
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void add_account(energy_account_t *total, const energy_account_t *account)
+{
+    uint32_t i;
+
+    for (i = 0U; i < (uint32_t)ENERGY_STATE_COUNT; i++)
+    {
+        total->state_us[i] += account->state_us[i];
+    }
+    for (i = 0U; i < (uint32_t)ENERGY_LOAD_COUNT; i++)
+    {
+        total->load_us[i] += account->load_us[i];
+    }
+    for (i = 0U; i < (uint32_t)ENERGY_TRANSITION_COUNT; i++)
+    {
+        total->transitions[i] += account->transitions[i];
+    }
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Replays a timeline. Options:
+*   -c <mAh>  battery capacity for the battery life figure
+*   -b <uA>   average current budget; the exit status is 1 when the average
+*             current of the timeline exceeds it
+*
+* Parameters:
+*  argc, argv - command line
+*
+* Return:
+*  int - 0 on success, 1 if the budget is exceeded, 2 on errors
+*
+*******************************************************************************/
+int main(int argc, char *argv[])
+{
+    energy_tracker_t tracker;
+    energy_account_t account;
+    energy_account_t total;
+    energy_estimate_t estimate;
+    uint32_t capacity_mah = DEFAULT_CAPACITY_MAH;
+    uint32_t budget_ua = 0U;
+    const char *path = NULL;
+    uint32_t cycle = 0U;
+    uint64_t time_ms;
+    char line[LINE_BUFFER_SIZE];
+    char cmd[16];
+    char arg1[16];
+    char arg2[16];
+    char label[16];
+    FILE *timeline;
+    int fields;
+    int index;
+    int done = 0;
+    int i;
+
+    for (i = 1; i < argc; i++)
+    {
+        if ((0 == strcmp(argv[i], "-c")) && ((i + 1) < argc))
+        {
+            capacity_mah = (uint32_t)strtoul(argv[++i], NULL, 0);
+        }
+        else if ((0 == strcmp(argv[i], "-b")) && ((i + 1) < argc))
+        {
+            budget_ua = (uint32_t)strtoul(argv[++i], NULL, 0);
+        }
+        else
+        {
+            path = argv[i];
+        }
+    }
+
+    if (NULL == path)
+    {
+        fprintf(stderr, "usage: %s [-c capacity_mah] [-b budget_ua] <timeline>\n",
+                argv[0]);
+        return 2;
+    }
+
+    timeline = fopen(path, "r");
+    if (NULL == timeline)
+    {
+        perror(path);
+        return 2;
+    }
+
+    memset(&total, 0, sizeof(total));
+    energy_tracker_init(&tracker, ENERGY_STATE_HP, 0U);
+    printf("%-8s %13s %15s %11s\n", "cycle", "duration", "energy", "average");
+
+    while (!done && (NULL != fgets(line, sizeof(line), timeline)))
+    {
+        fields = sscanf(line, "%llu %15s %15s %15s",
+                        (unsigned long long *)&time_ms, cmd, arg1, arg2);
+        if ((fields < 2) || ('#' == line[0]))
+        {
+            continue;
+        }
+
+        if ((0 == strcmp(cmd, "state")) && (fields >= 3) &&
+            ((index = lookup(arg1, ENERGY_STATE_COUNT, state_name)) >= 0))
+        {
+            energy_tracker_set_state(&tracker, (energy_state_t)index, time_ms * 1000U);
+        }
+        else if ((0 == strcmp(cmd, "load")) && (fields >= 4) &&
+                 ((index = lookup(arg1, ENERGY_LOAD_COUNT, load_name)) >= 0))
+        {
+            energy_tracker_set_load(&tracker, (energy_load_t)index,
+                                    0 == strcmp(arg2, "on"), time_ms * 1000U);
+        }
+        else if ((0 == strcmp(cmd, "transition")) && (fields >= 3) &&
+                 ((index = lookup(arg1, ENERGY_TRANSITION_COUNT, transition_name)) >= 0))
+        {
+            energy_tracker_update(&tracker, time_ms * 1000U);
+            energy_tracker_add_transition(&tracker, (energy_transition_t)index);
+        }
+        else if ((0 == strcmp(cmd, "cycle")) || (0 == strcmp(cmd, "end")))
+        {
+            energy_tracker_take(&tracker, time_ms * 1000U, &account);
+            add_account(&total, &account);
+            energy_model_estimate(&energy_model_default, &account, &estimate);
+            if (0U != estimate.duration_us)
+            {
+                snprintf(label, sizeof(label), "%u", cycle++);
+                print_estimate(label, &estimate, 0);
+            }
+            done = (0 == strcmp(cmd, "end"));
+        }
+        else
+        {
+            fprintf(stderr, "ignored: %s", line);
+        }
+    }
+
+    fclose(timeline);
+
+    energy_model_estimate(&energy_model_default, &total, &estimate);
+    printf("\n");
+    print_estimate("total", &estimate, 1);
+    printf("\nbattery life (%u mAh): %u h\n", capacity_mah,
+           energy_model_battery_life_hours(&estimate, capacity_mah));
+
+    if ((0U != budget_ua) && (estimate.average_ua > budget_ua))
+    {
+        printf("average current %u uA exceeds the budget of %u uA\n",
+               estimate.average_ua, budget_ua);
+        return 1;
+    }
+
+    return 0;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,198 @@
+/*****************************************************************************
+* File Name        : governor_sim.c
+*
+* Description      : Host simulation of the performance mode policy. Replays
+*                    a timeline of application state changes and client
+*                    demands through perf_policy.c and reports the resulting
+*                    mode transitions and mode residency.
+*
+* Related Document : See docs/host_simulation.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "perf_policy.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+#define LINE_BUFFER_SIZE (128)
+
+/*******************************************************************************
+* Function Name: parse_mode
+********************************************************************************
+* Summary:
+*  Converts a mode name into a performance mode.
+*
+* Parameters:
+*  name - mode name
+*  mode - parsed mode
+*
+* Return:
+*  int - 0 on success, -1 on an unknown name
+*
+*******************************************************************************/
+static int parse_mode(const char *name, perf_mode_t *mode)
+{
+    perf_mode_t m;
+
+    for (m = PERF_MODE_ULP; m < PERF_MODE_COUNT; m++)
+    {
+        if (0 == strcmp(name, perf_policy_mode_name(m)))
+        {
+            *mode = m;
+            return 0;
+        }
+    }
+
+    return -1;
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Replays the timeline given as first argument. An optional second argument
+*  overrides the downshift hold time in milliseconds.
+*
+* Parameters:
+*  argc, argv - command line
+*
+* Return:
+*  int - 0 on success
+*
+*******************************************************************************/
+int main(int argc, char *argv[])
+{
+    perf_policy_config_t config;
+    perf_policy_t policy;
+    uint64_t residency_ms[PERF_MODE_COUNT] = { 0U };
+    uint32_t transitions = 0U;
+    uint32_t now_ms = 0U;
+    uint32_t event_ms;
+    perf_mode_t mode;
+    char line[LINE_BUFFER_SIZE];
+    char cmd[16];
+    char arg1[16];
+    char arg2[16];
+    FILE *timeline;
+    int fields;
+    int done = 0;
+
+    if (argc < 2)
+    {
+        fprintf(stderr, "usage: %s <timeline> [downshift_hold_ms]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    timeline = fopen(argv[1], "r");
+    if (NULL == timeline)
+    {
+        perror(argv[1]);
+        return EXIT_FAILURE;
+    }
+
+    perf_policy_get_default_config(&config);
+    if (argc > 2)
+    {
+        config.downshift_hold_ms = (uint32_t)strtoul(argv[2], NULL, 0);
+    }
+    perf_policy_init(&policy, &config);
+
+    /* Clients are referred to by index in the timeline */
+    while (perf_policy_add_client(&policy) >= 0)
+    {
+    }
+
+    mode = policy.mode;
+    printf("%8s  %-5s -> %-5s\n", "time_ms", "from", "to");
+
+    while (!done && (NULL != fgets(line, sizeof(line), timeline)))
+    {
+        fields = sscanf(line, "%u %15s %15s %15s", &event_ms, cmd, arg1, arg2);
+        if ((fields < 2) || ('#' == line[0]))
+        {
+            continue;
+        }
+
+        /* Evaluate the policy every millisecond up to the event, as the
+         * downshift timer of the governor would */
+        for (; now_ms < event_ms; now_ms++)
+        {
+            perf_mode_t next = perf_policy_update(&policy, now_ms);
+
+            if (next != mode)
+            {
+                printf("%8u  %-5s -> %-5s\n", now_ms,
+                       perf_policy_mode_name(mode), perf_policy_mode_name(next));
+                mode = next;
+                transitions++;
+            }
+            residency_ms[mode]++;
+        }
+
+        if ((0 == strcmp(cmd, "state")) && (fields >= 3))
+        {
+            perf_policy_set_app_state(&policy, (0 == strcmp(arg1, "IDLE")) ?
+                                      APP_STATE_IDLE : APP_STATE_ACTIVE);
+        }
+        else if ((0 == strcmp(cmd, "demand")) && (fields >= 4))
+        {
+            perf_mode_t demand;
+
+            if (0 != parse_mode(arg2, &demand))
+            {
+                fprintf(stderr, "unknown mode: %s\n", arg2);
+                fclose(timeline);
+                return EXIT_FAILURE;
+            }
+            perf_policy_set_demand(&policy, (int32_t)strtol(arg1, NULL, 0), demand);
+        }
+        else if (0 == strcmp(cmd, "end"))
+        {
+            done = 1;
+        }
+        else
+        {
+            fprintf(stderr, "ignored: %s", line);
+        }
+    }
+
+    fclose(timeline);
+
+    printf("\ntransitions: %u\n", transitions);
+    for (mode = PERF_MODE_ULP; mode < PERF_MODE_COUNT; mode++)
+    {
+        printf("residency %-3s: %8llu ms (%5.1f %%)\n", perf_policy_mode_name(mode),
+               (unsigned long long)residency_ms[mode],
+               (0U != now_ms) ? (100.0 * (double)residency_ms[mode] / now_ms) : 0.0);
+    }
+
+    return EXIT_SUCCESS;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,126 @@
+/*****************************************************************************
+* File Name        : FreeRTOSConfig.h
+*
+* Description      : FreeRTOS configuration of the POSIX simulation of the CM33
+*                    non-secure application. It follows proj_cm33_ns/FreeRTOSConfig.h
+*                    for everything the application depends on (tick rate, priorities,
+*                    tickless idle) and the FreeRTOS POSIX demo for the rest.
+*
+* Related Document : See docs/host_simulation.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+#include <assert.h>
+#include <limits.h>
+#include <stdint.h>
+
+/* Same as the device configuration (design.modus, System Idle Power Mode
+ * = System Deep Sleep, Deep Sleep Latency = 20 ms) */
+#define CY_CFG_PWR_DEEPSLEEP_LATENCY            (20)
+
+#define configUSE_PREEMPTION                    1
+#define configUSE_PORT_OPTIMISED_TASK_SELECTION 0
+#define configTICK_RATE_HZ                      ((TickType_t)1000)
+#define configMAX_PRIORITIES                    7
+/* The POSIX port runs each task on a pthread and needs at least
+ * PTHREAD_STACK_MIN of stack */
+#define configMINIMAL_STACK_SIZE                ((unsigned short)PTHREAD_STACK_MIN)
+#define configMAX_TASK_NAME_LEN                 16
+#define configUSE_16_BIT_TICKS                  0
+#define configIDLE_SHOULD_YIELD                 1
+#define configUSE_TASK_NOTIFICATIONS            1
+#define configUSE_MUTEXES                       1
+#define configUSE_RECURSIVE_MUTEXES             1
+#define configUSE_COUNTING_SEMAPHORES           1
+#define configQUEUE_REGISTRY_SIZE               10
+#define configUSE_QUEUE_SETS                    0
+#define configUSE_TIME_SLICING                  1
+#define configENABLE_BACKWARD_COMPATIBILITY     0
+#define configNUM_THREAD_LOCAL_STORAGE_POINTERS 5
+
+/* Memory allocation: heap_3.c (malloc) */
+#define configSUPPORT_STATIC_ALLOCATION         0
+#define configSUPPORT_DYNAMIC_ALLOCATION        1
+#define configTOTAL_HEAP_SIZE                   ((size_t)(50 * 1024))
+#define configAPPLICATION_ALLOCATED_HEAP        0
+
+/* The idle hook advances the virtual time while tasks are busy */
+#define configUSE_IDLE_HOOK                     1
+#define configUSE_TICK_HOOK                     1
+#define configCHECK_FOR_STACK_OVERFLOW          0
+#define configUSE_MALLOC_FAILED_HOOK            1
+/* The daemon task startup hook starts the first sleep cycle */
+#define configUSE_DAEMON_TASK_STARTUP_HOOK      1
+
+#define configGENERATE_RUN_TIME_STATS           0
+#define configUSE_TRACE_FACILITY                1
+#define configUSE_STATS_FORMATTING_FUNCTIONS    0
+
+#define configUSE_CO_ROUTINES                   0
+#define configMAX_CO_ROUTINE_PRIORITIES         1
+
+#define configUSE_TIMERS                        1
+#define configTIMER_TASK_PRIORITY               3
+#define configTIMER_QUEUE_LENGTH                10
+#define configTIMER_TASK_STACK_DEPTH            configMINIMAL_STACK_SIZE
+
+#define INCLUDE_vTaskPrioritySet                1
+#define INCLUDE_uxTaskPriorityGet               1
+#define INCLUDE_vTaskDelete                     1
+#define INCLUDE_vTaskCleanUpResources           0
+#define INCLUDE_vTaskSuspend                    1
+#define INCLUDE_xResumeFromISR                  1
+#define INCLUDE_vTaskDelayUntil                 1
+#define INCLUDE_vTaskDelay                      1
+#define INCLUDE_xTaskGetSchedulerState          1
+#define INCLUDE_xTaskGetCurrentTaskHandle       1
+#define INCLUDE_uxTaskGetStackHighWaterMark     0
+#define INCLUDE_xTaskGetIdleTaskHandle          0
+#define INCLUDE_eTaskGetState                   0
+#define INCLUDE_xEventGroupSetBitFromISR        1
+#define INCLUDE_xTimerPendFunctionCall          1
+#define INCLUDE_xTaskAbortDelay                 0
+#define INCLUDE_xTaskGetHandle                  0
+#define INCLUDE_xTaskResumeFromISR              1
+
+#define configASSERT(x)                         assert(x)
+
+/* Tickless idle. vApplicationSleep() in sim_rtos.c replaces the
+ * implementation of the RTOS abstraction library and simulates CPU Sleep and
+ * System DeepSleep. It is called through tickless_idle_sleep() of the
+ * application, as on the device. The idle time is saturated because the
+ * width of TickType_t depends on the host. */
+extern void vApplicationSleep(uint32_t xExpectedIdleTime);
+extern void tickless_idle_sleep(uint32_t expected_idle_ticks);
+#define portSUPPRESS_TICKS_AND_SLEEP(xIdleTime) \
+    tickless_idle_sleep(((xIdleTime) > (TickType_t)UINT32_MAX) ? \
+                        UINT32_MAX : (uint32_t)(xIdleTime))
+#define configUSE_TICKLESS_IDLE                 2
+#define configEXPECTED_IDLE_TIME_BEFORE_SLEEP   2
+
+/* Deferred work batch before DeepSleep, as on the device */
+extern void deferred_work_pre_sleep(uint32_t *expected_idle_ticks);
+#define configPRE_SLEEP_PROCESSING(x)           deferred_work_pre_sleep(&(x))
+
+#endif /* FREERTOS_CONFIG_H */
+
+/* [] END OF FILE */
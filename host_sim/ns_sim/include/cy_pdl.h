@@ -0,0 +1,480 @@
+/*****************************************************************************
+* File Name        : cy_pdl.h
+*
+* Description      : Host stand-in for the subset of the PDL and CMSIS core used
+*                    by the CM33 non-secure application and the POWER_MANAGER
+*                    partition. The behaviour is implemented in sim_pdl.c.
+*
+* Related Document : See docs/host_simulation.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+#ifndef CY_PDL_H
+#define CY_PDL_H
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "cy_result.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Utilities
+*******************************************************************************/
+
+#define CY_UNUSED_PARAMETER(x)      ((void)(x))
+#define CY_ASSERT(x)                assert(x)
+#define CY_HALT()                   assert(0)
+
+/* Placement attributes have no meaning on the host */
+#define CY_SECTION_SHAREDMEM
+#define CY_SECTION(name)
+#define CY_SECTION_RAMFUNC_BEGIN
+#define CY_SECTION_RAMFUNC_END
+
+/* Interrupts are simulated synchronously, see sim_rtos.c */
+static inline void __enable_irq(void) {}
+static inline void __disable_irq(void) {}
+
+/* CMSIS count leading zeros, 32 for 0 like the CLZ instruction */
+static inline uint8_t __CLZ(uint32_t value)
+{
+    return (0U == value) ? 32U : (uint8_t)__builtin_clz(value);
+}
+
+uint32_t Cy_SysLib_EnterCriticalSection(void);
+void Cy_SysLib_ExitCriticalSection(uint32_t savedIntrStatus);
+void Cy_SysLib_Delay(uint32_t milliseconds);
+void Cy_SysLib_DelayUs(uint16_t microseconds);
+
+/* Reset causes of Cy_SysLib_GetResetReason() */
+#define CY_SYSLIB_RESET_HWWDT           (0x00000001UL)
+#define CY_SYSLIB_RESET_ACT_FAULT       (0x00000002UL)
+#define CY_SYSLIB_RESET_DPSLP_FAULT     (0x00000004UL)
+#define CY_SYSLIB_RESET_SOFT            (0x00000010UL)
+#define CY_SYSLIB_RESET_SWWDT0          (0x00000020UL)
+#define CY_SYSLIB_RESET_SWWDT1          (0x00000040UL)
+#define CY_SYSLIB_RESET_HIB_WAKEUP      (0x00040000UL)
+
+uint32_t Cy_SysLib_GetResetReason(void);
+void Cy_SysLib_ClearResetReason(void);
+
+/*******************************************************************************
+* Core registers
+*******************************************************************************/
+
+typedef struct
+{
+    volatile uint32_t DEMCR;
+} CoreDebug_Type;
+
+typedef struct
+{
+    volatile uint32_t CTRL;
+    volatile uint32_t CYCCNT;
+} DWT_Type;
+
+typedef struct
+{
+    volatile uint32_t CTRL;
+    volatile uint32_t LOAD;
+    volatile uint32_t VAL;
+} SysTick_Type;
+
+/* Enable and pending registers only. The simulation has no NS peripheral
+ * interrupts, nothing is ever pending. */
+typedef struct
+{
+    volatile uint32_t ISER[16U];
+    volatile uint32_t ICER[16U];
+    volatile uint32_t ISPR[16U];
+    volatile uint32_t ICPR[16U];
+} NVIC_Type;
+
+#define CoreDebug_DEMCR_TRCENA_Msk  (1UL << 24U)
+#define DWT_CTRL_CYCCNTENA_Msk      (1UL << 0U)
+
+/* DWT->CYCCNT follows the virtual time at the current core clock; writes to
+ * the counter are ignored. */
+extern CoreDebug_Type sim_core_debug;
+extern SysTick_Type sim_systick;
+extern NVIC_Type sim_nvic;
+DWT_Type *sim_dwt(void);
+
+#define CoreDebug                   (&sim_core_debug)
+#define SysTick                     (&sim_systick)
+#define NVIC                        (&sim_nvic)
+#define DWT                         (sim_dwt())
+
+extern uint32_t SystemCoreClock;
+void SystemCoreClockUpdate(void);
+
+/*******************************************************************************
+* GPIO
+*******************************************************************************/
+
+typedef struct
+{
+    uint32_t OUT;
+    uint32_t INTR;
+    uint32_t INTR_MASK;
+    uint32_t INTR_W1C;  /* last write to INTR, see GPIO_PRT_INTR() */
+} GPIO_PRT_Type;
+
+#define CY_GPIO_PINS_MAX            (8U)
+
+/* Edge of the glitch filter, the bit above the pins in INTR and INTR_MASK */
+#define GPIO_PRT_INTR_FLT_EDGE_Msk  (1UL << CY_GPIO_PINS_MAX)
+
+/* Port register access. Writing 1 to a pin of INTR clears its interrupt; the
+ * simulation applies the write at the next read of INTR_MASKED and when the
+ * secure interrupt handler returns. */
+#define GPIO_PRT_INTR(base)         ((base)->INTR_W1C)
+#define GPIO_PRT_INTR_MASKED(base)  (sim_gpio_intr_masked(base))
+
+void Cy_GPIO_Set(GPIO_PRT_Type *base, uint32_t pinNum);
+void Cy_GPIO_Clr(GPIO_PRT_Type *base, uint32_t pinNum);
+void Cy_GPIO_Inv(GPIO_PRT_Type *base, uint32_t pinNum);
+uint32_t Cy_GPIO_ReadOut(GPIO_PRT_Type *base, uint32_t pinNum);
+uint32_t Cy_GPIO_GetInterruptStatus(GPIO_PRT_Type *base, uint32_t pinNum);
+void Cy_GPIO_ClearInterrupt(GPIO_PRT_Type *base, uint32_t pinNum);
+void Cy_GPIO_SetInterruptMask(GPIO_PRT_Type *base, uint32_t pinNum,
+                              uint32_t value);
+uint32_t Cy_GPIO_GetInterruptMask(GPIO_PRT_Type *base, uint32_t pinNum);
+uint32_t Cy_GPIO_GetInterruptStatusMasked(GPIO_PRT_Type *base,
+                                          uint32_t pinNum);
+uint32_t sim_gpio_intr_masked(GPIO_PRT_Type *base);
+void sim_gpio_apply_w1c(GPIO_PRT_Type *base);
+
+/*******************************************************************************
+* System power management
+*******************************************************************************/
+
+typedef enum
+{
+    CY_SYSPM_SUCCESS       = 0x0U,
+    CY_SYSPM_BAD_PARAM     = 0x1U,
+    CY_SYSPM_TIMEOUT       = 0x2U,
+    CY_SYSPM_INVALID_STATE = 0x3U,
+    CY_SYSPM_CANCELED      = 0x4U,
+    CY_SYSPM_SYSCALL_PENDING = 0x5U,
+    CY_SYSPM_FAIL          = 0xFFU
+} cy_en_syspm_status_t;
+
+typedef enum
+{
+    CY_SYSPM_SLEEP      = 0U,
+    CY_SYSPM_DEEPSLEEP  = 1U,
+    CY_SYSPM_HIBERNATE  = 2U,
+    CY_SYSPM_LP         = 3U,
+    CY_SYSPM_ULP        = 4U,
+    CY_SYSPM_HP         = 5U
+} cy_en_syspm_callback_type_t;
+
+typedef enum
+{
+    CY_SYSPM_CHECK_READY        = 0x01U,
+    CY_SYSPM_CHECK_FAIL         = 0x02U,
+    CY_SYSPM_BEFORE_TRANSITION  = 0x04U,
+    CY_SYSPM_AFTER_TRANSITION   = 0x08U
+} cy_en_syspm_callback_mode_t;
+
+#define CY_SYSPM_SKIP_CHECK_READY       (0x01U)
+#define CY_SYSPM_SKIP_CHECK_FAIL        (0x02U)
+#define CY_SYSPM_SKIP_BEFORE_TRANSITION (0x04U)
+#define CY_SYSPM_SKIP_AFTER_TRANSITION  (0x08U)
+
+typedef struct
+{
+    void *base;
+    void *context;
+} cy_stc_syspm_callback_params_t;
+
+typedef cy_en_syspm_status_t (*Cy_SysPmCallback)
+    (cy_stc_syspm_callback_params_t *callbackParams,
+     cy_en_syspm_callback_mode_t mode);
+
+typedef struct cy_stc_syspm_callback
+{
+    Cy_SysPmCallback callback;
+    cy_en_syspm_callback_type_t type;
+    uint32_t skipMode;
+    cy_stc_syspm_callback_params_t *callbackParams;
+    struct cy_stc_syspm_callback *prevItm;
+    struct cy_stc_syspm_callback *nextItm;
+    uint8_t order;
+} cy_stc_syspm_callback_t;
+
+bool Cy_SysPm_RegisterCallback(cy_stc_syspm_callback_t *handler);
+bool Cy_SysPm_UnregisterCallback(cy_stc_syspm_callback_t const *handler);
+cy_en_syspm_status_t Cy_SysPm_SystemEnterHp(void);
+cy_en_syspm_status_t Cy_SysPm_SystemEnterLp(void);
+cy_en_syspm_status_t Cy_SysPm_SystemEnterUlp(void);
+
+/* Hibernate wake-up sources and causes */
+typedef enum
+{
+    CY_SYSPM_HIBERNATE_NO_SRC    = 0x00000U,
+    CY_SYSPM_HIBERNATE_PIN0_LOW  = 0x00004U,
+    CY_SYSPM_HIBERNATE_PIN1_LOW  = 0x00008U,
+    CY_SYSPM_HIBERNATE_RTC_ALARM = 0x10000U,
+    CY_SYSPM_HIBERNATE_WDT       = 0x20000U
+} cy_en_syspm_hibernate_wakeup_source_t;
+
+/* The device wakes up from Hibernate through a reset. The simulation ends
+ * the run instead, see sim_pdl_set_hibernate_file(). */
+void Cy_SysPm_SetHibernateWakeupSource(uint32_t wakeupSource);
+void Cy_SysPm_ClearHibernateWakeupSource(uint32_t wakeupSource);
+cy_en_syspm_hibernate_wakeup_source_t Cy_SysPm_GetHibernateWakeupCause(void);
+void Cy_SysPm_ClearHibernateWakeupCause(void);
+cy_en_syspm_status_t Cy_SysPm_SystemEnterHibernate(void);
+
+/* SRAM macro power */
+typedef enum
+{
+    CY_SYSPM_SRAM0_MEMORY = 0U,
+    CY_SYSPM_SRAM1_MEMORY = 1U
+} cy_en_syspm_sram_index_t;
+
+typedef enum
+{
+    CY_SYSPM_SRAM_PWR_MODE_OFF = 0U,
+    CY_SYSPM_SRAM_PWR_MODE_ON  = 3U
+} cy_en_syspm_sram_pwr_mode_t;
+
+cy_en_syspm_status_t Cy_SysPm_SetSRAMMacroPwrMode(cy_en_syspm_sram_index_t sramNum,
+                                                  uint32_t sramMacroNum,
+                                                  cy_en_syspm_sram_pwr_mode_t sramPwrMode);
+
+/*******************************************************************************
+* Clocks
+*******************************************************************************/
+
+typedef enum
+{
+    CY_SYSCLK_CLKHF_NO_DIVIDE   = 0U,
+    CY_SYSCLK_CLKHF_DIVIDE_BY_2 = 1U,
+    CY_SYSCLK_CLKHF_DIVIDE_BY_3 = 2U,
+    CY_SYSCLK_CLKHF_DIVIDE_BY_4 = 3U,
+    CY_SYSCLK_CLKHF_DIVIDE_BY_8 = 7U
+} cy_en_clkhf_dividers_t;
+
+typedef enum
+{
+    CY_SYSCLK_SUCCESS   = 0x00U,
+    CY_SYSCLK_BAD_PARAM = 0x01U
+} cy_en_sysclk_status_t;
+
+cy_en_sysclk_status_t Cy_SysClk_ClkHfSetDivider(uint32_t clkHf,
+                                                cy_en_clkhf_dividers_t divider);
+uint32_t Cy_SysClk_ClkLfGetFrequency(void);
+
+/*******************************************************************************
+* CM55 and power domains
+*******************************************************************************/
+
+typedef struct
+{
+    uint32_t CTL;
+} MXCM55_Type;
+
+extern MXCM55_Type sim_mxcm55;
+#define MXCM55                      (&sim_mxcm55)
+
+void Cy_SysEnableCM55(MXCM55_Type *base, uint32_t vectorTableOffset,
+                      uint32_t waitus);
+void Cy_SysDisableCM55(MXCM55_Type *base, uint32_t waitus);
+void Cy_System_EnablePD1(void);
+void Cy_System_DisablePD1(void);
+
+/*******************************************************************************
+* SCB UART
+*******************************************************************************/
+
+typedef struct
+{
+    uint32_t CTRL;
+} CySCB_Type;
+
+uint32_t Cy_SCB_GetFifoSize(CySCB_Type const *base);
+uint32_t Cy_SCB_UART_GetNumInTxFifo(CySCB_Type const *base);
+bool Cy_SCB_UART_IsTxComplete(CySCB_Type const *base);
+
+/*******************************************************************************
+* MCWDT and RTC
+*******************************************************************************/
+
+typedef struct
+{
+    uint32_t CTL;
+    uint32_t CONFIG;
+} MCWDT_STRUCT_Type;
+
+typedef struct
+{
+    uint32_t c0Match;
+    bool c0c1Cascade;
+    bool c1c2Cascade;
+} cy_stc_mcwdt_config_t;
+
+typedef enum
+{
+    CY_MCWDT_CASCADE_NONE = 0U,
+    CY_MCWDT_CASCADE_C0C1 = 1U,
+    CY_MCWDT_CASCADE_C1C2 = 2U,
+    CY_MCWDT_CASCADE_BOTH = 3U
+} cy_en_mcwdtcascade_t;
+
+typedef enum
+{
+    CY_MCWDT_SUCCESS   = 0x00U,
+    CY_MCWDT_BAD_PARAM = 0x01U
+} cy_en_mcwdt_status_t;
+
+#define CY_MCWDT_CTR_Msk            (0x7UL)
+
+cy_en_mcwdt_status_t Cy_MCWDT_Init(MCWDT_STRUCT_Type *base,
+                                   cy_stc_mcwdt_config_t const *config);
+void Cy_MCWDT_Enable(MCWDT_STRUCT_Type *base, uint32_t counters,
+                     uint16_t waitUs);
+cy_en_mcwdtcascade_t Cy_MCWDT_GetCascade(MCWDT_STRUCT_Type const *base);
+
+typedef enum
+{
+    CY_RTC_AM = 0U,
+    CY_RTC_PM = 1U
+} cy_en_rtc_am_pm_t;
+
+typedef enum
+{
+    CY_RTC_24_HOURS = 0U,
+    CY_RTC_12_HOURS = 1U
+} cy_en_rtc_hours_format_t;
+
+#define CY_RTC_SUNDAY               (1UL)
+#define CY_RTC_MONDAY               (2UL)
+#define CY_RTC_TUESDAY              (3UL)
+#define CY_RTC_WEDNESDAY            (4UL)
+#define CY_RTC_THURSDAY             (5UL)
+#define CY_RTC_FRIDAY               (6UL)
+#define CY_RTC_SATURDAY             (7UL)
+
+/* Year is 0 to 99 for 2000 to 2099 */
+typedef struct
+{
+    uint32_t sec;
+    uint32_t min;
+    uint32_t hour;
+    cy_en_rtc_am_pm_t amPm;
+    cy_en_rtc_hours_format_t hrFormat;
+    uint32_t dayOfWeek;
+    uint32_t date;
+    uint32_t month;
+    uint32_t year;
+} cy_stc_rtc_config_t;
+
+typedef enum
+{
+    CY_RTC_ALARM_DISABLE = 0U,
+    CY_RTC_ALARM_ENABLE  = 1U
+} cy_en_rtc_alarm_enable_t;
+
+typedef enum
+{
+    CY_RTC_ALARM_1 = 0U,
+    CY_RTC_ALARM_2 = 1U
+} cy_en_rtc_alarm_t;
+
+typedef struct
+{
+    uint32_t sec;
+    cy_en_rtc_alarm_enable_t secEn;
+    uint32_t min;
+    cy_en_rtc_alarm_enable_t minEn;
+    uint32_t hour;
+    cy_en_rtc_alarm_enable_t hourEn;
+    uint32_t dayOfWeek;
+    cy_en_rtc_alarm_enable_t dayOfWeekEn;
+    uint32_t date;
+    cy_en_rtc_alarm_enable_t dateEn;
+    uint32_t month;
+    cy_en_rtc_alarm_enable_t monthEn;
+    cy_en_rtc_alarm_enable_t almEn;
+} cy_stc_rtc_alarm_t;
+
+typedef enum
+{
+    CY_RTC_SUCCESS     = 0x00U,
+    CY_RTC_BAD_PARAM   = 0x01U
+} cy_en_rtc_status_t;
+
+#define CY_RTC_INTR_ALARM1          (0x01UL)
+#define CY_RTC_INTR_ALARM2          (0x02UL)
+#define CY_RTC_INTR_CENTURY         (0x04UL)
+
+cy_en_rtc_status_t Cy_RTC_Init(cy_stc_rtc_config_t const *config);
+cy_en_rtc_status_t Cy_RTC_SetDateAndTime(cy_stc_rtc_config_t const *dateTime);
+void Cy_RTC_GetDateAndTime(cy_stc_rtc_config_t *dateTime);
+cy_en_rtc_status_t Cy_RTC_SetAlarmDateAndTime(
+    cy_stc_rtc_alarm_t const *alarmDateTime, cy_en_rtc_alarm_t alarmIndex);
+uint32_t Cy_RTC_GetInterruptStatus(void);
+uint32_t Cy_RTC_GetInterruptStatusMasked(void);
+uint32_t Cy_RTC_GetInterruptMask(void);
+void Cy_RTC_SetInterruptMask(uint32_t interruptMask);
+void Cy_RTC_ClearInterrupt(uint32_t interruptMask);
+
+/*******************************************************************************
+* Backup domain
+*******************************************************************************/
+
+/* Backup registers, kept in Hibernate */
+typedef struct
+{
+    volatile uint32_t BREG[16U];
+} BACKUP_Type;
+
+extern BACKUP_Type sim_backup;
+
+#define BACKUP                      (&sim_backup)
+
+/*******************************************************************************
+* Memory layout
+*******************************************************************************/
+
+/* RAM sections of a typical CM33 non-secure image in the m33_data region,
+ * in place of the linker script symbols used by sram_retention.c. The
+ * simulated application itself runs in host memory. */
+#define SRAM_RETENTION_SECTIONS \
+    { "vectors", (const void *)0x240BD000UL, (const void *)0x240BD400UL }, \
+    { "data",    (const void *)0x240BD400UL, (const void *)0x240CF000UL }, \
+    { "heap",    (const void *)0x240CF000UL, (const void *)0x240E7000UL }, \
+    { "stack",   (const void *)0x240FC000UL, (const void *)0x240FD000UL }
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CY_PDL_H */
+
+/* [] END OF FILE */
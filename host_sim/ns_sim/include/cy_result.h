@@ -0,0 +1,57 @@
+/*****************************************************************************
+* File Name        : cy_result.h
+*
+* Description      : Host stand-in for the ModusToolbox result type used by the
+*                    CM33 non-secure application in the POSIX simulation
+*
+* Related Document : See docs/host_simulation.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+#ifndef CY_RESULT_H
+#define CY_RESULT_H
+
+#include <stdint.h>
+
+/*******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+typedef uint32_t cy_rslt_t;
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+#define CY_RSLT_SUCCESS                     ((cy_rslt_t)0x00000000U)
+
+#define CY_RSLT_TYPE_INFO                   (0U)
+#define CY_RSLT_TYPE_WARNING                (1U)
+#define CY_RSLT_TYPE_ERROR                  (2U)
+#define CY_RSLT_TYPE_FATAL                  (3U)
+
+#define CY_RSLT_MODULE_MIDDLEWARE_BASE      (0x0A00U)
+
+#define CY_RSLT_CREATE(type, module, code) \
+    ((((uint32_t)(module) & 0x3FFFU) << 16U) | \
+     (((uint32_t)(type) & 0x3U) << 30U) | ((uint32_t)(code) & 0xFFFFU))
+
+#endif /* CY_RESULT_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,114 @@
+/*****************************************************************************
+* File Name        : cybsp.h
+*
+* Description      : Host stand-in for the board support package of the
+*                    KIT_PSE84_EVAL_EPC4 kit in the POSIX simulation
+*
+* Related Document : See docs/host_simulation.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+#ifndef CYBSP_H
+#define CYBSP_H
+
+#include "cy_pdl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+/* LPTimer and RTC HAL objects. The LPTimer counts the virtual time. */
+typedef struct
+{
+    uint32_t configured;
+} mtb_hal_lptimer_t;
+
+typedef struct
+{
+    uint32_t configured;
+} mtb_hal_lptimer_configurator_t;
+
+typedef struct
+{
+    uint32_t configured;
+} mtb_hal_rtc_t;
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+#define SIM_GPIO_PORT_COUNT             (22U)
+
+#define CYBSP_USER_LED1_PORT            (&sim_gpio_prt[16])
+#define CYBSP_USER_LED1_PIN             (7U)
+#define CYBSP_USER_LED2_PORT            (&sim_gpio_prt[16])
+#define CYBSP_USER_LED2_PIN             (6U)
+#define CYBSP_USER_BTN1_PORT            (&sim_gpio_prt[8])
+#define CYBSP_USER_BTN1_PIN             (3U)
+#define CYBSP_USER_BTN2_ENABLED         (1U)
+#define CYBSP_USER_BTN2_PORT            (&sim_gpio_prt[8])
+#define CYBSP_USER_BTN2_PIN             (7U)
+
+#define CYBSP_CM33_LPTIMER_0_HW         (&sim_mcwdt)
+
+#define IFX_TFM_SPM_UART_HW             (&sim_scb2)
+
+#define CYMEM_CM33_0_m55_nvm_START      (0x60580000U)
+#define CYBSP_MCUBOOT_HEADER_SIZE       (0x400U)
+
+/* The m33_m55_boot_status region is a host buffer */
+#define CYMEM_CM33_0_m33_m55_boot_status_START (sim_boot_status_region)
+
+/* The m33_m55_pm_gen region is a host variable, in which the simulated SPM
+ * publishes the POWER_MANAGER state generation */
+#define CYMEM_CM33_0_m33_m55_pm_gen_START (&sim_power_manager_gen)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+extern GPIO_PRT_Type sim_gpio_prt[SIM_GPIO_PORT_COUNT];
+extern MCWDT_STRUCT_Type sim_mcwdt;
+extern CySCB_Type sim_scb2;
+extern uint32_t sim_boot_status_region[];
+extern const cy_stc_mcwdt_config_t CYBSP_CM33_LPTIMER_0_config;
+extern const mtb_hal_lptimer_configurator_t CYBSP_CM33_LPTIMER_0_hal_config;
+extern cy_stc_rtc_config_t CYBSP_RTC_config;
+extern volatile uint32_t sim_power_manager_gen;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+cy_rslt_t cybsp_init(void);
+cy_rslt_t mtb_hal_lptimer_setup(mtb_hal_lptimer_t *obj,
+                                const mtb_hal_lptimer_configurator_t *config);
+uint32_t mtb_hal_lptimer_read(const mtb_hal_lptimer_t *obj);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CYBSP_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,38 @@
+/*****************************************************************************
+* File Name        : cycfg_qspi_memslot.h
+*
+* Description      : Host stand-in for the memory configurations generated by
+*                    the QSPI configurator. The memory is modelled in
+*                    sim_pdl.c.
+*
+* Related Document : See docs/host_simulation.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+#ifndef CYCFG_QSPI_MEMSLOT_H
+#define CYCFG_QSPI_MEMSLOT_H
+
+#include "cy_pdl.h"
+
+/* The external flash the images execute from */
+extern cy_stc_smif_mem_config_t *const smif0MemConfigs[];
+
+#endif /* CYCFG_QSPI_MEMSLOT_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,68 @@
+/*****************************************************************************
+* File Name        : client.h
+*
+* Description      : Host stand-in for the PSA client API. psa_call() is
+*                    dispatched to the partition in sim_tfm.c.
+*
+* Related Document : See docs/host_simulation.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+#ifndef PSA_CLIENT_H
+#define PSA_CLIENT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "psa/error.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PSA_MAX_IOVEC                   (4U)
+#define PSA_IPC_CALL                    (0)
+
+#define IOVEC_LEN(arr)                  ((uint32_t)(sizeof(arr) / sizeof(arr[0])))
+
+typedef int32_t psa_handle_t;
+
+typedef struct psa_invec
+{
+    const void *base;
+    size_t len;
+} psa_invec;
+
+typedef struct psa_outvec
+{
+    void *base;
+    size_t len;
+} psa_outvec;
+
+psa_status_t psa_call(psa_handle_t handle, int32_t type,
+                      const psa_invec *in_vec, size_t in_len,
+                      psa_outvec *out_vec, size_t out_len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PSA_CLIENT_H */
+
+/* [] END OF FILE */
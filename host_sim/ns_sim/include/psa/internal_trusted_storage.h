@@ -0,0 +1,59 @@
+/*****************************************************************************
+* File Name        : internal_trusted_storage.h
+*
+* Description      : Host stand-in for the PSA Internal Trusted Storage API
+*                    used by secure partitions
+*
+* Related Document : See docs/host_simulation.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+#ifndef PSA_INTERNAL_TRUSTED_STORAGE_H
+#define PSA_INTERNAL_TRUSTED_STORAGE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "psa/error.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef uint64_t psa_storage_uid_t;
+typedef uint32_t psa_storage_create_flags_t;
+
+#define PSA_STORAGE_FLAG_NONE           ((psa_storage_create_flags_t)0)
+#define PSA_STORAGE_FLAG_WRITE_ONCE     ((psa_storage_create_flags_t)1)
+
+psa_status_t psa_its_set(psa_storage_uid_t uid, size_t data_length,
+                         const void *p_data,
+                         psa_storage_create_flags_t create_flags);
+psa_status_t psa_its_get(psa_storage_uid_t uid, size_t data_offset,
+                         size_t data_size, void *p_data,
+                         size_t *p_data_length);
+psa_status_t psa_its_remove(psa_storage_uid_t uid);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PSA_INTERNAL_TRUSTED_STORAGE_H */
+
+/* [] END OF FILE */
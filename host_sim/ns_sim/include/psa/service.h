@@ -0,0 +1,69 @@
+/*****************************************************************************
+* File Name        : service.h
+*
+* Description      : Host stand-in for the PSA secure partition API used by the
+*                    POWER_MANAGER partition
+*
+* Related Document : See docs/host_simulation.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+#ifndef PSA_SERVICE_H
+#define PSA_SERVICE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "psa/client.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef uint32_t psa_signal_t;
+typedef uint32_t psa_flih_result_t;
+typedef uint32_t psa_irq_status_t;
+
+#define PSA_FLIH_NO_SIGNAL              ((psa_flih_result_t)0)
+#define PSA_FLIH_SIGNAL                 ((psa_flih_result_t)1)
+
+typedef struct psa_msg_t
+{
+    int32_t type;
+    psa_handle_t handle;
+    int32_t client_id;
+    void *rhandle;
+    size_t in_size[PSA_MAX_IOVEC];
+    size_t out_size[PSA_MAX_IOVEC];
+} psa_msg_t;
+
+size_t psa_read(psa_handle_t msg_handle, uint32_t invec_idx,
+                void *buffer, size_t num_bytes);
+void psa_write(psa_handle_t msg_handle, uint32_t outvec_idx,
+               const void *buffer, size_t num_bytes);
+void psa_irq_enable(psa_signal_t irq_signal);
+psa_irq_status_t psa_irq_disable(psa_signal_t irq_signal);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PSA_SERVICE_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,41 @@
+/*****************************************************************************
+* File Name        : power_manager.h
+*
+* Description      : Host stand-in for the manifest header generated from
+*                    power_manager.json
+*
+* Related Document : See docs/host_simulation.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+#ifndef PSA_MANIFEST_POWER_MANAGER_H
+#define PSA_MANIFEST_POWER_MANAGER_H
+
+#include "psa/service.h"
+
+#define USER_BTN1_INTERRUPT_SIGNAL      (1U << 4U)
+#define RTC_ALARM_INTERRUPT_SIGNAL      (1U << 5U)
+
+psa_status_t power_manager_service_sfn(const psa_msg_t *msg);
+psa_flih_result_t user_btn1_interrupt_flih(void);
+psa_flih_result_t rtc_alarm_interrupt_flih(void);
+
+#endif /* PSA_MANIFEST_POWER_MANAGER_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,36 @@
+/*****************************************************************************
+* File Name        : sid.h
+*
+* Description      : Host stand-in for the service IDs generated from the
+*                    partition manifests
+*
+* Related Document : See docs/host_simulation.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+#ifndef PSA_MANIFEST_SID_H
+#define PSA_MANIFEST_SID_H
+
+#define POWER_MANAGER_SERVICE_SID       (0x49465000U)
+#define POWER_MANAGER_SERVICE_VERSION   (1U)
+#define POWER_MANAGER_SERVICE_HANDLE    (0x40000101)
+
+#endif /* PSA_MANIFEST_SID_H */
+
+/* [] END OF FILE */
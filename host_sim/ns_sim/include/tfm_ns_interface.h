@@ -0,0 +1,35 @@
+/*****************************************************************************
+* File Name        : tfm_ns_interface.h
+*
+* Description      : Host stand-in for the TF-M non-secure interface
+*
+* Related Document : See docs/host_simulation.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+#ifndef TFM_NS_INTERFACE_H
+#define TFM_NS_INTERFACE_H
+
+#include <stdint.h>
+
+int32_t tfm_ns_interface_init(void);
+
+#endif /* TFM_NS_INTERFACE_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,283 @@
+/*****************************************************************************
+* File Name        : sim.h
+*
+* Description      : Interface between the modules of the POSIX simulation of the
+*                    CM33 non-secure application: virtual time, simulated power
+*                    modes, wake injection and the TF-M stand-in
+*
+* Related Document : See docs/host_simulation.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+#ifndef SIM_H
+#define SIM_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "cy_pdl.h"
+#include "psa/service.h"
+
+#include "wake_recorder.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* No further event scheduled */
+#define SIM_TIME_NEVER              (UINT64_MAX)
+
+/* Clock path of CLK_HF0, which design.modus divides by 2 for the CM33 core */
+#define SIM_CLK_PATH0_HZ            (400000000UL)
+
+/* Default simulated time from CM55 boot request to CM55 ready */
+#define SIM_CM55_BOOT_US_DEFAULT    (1200U)
+
+/* Default time from a DeepSleep exit until instructions can be fetched from
+ * the external flash again. 0 models a flash that is ready at once. */
+#define SIM_XIP_RESUME_US_DEFAULT   (0U)
+
+/* Cost model of a secure call: NS to SPE transition and return, plus the
+ * copy of the vectors. NS interrupts are masked for the whole duration. */
+#define SIM_PSA_CALL_BASE_US_DEFAULT (10U)
+#define SIM_PSA_CALL_NS_PER_BYTE    (10U)
+
+/* Cost model of a platform log call: the SPE puts the message into the TX
+ * FIFO of the UART (115200 baud, 10 bits per byte), waiting for space when
+ * the FIFO is full, before it returns */
+#define SIM_LOG_CALL_BASE_US        (10U)
+#define SIM_LOG_NS_PER_BYTE         (86806U)
+
+/* TX FIFO of the UART of the platform log service, in bytes. The service
+ * returns once the last byte of a message is in the FIFO. */
+#define SIM_UART_FIFO_SIZE          (128U)
+
+/* Number of distinct service operations tracked in sim_psa_stats_t */
+#define SIM_PSA_MAX_OPS             (16U)
+
+/*******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+/* Wake injection. A periodic and a random (exponentially distributed) source
+ * can be active at the same time; a period or mean of 0 disables it. Every
+ * press of either source is a burst of burst_len interrupts, burst_gap_us
+ * apart, like a bouncing or chattering button. */
+typedef struct
+{
+    uint32_t period_ms;
+    uint32_t first_ms;
+    uint32_t random_mean_ms;
+    uint32_t seed;
+    uint32_t burst_len;
+    uint32_t burst_gap_us;
+} sim_wake_config_t;
+
+/* Power mode residency and wake statistics, in virtual time */
+typedef struct
+{
+    uint64_t active_us;
+    uint64_t sleep_us;
+    uint64_t deepsleep_us;
+    uint32_t sleep_entries;
+    uint32_t deepsleep_entries;
+    uint32_t deepsleep_aborts;
+    uint32_t wakes_by_event;
+    uint32_t wakes_by_timer;
+} sim_power_stats_t;
+
+/* Hibernate of a run. A run that starts with the snapshot file of a
+ * Hibernate entry resumes; a run that enters Hibernate ends there. */
+typedef struct
+{
+    bool resumed;
+    bool entered;
+    uint64_t entry_us;          /* virtual time of the entry */
+    uint64_t hibernate_us;      /* time until the wake-up, SIM_TIME_NEVER for none */
+    uint32_t resume_cause;      /* wake-up cause that started the run */
+    uint32_t wakeup_cause;      /* wake-up cause that ends the Hibernate entry */
+} sim_hibernate_stats_t;
+
+/* SRAM macro power as seen by the DeepSleep entries of a run */
+typedef struct
+{
+    uint32_t off_mask;          /* macros off at the last DeepSleep entry */
+    uint32_t deepsleeps;        /* DeepSleep entries with macros off */
+    uint32_t off_after_exit;    /* macros off after any DeepSleep exit */
+} sim_sram_stats_t;
+
+/* Instruction fetches from the external flash after the DeepSleep exits of a
+ * run */
+typedef struct
+{
+    uint32_t exits;             /* DeepSleep exits */
+    uint64_t first_us;          /* wake-up to the first AFTER_TRANSITION
+                                 * callback, summed */
+    uint32_t first_max_us;
+    uint64_t stall_us;          /* fetches waiting for the flash, summed */
+    uint32_t secure_wakes;      /* exits that ran a secure handler first */
+} sim_xip_stats_t;
+
+/* Wake-ups of the CM55 client */
+typedef struct
+{
+    bool enabled;
+    uint32_t lptimer_wakes;     /* CM55 LPTimer wake-ups */
+    uint32_t event_wakes;       /* partition interrupts */
+    uint32_t off_wakes;         /* wake-ups missed while CM55 was off */
+} sim_cm55_stats_t;
+
+/* One secure call, as recorded by the psa_call() stand-in */
+typedef struct
+{
+    uint64_t time_us;
+    uint32_t sid;
+    int32_t type;
+    uint32_t in_len;
+    uint32_t out_len;
+    uint32_t in_bytes;
+    uint32_t out_bytes;
+    uint32_t cost_us;
+    psa_status_t status;
+} sim_psa_call_t;
+
+/* Totals of one service operation (SID and type) */
+typedef struct
+{
+    uint32_t sid;
+    int32_t type;
+    uint32_t calls;
+    uint64_t in_bytes;
+    uint64_t out_bytes;
+    uint64_t cost_us;
+} sim_psa_op_stats_t;
+
+/* Internal Trusted Storage writes */
+typedef struct
+{
+    uint32_t writes;
+    uint64_t bytes;
+} sim_its_stats_t;
+
+/* Secure call budget per sleep cycle. A limit of 0 is not checked. */
+typedef struct
+{
+    uint32_t max_calls;
+    uint32_t max_bytes;
+} sim_psa_budget_t;
+
+/* Secure call statistics. The first sleep cycle starts with the scheduler;
+ * the calls of main() before it are start-up calls. A sleep cycle ends when
+ * the AFTER_TRANSITION callbacks of a DeepSleep exit have run. */
+typedef struct
+{
+    uint32_t cycles;
+    uint32_t calls;
+    uint64_t bytes;
+    uint32_t startup_calls;
+    uint32_t startup_bytes;
+    uint32_t log_calls;         /* UART state reads of the log transport,
+                                 * not counted in the cycles */
+    uint64_t cost_us;
+    uint32_t max_cycle_calls;
+    uint32_t max_cycle_bytes;
+    uint32_t max_cycle_cost_us;
+    uint32_t over_budget_cycles;
+    uint32_t first_over_budget_cycle;
+    uint32_t op_count;
+    sim_psa_op_stats_t ops[SIM_PSA_MAX_OPS];
+} sim_psa_stats_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+/* Virtual time (sim_rtos.c) */
+void sim_rtos_init(uint64_t duration_us, uint32_t cycle_limit);
+uint64_t sim_time_us(void);
+void sim_time_busy_wait_us(uint64_t duration_us);
+void sim_rtos_get_stats(sim_power_stats_t *stats);
+
+/* SysPm callback chain (sim_pdl.c). enter runs CHECK_READY and
+ * BEFORE_TRANSITION, exit runs AFTER_TRANSITION. */
+cy_en_syspm_status_t sim_syspm_enter(cy_en_syspm_callback_type_t type);
+void sim_syspm_exit(cy_en_syspm_callback_type_t type);
+void sim_pdl_set_cm55_boot_us(uint32_t boot_us);
+bool sim_pdl_cm55_running(void);
+void sim_pdl_set_lptimer_single(bool single);
+bool sim_pdl_set_hibernate_file(const char *path);
+void sim_pdl_get_hibernate_stats(sim_hibernate_stats_t *stats);
+void sim_pdl_get_sram_stats(sim_sram_stats_t *stats);
+void sim_pdl_set_xip_resume_us(uint32_t resume_us);
+void sim_pdl_xip_fetch(void);
+void sim_pdl_secure_handler(void);
+void sim_pdl_get_xip_stats(sim_xip_stats_t *stats);
+uint64_t sim_pdl_uart_write(uint32_t size);
+
+/* RTC alarms (sim_pdl.c). An alarm that is due sets its interrupt and, if
+ * ALARM2 is unmasked, runs the secure alarm handler. */
+uint64_t sim_rtc_next_alarm_us(void);
+uint32_t sim_rtc_fire_due(uint64_t now_us);
+
+/* Wake injection (sim_wake.c) */
+void sim_wake_init(const sim_wake_config_t *config);
+uint64_t sim_wake_next_us(void);
+uint32_t sim_wake_fire_due(uint64_t now_us);
+uint32_t sim_wake_get_count(void);
+uint32_t sim_wake_get_delivered(void);
+bool sim_wake_load_timeline(const char *path, wake_recorder_summary_t *recorded);
+uint64_t sim_wake_bench_demux(uint32_t pin_count, uint32_t runs);
+
+/* CM55 client of the POWER_MANAGER (sim_cm55.c) */
+bool sim_cm55_init(uint32_t wake_period_ms);
+void sim_cm55_run_due(uint64_t now_us);
+void sim_cm55_event(void);
+void sim_cm55_get_stats(sim_cm55_stats_t *stats);
+
+/* Secure side (sim_tfm.c) */
+void sim_tfm_init(void);
+bool sim_tfm_raise_irq(psa_signal_t irq_signal);
+void sim_tfm_set_quiet(bool quiet);
+int32_t sim_tfm_set_client_id(int32_t client_id);
+uint32_t sim_tfm_get_mailbox_calls(void);
+void sim_tfm_set_call_cost(uint32_t base_us);
+void sim_tfm_set_budget(const sim_psa_budget_t *budget);
+void sim_tfm_set_trace(FILE *trace);
+void sim_tfm_start_cycles(void);
+uint32_t sim_tfm_end_cycle(void);
+void sim_tfm_get_psa_stats(sim_psa_stats_t *stats);
+bool sim_tfm_set_its_file(const char *path);
+void sim_tfm_get_its_stats(sim_its_stats_t *stats);
+psa_status_t power_manager_init(void);
+
+/* Ends the simulation, prints the report and exits (sim_main.c) */
+void sim_finish(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SIM_H */
+
+/* [] END OF FILE */
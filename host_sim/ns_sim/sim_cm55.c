@@ -0,0 +1,174 @@
+/*****************************************************************************
+* File Name        : sim_cm55.c
+*
+* Description      : CM55 client of the POSIX simulation. Runs the wake-up
+*                    source check of proj_cm55 with its own copy of the
+*                    POWER_MANAGER API after every partition interrupt and
+*                    every wake-up of the CM55 LPTimer, as a second NS client
+*                    that calls through the NS mailbox.
+*
+* Related Document : See docs/host_simulation.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+
+#include "power_manager_defs.h"
+#include "cm55_wake.h"
+
+#include "sim.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+#define USEC_PER_MSEC       (1000ULL)
+
+/* Client ID the mailbox NS agent gives the CM55 calls */
+#define SIM_CM55_CLIENT_ID  (POWER_MANAGER_CM55_CLIENT_ID_MIN)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+static sim_cm55_stats_t cm55_stats;
+static uint64_t lptimer_period_us = 0U;
+static uint64_t lptimer_next_us = SIM_TIME_NEVER;
+
+/*******************************************************************************
+* Function Name: cm55_check
+********************************************************************************
+* Summary:
+*  Runs the wake-up source check of CM55 with the client ID of the mailbox.
+*  A CM55 held in reset by the CM33 idle policy misses the wake-up.
+*
+* Return:
+*  bool - false if CM55 is off
+*
+*******************************************************************************/
+static bool cm55_check(void)
+{
+    int32_t previous;
+
+    if (!sim_pdl_cm55_running())
+    {
+        cm55_stats.off_wakes++;
+        return false;
+    }
+
+    previous = sim_tfm_set_client_id(SIM_CM55_CLIENT_ID);
+
+    (void)cm55_wake_check();
+    (void)sim_tfm_set_client_id(previous);
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: sim_cm55_init
+********************************************************************************
+* Summary:
+*  Starts the CM55 client. It initializes its TF-M NS interface, as the CM55
+*  main() does before its scheduler starts.
+*
+* Parameters:
+*  wake_period_ms - period of the CM55 LPTimer wake-ups, 0 for none
+*
+* Return:
+*  bool - false if the NS interface cannot be initialized
+*
+*******************************************************************************/
+bool sim_cm55_init(uint32_t wake_period_ms)
+{
+    int32_t previous = sim_tfm_set_client_id(SIM_CM55_CLIENT_ID);
+    bool ok = cm55_wake_init();
+
+    (void)sim_tfm_set_client_id(previous);
+    if (!ok)
+    {
+        return false;
+    }
+
+    cm55_stats.enabled = true;
+    if (0U != wake_period_ms)
+    {
+        lptimer_period_us = (uint64_t)wake_period_ms * USEC_PER_MSEC;
+        lptimer_next_us = lptimer_period_us;
+    }
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: sim_cm55_run_due
+********************************************************************************
+* Summary:
+*  Runs the checks of the CM55 LPTimer wake-ups due by the given time. The
+*  CM55 timeline does not advance the CM33 one, so the checks run when the
+*  CM33 timeline reaches them, before the next partition interrupt.
+*
+* Parameters:
+*  now_us - virtual time
+*
+*******************************************************************************/
+void sim_cm55_run_due(uint64_t now_us)
+{
+    while (lptimer_next_us <= now_us)
+    {
+        if (cm55_check())
+        {
+            cm55_stats.lptimer_wakes++;
+        }
+        lptimer_next_us += lptimer_period_us;
+    }
+}
+
+/*******************************************************************************
+* Function Name: sim_cm55_event
+********************************************************************************
+* Summary:
+*  Runs the check of CM55 for a partition interrupt, which wakes CM55 too.
+*
+*******************************************************************************/
+void sim_cm55_event(void)
+{
+    if (cm55_stats.enabled)
+    {
+        if (cm55_check())
+        {
+            cm55_stats.event_wakes++;
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: sim_cm55_get_stats
+********************************************************************************
+* Summary:
+*  Returns the wake-ups of the CM55 client.
+*
+*******************************************************************************/
+void sim_cm55_get_stats(sim_cm55_stats_t *stats)
+{
+    *stats = cm55_stats;
+}
+
+/* [] END OF FILE */
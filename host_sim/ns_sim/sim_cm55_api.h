@@ -0,0 +1,54 @@
+/*****************************************************************************
+* File Name        : sim_cm55_api.h
+*
+* Description      : Renames the POWER_MANAGER API for the CM55 client of the
+*                    POSIX simulation. The Makefile includes it in the second
+*                    build of power_manager_api.c and in the CM55 sources, so
+*                    that CM55 has its own NS side cache next to the one of
+*                    the CM33 non-secure application, as on the device.
+*
+* Related Document : See docs/host_simulation.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+#ifndef SIM_CM55_API_H
+#define SIM_CM55_API_H
+
+#define power_manager_set_cache_enabled      cm55_power_manager_set_cache_enabled
+#define power_manager_get_cache_stats        cm55_power_manager_get_cache_stats
+#define power_manager_get_state_gen          cm55_power_manager_get_state_gen
+#define power_manager_set_call_hooks         cm55_power_manager_set_call_hooks
+#define power_manager_clr_wakeup_src         cm55_power_manager_clr_wakeup_src
+#define power_manager_get_wakeup_src         cm55_power_manager_get_wakeup_src
+#define power_manager_get_wakeup_info        cm55_power_manager_get_wakeup_info
+#define power_manager_take_wakeup_info       cm55_power_manager_take_wakeup_info
+#define power_manager_get_rate_limit         cm55_power_manager_get_rate_limit
+#define power_manager_wake_at                cm55_power_manager_wake_at
+#define power_manager_wake_after             cm55_power_manager_wake_after
+#define power_manager_wake_cancel            cm55_power_manager_wake_cancel
+#define power_manager_batch                  cm55_power_manager_batch
+#define power_manager_record_deepsleep       cm55_power_manager_record_deepsleep
+#define power_manager_record_latency         cm55_power_manager_record_latency
+#define power_manager_flush_telemetry        cm55_power_manager_flush_telemetry
+#define power_manager_get_telemetry          cm55_power_manager_get_telemetry
+#define power_manager_get_log_tx             cm55_power_manager_get_log_tx
+
+#endif /* SIM_CM55_API_H */
+
+/* [] END OF FILE */
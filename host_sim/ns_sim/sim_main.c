@@ -0,0 +1,1083 @@
+/*****************************************************************************
+* File Name        : sim_main.c
+*
+* Description      : Entry point of the POSIX simulation of the CM33 non-secure
+*                    application. Parses the simulation options, runs the secure
+*                    partition initialization and the real main() of proj_cm33_ns
+*                    (built as cm33_ns_main) and prints the wake, residency and
+*                    secure call report when the simulation ends. The exit
+*                    status is 1 when the secure call budget was exceeded or
+*                    the wake path lost or duplicated a wake-up event.
+*
+* Related Document : See docs/host_simulation.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "perf_governor.h"
+#include "cm55_power.h"
+#include "wake_monitor.h"
+#include "spe_profiler.h"
+#include "tickless_idle.h"
+#include "deferred_work.h"
+#include "log_transport.h"
+#include "hibernate.h"
+#include "pd_manager.h"
+#include "sram_retention.h"
+#include "wake_resume.h"
+#include "power_event.h"
+#include "cm55_wake.h"
+#include "wake_recorder.h"
+#include "retention_map.h"
+#include "power_manager_api.h"
+#include "sim.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+#define USEC_PER_SEC                (1000000ULL)
+#define USEC_PER_MSEC               (1000ULL)
+
+#define SIM_DURATION_S_DEFAULT      (300U)
+#define SIM_WAKE_PERIOD_MS_DEFAULT  (60000U)
+
+/* Repetitions of the GPIO demultiplexing measurement, the fastest counts */
+#define SIM_DEMUX_REPEAT            (5U)
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+/* main() of proj_cm33_ns/main.c, renamed by the build */
+int cm33_ns_main(void);
+
+static void on_timer_wake(const power_event_t *event, void *arg);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+static struct timespec wall_start;
+static uint32_t cycles_requested = 0U;
+static sim_psa_budget_t psa_budget = { 0U, 0U };
+static FILE *psa_trace = NULL;
+
+/* Power event subscriber that takes the timed wake-ups only */
+static power_event_sub_t timer_wake_sub =
+{
+    .type_mask = POWER_EVENT_MASK(POWER_EVENT_WAKE),
+    .source_mask = WAKEUP_SOURCE_TIMER,
+    .priority = 255U,
+    .task = NULL,
+    .callback = on_timer_wake,
+    .arg = NULL
+};
+static uint32_t timer_wake_events = 0U;
+static uint32_t timer_wake_mismatches = 0U;
+
+/* Timeline replayed (-R) and timeline written (-W) */
+static const char *replay_path = NULL;
+static wake_recorder_summary_t replay_recorded;
+static FILE *record_file = NULL;
+
+/*******************************************************************************
+* Function Name: usage
+********************************************************************************
+* Summary:
+*  Prints the command line options.
+*
+*******************************************************************************/
+static void usage(const char *prog)
+{
+    fprintf(stderr,
+        "usage: %s [-d seconds] [-n cycles] [-p period_ms] [-f first_ms]\n"
+        "       [-r mean_ms] [-s seed] [-b cm55_boot_us] [-k call_cost_us]\n"
+        "       [-C calls] [-B bytes] [-T trace.csv] [-u burst_len]\n"
+        "       [-g burst_gap_us] [-G runs] [-I its_file] [-H hib_file]\n"
+        "       [-X xip_resume_us] [-M cm55_wake_ms] [-R timeline]\n"
+        "       [-W timeline] [-L] [-q]\n"
+        "  -d  simulated time (default %u s)\n"
+        "  -n  end after this many sleep cycles (DeepSleep exits)\n"
+        "  -p  USER BTN1 press period, 0 = off (default %u ms)\n"
+        "  -f  time of the first periodic press (default one period)\n"
+        "  -r  mean interval of random presses, 0 = off (default off)\n"
+        "  -s  seed of the random presses (default 1)\n"
+        "  -u  interrupts per press (default 1)\n"
+        "  -g  time between the interrupts of a press (default 0 us)\n"
+        "  -b  CM55 boot time (default %u us)\n"
+        "  -k  fixed cost of a secure call (default %u us)\n"
+        "  -C  budget of secure calls per sleep cycle\n"
+        "  -B  budget of secure call vector bytes per sleep cycle\n"
+        "  -T  write every secure call to a CSV file\n"
+        "  -G  measure the secure GPIO interrupt with 1, 2 and 8 pins\n"
+        "      pending over this many interrupts and exit\n"
+        "  -I  keep the Internal Trusted Storage in a file across runs\n"
+        "  -H  end the run at a Hibernate entry and resume the next run\n"
+        "      with this file from the Hibernate wake-up\n"
+        "  -X  time until the external flash resumes from DeepSleep\n"
+        "      (default %u us)\n"
+        "  -M  run the CM55 client: it checks the wake-up sources after\n"
+        "      every partition interrupt and every CM55 LPTimer wake-up\n"
+        "      this many ms apart, 0 = interrupts only\n"
+        "  -R  replay the button wake-ups of a wake recorder timeline and\n"
+        "      compare the run with it; the defaults change to -p 0 and\n"
+        "      -d up to its last record\n"
+        "  -W  write the wake recorder timeline of the run to a file\n"
+        "  -L  tickless idle with LPTimer counter 0 alone, no cascade\n"
+        "  -q  do not print the application log\n"
+        "exit status: 0 ok, 1 secure call budget exceeded, wake-up events\n"
+        "             lost or duplicated or a CM55 wake-up without event\n"
+        "             that needed a secure call, 2 usage error\n",
+        prog, SIM_DURATION_S_DEFAULT, SIM_WAKE_PERIOD_MS_DEFAULT,
+        SIM_CM55_BOOT_US_DEFAULT, SIM_PSA_CALL_BASE_US_DEFAULT,
+        SIM_XIP_RESUME_US_DEFAULT);
+}
+
+/*******************************************************************************
+* Function Name: parse_u32
+********************************************************************************
+* Summary:
+*  Parses an unsigned decimal option value.
+*
+* Return:
+*  int - 0 on success, -1 on an invalid value
+*
+*******************************************************************************/
+static int parse_u32(const char *text, uint32_t *value)
+{
+    char *end;
+    unsigned long v = strtoul(text, &end, 10);
+
+    if ((end == text) || ('\0' != *end) || (v > UINT32_MAX))
+    {
+        return -1;
+    }
+    *value = (uint32_t)v;
+    return 0;
+}
+
+/*******************************************************************************
+* Function Name: print_time
+********************************************************************************
+* Summary:
+*  Prints a report line with a duration and its share of the simulated time.
+*
+*******************************************************************************/
+static void print_time(const char *name, uint64_t us, uint64_t total_us)
+{
+    printf("  %-12s %10lu.%03lu s  %5.1f %%\n", name,
+           (unsigned long)(us / USEC_PER_SEC),
+           (unsigned long)((us / USEC_PER_MSEC) % 1000U),
+           (0U != total_us) ? (100.0 * (double)us / (double)total_us) : 0.0);
+}
+
+/*******************************************************************************
+* Function Name: hibernate_cause_name
+********************************************************************************
+* Summary:
+*  Returns the name of a Hibernate wake-up cause.
+*
+*******************************************************************************/
+static const char *hibernate_cause_name(uint32_t cause)
+{
+    if (0U != (cause & (uint32_t)CY_SYSPM_HIBERNATE_RTC_ALARM))
+    {
+        return "RTC alarm";
+    }
+    return (0U != cause) ? "wake-up pin" : "unknown cause";
+}
+
+/*******************************************************************************
+* Function Name: report_psa_calls
+********************************************************************************
+* Summary:
+*  Prints the secure call statistics and checks them against the budget.
+*
+* Return:
+*  bool - true if the budget was kept
+*
+*******************************************************************************/
+static bool report_psa_calls(void)
+{
+    sim_psa_stats_t psa;
+    power_manager_cache_stats_t cache;
+    uint32_t i;
+    bool ok = true;
+
+    sim_tfm_get_psa_stats(&psa);
+    power_manager_get_cache_stats(&cache);
+
+    printf("secure calls   : %lu calls, %llu bytes, %llu us in %lu cycles\n",
+           (unsigned long)psa.calls, (unsigned long long)psa.bytes,
+           (unsigned long long)psa.cost_us, (unsigned long)psa.cycles);
+    printf("  %-10s %6s %10s %12s %12s %10s\n",
+           "sid", "type", "calls", "in bytes", "out bytes", "cost us");
+    for (i = 0U; i < psa.op_count; i++)
+    {
+        printf("  0x%08lx %6ld %10lu %12llu %12llu %10llu\n",
+               (unsigned long)psa.ops[i].sid, (long)psa.ops[i].type,
+               (unsigned long)psa.ops[i].calls,
+               (unsigned long long)psa.ops[i].in_bytes,
+               (unsigned long long)psa.ops[i].out_bytes,
+               (unsigned long long)psa.ops[i].cost_us);
+    }
+    printf("  start-up     : %lu calls, %lu bytes before the scheduler\n",
+           (unsigned long)psa.startup_calls, (unsigned long)psa.startup_bytes);
+    if (0U != psa.cycles)
+    {
+        printf("  per cycle    : max %lu calls, max %lu bytes, max %lu us, "
+               "mean %.1f calls\n",
+               (unsigned long)psa.max_cycle_calls,
+               (unsigned long)psa.max_cycle_bytes,
+               (unsigned long)psa.max_cycle_cost_us,
+               (double)(psa.calls - psa.startup_calls - psa.log_calls) /
+               (double)psa.cycles);
+    }
+    printf("  NS cache     : %lu hits, %lu misses (%.1f %% hit rate)\n",
+           (unsigned long)cache.hits, (unsigned long)cache.misses,
+           (0U != (cache.hits + cache.misses)) ?
+           (100.0 * (double)cache.hits / (double)(cache.hits + cache.misses)) : 0.0);
+
+    if ((0U != psa_budget.max_calls) || (0U != psa_budget.max_bytes))
+    {
+        printf("  budget       : %lu calls, %lu bytes per cycle\n",
+               (unsigned long)psa_budget.max_calls,
+               (unsigned long)psa_budget.max_bytes);
+        if (0U != psa.over_budget_cycles)
+        {
+            printf("  FAIL: %lu cycles over budget, first: cycle %lu\n",
+                   (unsigned long)psa.over_budget_cycles,
+                   (unsigned long)psa.first_over_budget_cycle);
+            ok = false;
+        }
+        if (psa.cycles < cycles_requested)
+        {
+            printf("  FAIL: only %lu of %lu cycles simulated\n",
+                   (unsigned long)psa.cycles, (unsigned long)cycles_requested);
+            ok = false;
+        }
+        if (ok)
+        {
+            printf("  PASS\n");
+        }
+    }
+
+    return ok;
+}
+
+/*******************************************************************************
+* Function Name: report_wake_path
+********************************************************************************
+* Summary:
+*  Prints the wake path statistics of the application and checks that every
+*  wake-up interrupt that reached the partition was either counted once or
+*  dropped by the rate limiter, and that the application saw every counted
+*  event. Interrupts while the pin is masked never reach the partition.
+*  Events after the last DeepSleep exit are not seen yet and do not count as
+*  lost.
+*
+* Return:
+*  bool - true if no event was lost or duplicated
+*
+*******************************************************************************/
+static bool report_wake_path(void)
+{
+    wake_monitor_stats_t wake;
+    wake_resume_stats_t resume;
+    sim_xip_stats_t xip;
+    power_manager_wakeup_info_t info = { 0U, 0U };
+    power_manager_rate_limit_t rate_limit = { 0U, 0U, 0U, 0U };
+    uint32_t injected = sim_wake_get_count();
+    uint32_t delivered = sim_wake_get_delivered();
+    uint32_t lost;
+    bool ok = true;
+
+    wake_monitor_get_stats(&wake);
+    wake_resume_get_stats(&resume);
+    sim_pdl_get_xip_stats(&xip);
+    (void)power_manager_get_wakeup_info(&info);
+    (void)power_manager_get_rate_limit(WAKEUP_SOURCE_USER_BTN1, &rate_limit);
+    lost = delivered - info.event_seq - rate_limit.throttled_events;
+
+    printf("wake path      : %lu interrupts, %lu counted by the partition, "
+           "%lu seen by the application\n",
+           (unsigned long)injected, (unsigned long)info.event_seq,
+           (unsigned long)wake.events);
+    printf("  rate limit   : %lu dropped, %lu masked by the partition "
+           "(%lu masks, %s, next backoff %lu s)\n",
+           (unsigned long)rate_limit.throttled_events,
+           (unsigned long)(injected - delivered),
+           (unsigned long)rate_limit.mask_count,
+           (0U != rate_limit.masked) ? "masked" : "unmasked",
+           (unsigned long)rate_limit.backoff_s);
+    printf("  wakes        : %lu DeepSleep exits and aborts, %lu task wakes, "
+           "%lu by secure timer, %lu spurious\n",
+           (unsigned long)wake.wakes, (unsigned long)wake.task_wakes,
+           (unsigned long)wake.timer_wakes,
+           (unsigned long)wake.spurious_wakes);
+    printf("  sleep entry  : %lu aborted for a pending event (%lu us in "
+           "callbacks), %lu wasted DeepSleep periods (%lu us)\n",
+           (unsigned long)wake.aborts, (unsigned long)wake.abort_us,
+           (unsigned long)wake.wasted_sleeps,
+           (unsigned long)wake.wasted_us);
+    printf("  coalesced    : %lu events, %lu task notifications\n",
+           (unsigned long)wake.events_coalesced,
+           (unsigned long)wake.notify_collapsed);
+    printf("  latency      : p50 %lu us, p99 %lu us, max %lu us "
+           "(%lu samples)\n",
+           (unsigned long)wake_monitor_latency_percentile_us(500U),
+           (unsigned long)wake_monitor_latency_percentile_us(990U),
+           (unsigned long)wake.latency_max_us,
+           (unsigned long)wake.latency_samples);
+    printf("  resume       : wake path in %s, first callback %lu us after the "
+           "wake-up (max %lu us), %lu us flash stall per exit, %lu of %lu "
+           "exits behind a secure handler\n",
+           resume.in_ram ? "RAM" : "external flash",
+           (unsigned long)((0U != xip.exits) ? (xip.first_us / xip.exits) : 0U),
+           (unsigned long)xip.first_max_us,
+           (unsigned long)((0U != xip.exits) ? (xip.stall_us / xip.exits) : 0U),
+           (unsigned long)xip.secure_wakes, (unsigned long)xip.exits);
+    printf("  resume timer : %lu us from the last entry to the first exit "
+           "callback (max %lu us, %lu exits)\n",
+           (unsigned long)((0U != resume.resumes) ?
+                           (resume.total_us / resume.resumes) : 0U),
+           (unsigned long)resume.max_us, (unsigned long)resume.resumes);
+
+    if (0U != lost)
+    {
+        printf("  FAIL: %lu interrupts lost in the partition\n",
+               (unsigned long)lost);
+        ok = false;
+    }
+    if ((wake.events != wake.last_seq) || (0U != wake.seq_regressions))
+    {
+        printf("  FAIL: application event count %lu does not match "
+               "sequence number %lu (%lu regressions)\n",
+               (unsigned long)wake.events, (unsigned long)wake.last_seq,
+               (unsigned long)wake.seq_regressions);
+        ok = false;
+    }
+    if (0U != wake.duplicate_wakes)
+    {
+        printf("  FAIL: %lu wakes reported an event twice\n",
+               (unsigned long)wake.duplicate_wakes);
+        ok = false;
+    }
+
+    return ok;
+}
+
+/*******************************************************************************
+* Function Name: on_timer_wake
+********************************************************************************
+* Summary:
+*  Callback of the timed wake-up subscriber. Counts the records and those
+*  that do not pass its filter.
+*
+*******************************************************************************/
+static void on_timer_wake(const power_event_t *event, void *arg)
+{
+    (void)arg;
+    timer_wake_events++;
+    if ((POWER_EVENT_WAKE != event->type) ||
+        (0U == (event->sources & WAKEUP_SOURCE_TIMER)))
+    {
+        timer_wake_mismatches++;
+    }
+}
+
+/*******************************************************************************
+* Function Name: report_power_events
+********************************************************************************
+* Summary:
+*  Prints the events of the power event bus. Fails if a subscriber lost a
+*  record, or if the timed wake-up subscriber was served a record outside its
+*  filter or missed one the wake path monitor counted.
+*
+*******************************************************************************/
+static bool report_power_events(void)
+{
+    power_event_stats_t bus;
+    wake_monitor_stats_t wake;
+
+    power_event_get_stats(&bus);
+    wake_monitor_get_stats(&wake);
+
+    printf("power events   : %lu DeepSleep entries, %lu wakes, %lu state changes, "
+           "%lu deliveries, %lu subscribers passed over, %lu records lost\n",
+           (unsigned long)bus.published[POWER_EVENT_SLEEP_ENTRY],
+           (unsigned long)bus.published[POWER_EVENT_WAKE],
+           (unsigned long)bus.published[POWER_EVENT_APP_STATE],
+           (unsigned long)bus.delivered, (unsigned long)bus.filtered,
+           (unsigned long)bus.lost);
+    printf("  timer filter : %lu of %lu wakes delivered, %lu by secure timer\n",
+           (unsigned long)timer_wake_events,
+           (unsigned long)bus.published[POWER_EVENT_WAKE],
+           (unsigned long)wake.timer_wakes);
+    if ((0U != bus.lost) || (0U != timer_wake_mismatches) ||
+        (timer_wake_events != wake.timer_wakes))
+    {
+        printf("  FAIL: %lu records lost, %lu delivered outside the filter\n",
+               (unsigned long)bus.lost, (unsigned long)timer_wake_mismatches);
+        return false;
+    }
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: report_demux
+********************************************************************************
+* Summary:
+*  Prints the host time of the secure GPIO interrupt with edges on 1, 2 and 8
+*  pins of the USER BTN1 port.
+*
+* Parameters:
+*  runs - interrupts per measurement
+*
+*******************************************************************************/
+static void report_demux(uint32_t runs)
+{
+    static const uint32_t pin_counts[] = { 1U, 2U, 8U };
+    uint64_t best_ns;
+    uint64_t ns;
+    uint32_t i;
+    uint32_t repeat;
+
+    printf("GPIO demux     : best of %u runs of %lu interrupts\n",
+           SIM_DEMUX_REPEAT, (unsigned long)runs);
+    for (i = 0U; i < (sizeof(pin_counts) / sizeof(pin_counts[0])); i++)
+    {
+        best_ns = UINT64_MAX;
+        for (repeat = 0U; repeat < SIM_DEMUX_REPEAT; repeat++)
+        {
+            ns = sim_wake_bench_demux(pin_counts[i], runs);
+            if (ns < best_ns)
+            {
+                best_ns = ns;
+            }
+        }
+        printf("  %lu pins       : %llu ns per interrupt (host)\n",
+               (unsigned long)pin_counts[i], (unsigned long long)best_ns);
+    }
+}
+
+/*******************************************************************************
+* Function Name: report_spe_residency
+********************************************************************************
+* Summary:
+*  Prints the SPE residency per cause as measured by the application and the
+*  worst NS interrupt blackout.
+*
+*******************************************************************************/
+static void report_spe_residency(void)
+{
+    spe_profiler_stats_t stats;
+    spe_profiler_service_t service;
+    uint32_t worst_us;
+
+    printf("SPE residency  :    count     mean us      p50 us      p99 us      max us\n");
+    for (service = SPE_PROFILER_POWER_MANAGER; service < SPE_PROFILER_SERVICE_COUNT;
+         service++)
+    {
+        spe_profiler_get_stats(service, &stats);
+        printf("  %-13s%9lu %11lu %11lu %11lu %11lu\n",
+               spe_profiler_service_name(service), (unsigned long)stats.count,
+               (unsigned long)((0U != stats.count) ? (stats.total_us / stats.count) : 0U),
+               (unsigned long)spe_profiler_percentile_us(service, 500U),
+               (unsigned long)spe_profiler_percentile_us(service, 990U),
+               (unsigned long)stats.max_us);
+    }
+    worst_us = spe_profiler_worst_blackout_us(&service);
+    printf("  worst NS interrupt blackout: %lu us (%s)\n", (unsigned long)worst_us,
+           spe_profiler_service_name(service));
+}
+
+/*******************************************************************************
+* Function Name: report_telemetry
+********************************************************************************
+* Summary:
+*  Prints the lifetime telemetry of the POWER_MANAGER partition and the
+*  writes to Internal Trusted Storage.
+*
+*******************************************************************************/
+static void report_telemetry(void)
+{
+    power_manager_telemetry_t telemetry;
+    sim_its_stats_t its;
+
+    sim_tfm_get_its_stats(&its);
+    if (PSA_SUCCESS != power_manager_get_telemetry(&telemetry))
+    {
+        memset(&telemetry, 0, sizeof(telemetry));
+    }
+
+    printf("telemetry      : %lu boots, %lu button and %lu timer wake "
+           "events, %lu throttled\n",
+           (unsigned long)telemetry.boots,
+           (unsigned long)(telemetry.wake_events[0] + telemetry.wake_events[2]),
+           (unsigned long)telemetry.wake_events[1],
+           (unsigned long)telemetry.throttled_events);
+    printf("  lifetime     : %lu s DeepSleep, worst wake latency %lu us\n",
+           (unsigned long)telemetry.deepsleep_s,
+           (unsigned long)telemetry.worst_latency_us);
+    printf("  ITS          : %lu writes this run, %llu bytes, %lu lifetime\n",
+           (unsigned long)its.writes, (unsigned long long)its.bytes,
+           (unsigned long)telemetry.its_writes);
+}
+
+/*******************************************************************************
+* Function Name: report_hibernate
+********************************************************************************
+* Summary:
+*  Prints the start-up time measured by the application, the Hibernate
+*  wake-up that started the run and the Hibernate entry that ended it.
+*
+*******************************************************************************/
+static void report_hibernate(void)
+{
+    hibernate_stats_t startup;
+    sim_hibernate_stats_t hibernate;
+
+    hibernate_get_stats(&startup);
+    sim_pdl_get_hibernate_stats(&hibernate);
+
+    printf("start-up       : %lu us from main() to the first task, %s\n",
+           (unsigned long)startup.startup_us,
+           startup.resumed ? "snapshot restored" : "cold boot");
+    if (hibernate.resumed)
+    {
+        printf("  resumed      : Hibernate wake-up by %s\n",
+               hibernate_cause_name(hibernate.resume_cause));
+    }
+    if (!hibernate.entered)
+    {
+        return;
+    }
+    if (SIM_TIME_NEVER == hibernate.hibernate_us)
+    {
+        printf("hibernate      : entered at %lu.%03lu s, no wake-up source armed\n",
+               (unsigned long)(hibernate.entry_us / USEC_PER_SEC),
+               (unsigned long)((hibernate.entry_us / USEC_PER_MSEC) % 1000U));
+    }
+    else
+    {
+        printf("hibernate      : entered at %lu.%03lu s, wake-up by %s after %lu s\n",
+               (unsigned long)(hibernate.entry_us / USEC_PER_SEC),
+               (unsigned long)((hibernate.entry_us / USEC_PER_MSEC) % 1000U),
+               hibernate_cause_name(hibernate.wakeup_cause),
+               (unsigned long)(hibernate.hibernate_us / USEC_PER_SEC));
+    }
+}
+
+/*******************************************************************************
+* Function Name: report_sram_retention
+********************************************************************************
+* Summary:
+*  Prints the SRAM macros the application powers down in DeepSleep and, if
+*  the SRAM is characterized, the retention current it saves, and how often
+*  their power domain was dropped and restored. Fails if a macro with live
+*  data was off after a DeepSleep exit or if a DeepSleep entry kept a macro
+*  on that the application powers down.
+*
+*******************************************************************************/
+static bool report_sram_retention(void)
+{
+    sram_retention_stats_t app;
+    sim_sram_stats_t sim;
+    pd_domain_stats_t domain;
+    uint32_t macros = retention_map_sram.macro_count;
+
+    sram_retention_get_stats(&app);
+    sim_pdl_get_sram_stats(&sim);
+    (void)pd_manager_get_stats(PD_DOMAIN_SRAM_SPARE, &domain);
+
+    printf("SRAM retention : %lu of %lu macros (%lu of %lu KB) off in %lu "
+           "DeepSleep entries",
+           (unsigned long)retention_map_count(app.off_mask),
+           (unsigned long)macros,
+           (unsigned long)app.off_kb,
+           (unsigned long)(app.off_kb + app.retained_kb),
+           (unsigned long)sim.deepsleeps);
+    if (0U != app.saved_na)
+    {
+        printf(", %lu of %lu nA retention current saved",
+               (unsigned long)app.saved_na,
+               (unsigned long)(app.saved_na + app.retained_na));
+    }
+    printf("\n");
+    printf("  spare domain : %lu DeepSleep drops, %lu restores\n",
+           (unsigned long)domain.deepsleep_drops,
+           (unsigned long)domain.lazy_restores);
+    if ((0U != (sim.off_after_exit & app.keep_mask)) ||
+        ((0U != sim.deepsleeps) && (sim.off_mask != app.off_mask)))
+    {
+        printf("  ERROR        : macros 0x%04lx with live data off after a "
+               "DeepSleep exit, last entry with mask 0x%04lx instead of 0x%04lx\n",
+               (unsigned long)(sim.off_after_exit & app.keep_mask),
+               (unsigned long)sim.off_mask, (unsigned long)app.off_mask);
+        return false;
+    }
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: report_cm55_client
+********************************************************************************
+* Summary:
+*  Prints the wake-up checks of the CM55 client and its secure calls through
+*  the mailbox. Fails if a check failed, or if a CM55 wake-up without a
+*  partition interrupt needed a secure call: only the first check and those
+*  after an interrupt may miss the NS side cache, or if CM55 missed wake-ups
+*  because the idle policy held it off.
+*  Silent unless the client runs (-M).
+*
+* Parameters:
+*  total_us - length of the run
+*
+*******************************************************************************/
+static bool report_cm55_client(uint64_t total_us)
+{
+    sim_cm55_stats_t sim;
+    cm55_wake_stats_t app;
+    uint32_t mailbox_calls;
+
+    sim_cm55_run_due(total_us);
+    sim_cm55_get_stats(&sim);
+    if (!sim.enabled)
+    {
+        return true;
+    }
+    cm55_wake_get_stats(&app);
+    mailbox_calls = sim_tfm_get_mailbox_calls();
+
+    printf("CM55 client    : %lu checks (%lu LPTimer, %lu interrupt wake-ups), "
+           "%lu secure calls through the mailbox\n",
+           (unsigned long)app.checks, (unsigned long)sim.lptimer_wakes,
+           (unsigned long)sim.event_wakes, (unsigned long)mailbox_calls);
+    printf("  CM55 off     : %lu wake-ups missed\n", (unsigned long)sim.off_wakes);
+    printf("  wake-ups     : %lu partition events, %lu by secure timer, "
+           "sources 0x%02lx\n",
+           (unsigned long)app.events, (unsigned long)app.timer_wakes,
+           (unsigned long)app.sources);
+    if (0U != sim.off_wakes)
+    {
+        printf("  FAIL: CM55 was off, build the application with "
+               "APP_CM55_POWER_MANAGER=1\n");
+        return false;
+    }
+    if ((0U != app.failed) || (app.secure_calls != mailbox_calls) ||
+        (mailbox_calls > (sim.event_wakes + 1U)))
+    {
+        printf("  FAIL: %lu checks failed, %lu secure calls for %lu interrupt "
+               "wake-ups\n", (unsigned long)app.failed,
+               (unsigned long)mailbox_calls, (unsigned long)sim.event_wakes);
+        return false;
+    }
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: print_replay_row
+********************************************************************************
+* Summary:
+*  Prints a line of the replay comparison: the recorded and the replayed
+*  value and their difference, or only the recorded one.
+*
+*******************************************************************************/
+static void print_replay_row(const char *name, uint64_t recorded,
+                             uint64_t replayed, bool have_replayed)
+{
+    if (!have_replayed)
+    {
+        printf("  %-18s %10llu\n", name, (unsigned long long)recorded);
+        return;
+    }
+    printf("  %-18s %10llu %10llu %+10lld\n", name, (unsigned long long)recorded,
+           (unsigned long long)replayed, (long long)(replayed - recorded));
+}
+
+/*******************************************************************************
+* Function Name: report_replay
+********************************************************************************
+* Summary:
+*  Compares the replayed timeline with the wake recorder of this run, and
+*  writes the timeline of the run. The application must be built with
+*  APP_WAKE_RECORDER for the replayed column and for -W. Silent unless -R or
+*  -W is given.
+*
+*******************************************************************************/
+static void report_replay(void)
+{
+    wake_recorder_summary_t run;
+    wake_recorder_reader_t reader;
+    char line[WAKE_RECORDER_LINE_SIZE];
+    bool recorded;
+
+    recorded = wake_recorder_get_summary(&run);
+    if (NULL != record_file)
+    {
+        memset(&reader, 0, sizeof(reader));
+        while (wake_recorder_read_line(&reader, line, sizeof(line)))
+        {
+            fprintf(record_file, "%s\n", line);
+        }
+        fclose(record_file);
+        printf("timeline       : %lu records written, %lu lost\n",
+               (unsigned long)reader.summary.records,
+               (unsigned long)reader.summary.lost);
+    }
+    if (NULL == replay_path)
+    {
+        return;
+    }
+
+    printf("replay         : %lu records of %s, %lu lost on the device, "
+           "%lu button presses replayed\n",
+           (unsigned long)replay_recorded.records, replay_path,
+           (unsigned long)replay_recorded.lost,
+           (unsigned long)sim_wake_get_count());
+    if (recorded)
+    {
+        printf("  %-18s %10s %10s %10s\n", "", "recorded", "replayed", "change");
+    }
+    else
+    {
+        printf("  no replayed column: build with APP_WAKE_RECORDER=1\n");
+    }
+    print_replay_row("button wakes", replay_recorded.button_wakes,
+                     run.button_wakes, recorded);
+    print_replay_row("timer wakes", replay_recorded.timer_wakes,
+                     run.timer_wakes, recorded);
+    print_replay_row("other wakes", replay_recorded.other_wakes,
+                     run.other_wakes, recorded);
+    print_replay_row("DeepSleep entries", replay_recorded.sleeps,
+                     run.sleeps, recorded);
+    print_replay_row("aborted entries", replay_recorded.aborts,
+                     run.aborts, recorded);
+    print_replay_row("DeepSleep ms", replay_recorded.sleep_ms,
+                     run.sleep_ms, recorded);
+    print_replay_row("state cycles", replay_recorded.cycles,
+                     run.cycles, recorded);
+    print_replay_row("cycle energy uJ", replay_recorded.energy_uj,
+                     run.energy_uj, recorded);
+}
+
+/*******************************************************************************
+* Function Name: sim_finish
+********************************************************************************
+* Summary:
+*  Prints the report and ends the process. Called by the idle task once the
+*  simulated time has elapsed or the requested sleep cycles are complete.
+*
+*******************************************************************************/
+void sim_finish(void)
+{
+    struct timespec wall_end;
+    sim_power_stats_t power;
+    perf_governor_stats_t perf;
+    cm55_power_stats_t cm55;
+    tickless_idle_stats_t tickless;
+    deferred_work_stats_t deferred;
+    log_transport_stats_t log;
+    bool ok;
+    uint64_t total_us = sim_time_us();
+    uint64_t perf_total_us = 0U;
+    double wall_s;
+    perf_mode_t mode;
+
+    clock_gettime(CLOCK_MONOTONIC, &wall_end);
+    wall_s = (double)(wall_end.tv_sec - wall_start.tv_sec) +
+             ((double)(wall_end.tv_nsec - wall_start.tv_nsec) / 1e9);
+
+    sim_rtos_get_stats(&power);
+    perf_governor_get_stats(&perf);
+    cm55_power_get_stats(&cm55);
+    tickless_idle_get_stats(&tickless);
+    deferred_work_get_stats(&deferred);
+    log_transport_get_stats(&log);
+
+    printf("\n==================== simulation report ====================\n");
+    printf("simulated time : %lu.%03lu s in %.2f s wall time (%.0fx)\n",
+           (unsigned long)(total_us / USEC_PER_SEC),
+           (unsigned long)((total_us / USEC_PER_MSEC) % 1000U), wall_s,
+           (wall_s > 0.0) ? ((double)total_us / 1e6 / wall_s) : 0.0);
+    printf("button presses : %lu\n", (unsigned long)sim_wake_get_count());
+    printf("DeepSleep      : %lu entries, %lu aborted\n",
+           (unsigned long)power.deepsleep_entries,
+           (unsigned long)power.deepsleep_aborts);
+    printf("CPU Sleep      : %lu entries\n",
+           (unsigned long)power.sleep_entries);
+    printf("tickless idle  : up to %lu ticks, %lu periods, %lu overflow wakes, "
+           "longest %lu ticks\n",
+           (unsigned long)tickless_idle_max_suppressible_ticks(),
+           (unsigned long)tickless.sleeps,
+           (unsigned long)tickless.overflow_wakes,
+           (unsigned long)tickless.longest_sleep_ticks);
+    printf("deferred work  : %lu jobs in %lu pre-sleep and %lu deadline batches "
+           "(%lu submitted, %lu coalesced, %lu rejected, max %lu per batch)\n",
+           (unsigned long)deferred.jobs_run,
+           (unsigned long)deferred.sleep_batches,
+           (unsigned long)deferred.deadline_batches,
+           (unsigned long)deferred.submitted,
+           (unsigned long)deferred.coalesced,
+           (unsigned long)deferred.rejected,
+           (unsigned long)deferred.max_batch);
+    printf("log transport  : %lu bytes in %lu secure calls of up to %lu bytes, "
+           "%lu UART state reads, max %lu bytes queued, %lu ticks waited for a full ring\n",
+           (unsigned long)log.bytes, (unsigned long)log.calls,
+           (unsigned long)LOG_TRANSPORT_BATCH_MAX,
+           (unsigned long)log.tx_queries,
+           (unsigned long)log.max_level,
+           (unsigned long)log.writer_waits);
+    printf("wakes          : %lu by wake event, %lu by timer\n",
+           (unsigned long)power.wakes_by_event,
+           (unsigned long)power.wakes_by_timer);
+    printf("residency\n");
+    print_time("Active", power.active_us, total_us);
+    print_time("CPU Sleep", power.sleep_us, total_us);
+    print_time("DeepSleep", power.deepsleep_us, total_us);
+
+    for (mode = PERF_MODE_ULP; mode < PERF_MODE_COUNT; mode++)
+    {
+        perf_total_us += (uint64_t)perf.residency_ticks[mode] * USEC_PER_MSEC;
+    }
+    printf("performance mode residency\n");
+    for (mode = PERF_MODE_COUNT; mode-- > PERF_MODE_ULP; )
+    {
+        print_time(perf_policy_mode_name(mode),
+                   (uint64_t)perf.residency_ticks[mode] * USEC_PER_MSEC,
+                   perf_total_us);
+    }
+    printf("CM55           : %lu cold starts, %lu power-offs\n",
+           (unsigned long)cm55.cold_start.count,
+           (unsigned long)cm55.off_count);
+    report_hibernate();
+    ok = report_sram_retention();
+    ok = report_psa_calls() && ok;
+    /* Before the wake path report, whose secure calls would be profiled */
+    report_spe_residency();
+    /* After the secure call report, as they make secure calls themselves */
+    ok = report_wake_path() && ok;
+    ok = report_power_events() && ok;
+    ok = report_cm55_client(total_us) && ok;
+    report_telemetry();
+    report_replay();
+
+    if (NULL != psa_trace)
+    {
+        fclose(psa_trace);
+    }
+    fflush(stdout);
+    exit(ok ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Configures the simulation and starts the non-secure application. The
+*  process ends in sim_finish().
+*
+*******************************************************************************/
+int main(int argc, char *argv[])
+{
+    sim_wake_config_t wake = {
+        .period_ms = SIM_WAKE_PERIOD_MS_DEFAULT,
+        .first_ms = 0U,
+        .random_mean_ms = 0U,
+        .seed = 1U,
+        .burst_len = 1U,
+        .burst_gap_us = 0U
+    };
+    uint32_t duration_s = SIM_DURATION_S_DEFAULT;
+    uint32_t cm55_boot_us = SIM_CM55_BOOT_US_DEFAULT;
+    uint32_t call_cost_us = SIM_PSA_CALL_BASE_US_DEFAULT;
+    uint32_t xip_resume_us = SIM_XIP_RESUME_US_DEFAULT;
+    const char *trace_path = NULL;
+    const char *its_file = NULL;
+    const char *hibernate_file = NULL;
+    const char *record_path = NULL;
+    uint32_t demux_runs = 0U;
+    uint32_t cm55_wake_ms = 0U;
+    bool cm55_client = false;
+    bool duration_set = false;
+    bool period_set = false;
+    uint64_t duration_us;
+    wake_recorder_summary_t record_summary;
+    bool quiet = false;
+    bool lptimer_single = false;
+    int rc = 0;
+    int i;
+
+    for (i = 1; (i < argc) && (0 == rc); i++)
+    {
+        if (0 == strcmp(argv[i], "-q"))
+        {
+            quiet = true;
+            continue;
+        }
+        if (0 == strcmp(argv[i], "-L"))
+        {
+            lptimer_single = true;
+            continue;
+        }
+        if (((i + 1) >= argc) || ('-' != argv[i][0]) || ('\0' != argv[i][2]))
+        {
+            rc = -1;
+            break;
+        }
+        switch (argv[i][1])
+        {
+            case 'd':
+                duration_set = true;
+                rc = parse_u32(argv[++i], &duration_s);
+                break;
+            case 'p':
+                period_set = true;
+                rc = parse_u32(argv[++i], &wake.period_ms);
+                break;
+            case 'f': rc = parse_u32(argv[++i], &wake.first_ms); break;
+            case 'r': rc = parse_u32(argv[++i], &wake.random_mean_ms); break;
+            case 's': rc = parse_u32(argv[++i], &wake.seed); break;
+            case 'u': rc = parse_u32(argv[++i], &wake.burst_len); break;
+            case 'g': rc = parse_u32(argv[++i], &wake.burst_gap_us); break;
+            case 'b': rc = parse_u32(argv[++i], &cm55_boot_us); break;
+            case 'n': rc = parse_u32(argv[++i], &cycles_requested); break;
+            case 'k': rc = parse_u32(argv[++i], &call_cost_us); break;
+            case 'C': rc = parse_u32(argv[++i], &psa_budget.max_calls); break;
+            case 'B': rc = parse_u32(argv[++i], &psa_budget.max_bytes); break;
+            case 'T': trace_path = argv[++i]; break;
+            case 'G': rc = parse_u32(argv[++i], &demux_runs); break;
+            case 'I': its_file = argv[++i]; break;
+            case 'H': hibernate_file = argv[++i]; break;
+            case 'X': rc = parse_u32(argv[++i], &xip_resume_us); break;
+            case 'M':
+                cm55_client = true;
+                rc = parse_u32(argv[++i], &cm55_wake_ms);
+                break;
+            case 'R': replay_path = argv[++i]; break;
+            case 'W': record_path = argv[++i]; break;
+            default: rc = -1; break;
+        }
+    }
+    if (0 != rc)
+    {
+        usage(argv[0]);
+        return 2;
+    }
+    if (NULL != trace_path)
+    {
+        psa_trace = fopen(trace_path, "w");
+        if (NULL == psa_trace)
+        {
+            perror(trace_path);
+            return 2;
+        }
+    }
+    if ((NULL != its_file) && !sim_tfm_set_its_file(its_file))
+    {
+        fprintf(stderr, "%s: not an ITS file of this build\n", its_file);
+        return 2;
+    }
+    if ((NULL != hibernate_file) && !sim_pdl_set_hibernate_file(hibernate_file))
+    {
+        fprintf(stderr, "%s: not a Hibernate file of this build\n", hibernate_file);
+        return 2;
+    }
+
+    duration_us = (uint64_t)duration_s * USEC_PER_SEC;
+    if (NULL != replay_path)
+    {
+        if (!sim_wake_load_timeline(replay_path, &replay_recorded))
+        {
+            return 2;
+        }
+        if (!period_set)
+        {
+            wake.period_ms = 0U;
+        }
+        if (!duration_set)
+        {
+            /* Up to and including the last record */
+            duration_us = ((uint64_t)replay_recorded.end_ms + 1U) * USEC_PER_MSEC;
+        }
+    }
+    if (NULL != record_path)
+    {
+        if (!wake_recorder_get_summary(&record_summary))
+        {
+            fprintf(stderr, "-W: build with APP_WAKE_RECORDER=1\n");
+            return 2;
+        }
+        record_file = fopen(record_path, "w");
+        if (NULL == record_file)
+        {
+            perror(record_path);
+            return 2;
+        }
+    }
+
+    sim_wake_init(&wake);
+    sim_rtos_init(duration_us, cycles_requested);
+    sim_pdl_set_cm55_boot_us(cm55_boot_us);
+    sim_pdl_set_lptimer_single(lptimer_single);
+    sim_pdl_set_xip_resume_us(xip_resume_us);
+    sim_tfm_set_quiet(quiet);
+    sim_tfm_set_call_cost(call_cost_us);
+    sim_tfm_set_budget(&psa_budget);
+    sim_tfm_set_trace(psa_trace);
+
+    clock_gettime(CLOCK_MONOTONIC, &wall_start);
+
+    /* Secure side first, as TF-M initializes its partitions before it starts
+     * the non-secure image */
+    sim_tfm_init();
+
+    if (0U != demux_runs)
+    {
+        report_demux(demux_runs);
+        return 0;
+    }
+
+    if (cm55_client && !sim_cm55_init(cm55_wake_ms))
+    {
+        fprintf(stderr, "CM55 client: no TF-M NS interface\n");
+        return 2;
+    }
+
+    power_event_subscribe(&timer_wake_sub);
+    (void)cm33_ns_main();
+
+    /* main() only returns if the scheduler could not be started */
+    return 1;
+}
+
+/* [] END OF FILE */
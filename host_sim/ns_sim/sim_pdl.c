@@ -0,0 +1,1306 @@
+/*****************************************************************************
+* File Name        : sim_pdl.c
+*
+* Description      : Host implementation of the PDL, BSP and HAL stand-ins used by
+*                    the POSIX simulation: GPIO, critical sections, busy waits, the
+*                    SysPm callback chain, system power modes, clocks, CM55 boot,
+*                    the LPTimer and the RTC with its alarms.
+*
+* Related Document : See docs/host_simulation.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+
+#include <stddef.h>
+#include <string.h>
+
+#include "cybsp.h"
+#include "cy_pdl.h"
+#include "cy_time.h"
+#include "cyabs_rtos.h"
+#include "cm55_boot_status.h"
+#include "psa_manifest/power_manager.h"
+#include "wake_path.h"
+
+#include "sim.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+#define USEC_PER_SEC                    (1000000ULL)
+
+/* LPTimer (MCWDT on CLK_LF) frequency */
+#define SIM_LPTIMER_HZ                  (32768ULL)
+
+/* CM55 cycles from CM55 main() to ready reported by the simulated CM55 */
+#define SIM_CM55_MAIN_TO_READY_CYCLES   (24000U)
+
+/* Hibernate wake-up sources that are pins */
+#define SIM_HIBERNATE_PINS              ((uint32_t)CY_SYSPM_HIBERNATE_PIN0_LOW | \
+                                         (uint32_t)CY_SYSPM_HIBERNATE_PIN1_LOW)
+
+/*******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+/* Backup domain state after a Hibernate wake-up, written to the file given
+ * with sim_pdl_set_hibernate_file() */
+typedef struct
+{
+    uint32_t breg[16U];
+    uint32_t rtc_s;             /* RTC time at the wake-up */
+    uint32_t wakeup_cause;
+} sim_hibernate_file_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+CoreDebug_Type sim_core_debug;
+SysTick_Type sim_systick;
+uint32_t SystemCoreClock = SIM_CLK_PATH0_HZ / 2U;
+
+GPIO_PRT_Type sim_gpio_prt[SIM_GPIO_PORT_COUNT];
+MCWDT_STRUCT_Type sim_mcwdt;
+NVIC_Type sim_nvic;
+MXCM55_Type sim_mxcm55;
+BACKUP_Type sim_backup;
+CySCB_Type sim_scb2;
+
+/* m33_m55_boot_status SRAM region of design.modus */
+uint32_t sim_boot_status_region[16];
+
+/* Counters 0 and 1 cascaded, as in design.modus */
+const cy_stc_mcwdt_config_t CYBSP_CM33_LPTIMER_0_config = {
+    .c0Match = 32768U,
+    .c0c1Cascade = true,
+    .c1c2Cascade = false
+};
+const mtb_hal_lptimer_configurator_t CYBSP_CM33_LPTIMER_0_hal_config =
+    { .configured = 1U };
+cy_stc_rtc_config_t CYBSP_RTC_config =
+{
+    .sec = 0U,
+    .min = 0U,
+    .hour = 0U,
+    .amPm = CY_RTC_AM,
+    .hrFormat = CY_RTC_24_HOURS,
+    .dayOfWeek = CY_RTC_THURSDAY,
+    .date = 1U,
+    .month = 1U,
+    .year = 26U
+};
+
+static DWT_Type sim_dwt_regs;
+static uint32_t clk_hf0_divider = (uint32_t)CY_SYSCLK_CLKHF_DIVIDE_BY_2;
+
+/* Registered SysPm callbacks, sorted by order */
+static cy_stc_syspm_callback_t *syspm_callbacks = NULL;
+
+/* CM55 boot state */
+static bool pd1_enabled = true;
+static bool cm55_booting = false;
+static uint64_t cm55_ready_at_us = 0U;
+static uint32_t cm55_boot_us = SIM_CM55_BOOT_US_DEFAULT;
+
+/* LPTimer MCWDT counters 0 and 1 forced uncascaded */
+static bool lptimer_single = false;
+
+/* RTC: seconds since 2000-01-01 at the virtual time rtc_set_us */
+static uint32_t rtc_base_s = 0U;
+static uint64_t rtc_set_us = 0U;
+static uint32_t rtc_intr = 0U;
+static uint32_t rtc_intr_mask = 0U;
+static uint64_t rtc_alarm_us[2] = { SIM_TIME_NEVER, SIM_TIME_NEVER };
+
+/* Reset reason of this run, Hibernate wake-up sources and cause */
+static uint32_t reset_reason = 0U;
+static uint32_t hibernate_sources = 0U;
+static uint32_t hibernate_cause = 0U;
+static const char *hibernate_path = NULL;
+static sim_hibernate_stats_t hibernate_stats;
+
+/* Powered down SRAM macros, one bit per macro of SRAM0 and SRAM1 */
+static uint32_t sram_off_mask = 0U;
+static sim_sram_stats_t sram_stats;
+
+/* External flash: instructions fetched through the SMIF before xip_ready_us
+ * wait for the flash to resume from DeepSleep */
+static uint32_t xip_resume_us = SIM_XIP_RESUME_US_DEFAULT;
+static uint64_t xip_ready_us = 0U;
+static sim_xip_stats_t xip_stats;
+
+/* Between the BEFORE_TRANSITION and AFTER_TRANSITION callbacks of DeepSleep,
+ * and whether a secure interrupt has woken the device in that time */
+static bool in_deepsleep = false;
+static bool secure_wake = false;
+
+/* Virtual time at which the last byte written to the UART of the platform
+ * log service has left it, in ns */
+static uint64_t uart_done_ns = 0U;
+
+/*******************************************************************************
+* Function Name: cm55_update
+********************************************************************************
+* Summary:
+*  Completes a pending CM55 boot once the boot time has elapsed. The
+*  simulated CM55 reports ready through the shared boot status record like
+*  proj_cm55/main.c does.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void cm55_update(void)
+{
+    if (cm55_booting && (sim_time_us() >= cm55_ready_at_us))
+    {
+        cm55_booting = false;
+        CM55_BOOT_STATUS.main_to_ready_cycles = SIM_CM55_MAIN_TO_READY_CYCLES;
+        CM55_BOOT_STATUS.boot_count++;
+        CM55_BOOT_STATUS.ready = CM55_BOOT_STATUS_READY;
+    }
+}
+
+/*******************************************************************************
+* Board, clocks and timers
+*******************************************************************************/
+
+cy_rslt_t cybsp_init(void)
+{
+    return CY_RSLT_SUCCESS;
+}
+
+void mtb_clib_support_init(mtb_hal_rtc_t *rtc)
+{
+    rtc->configured = 1U;
+}
+
+/*******************************************************************************
+* Function Name: rtc_date_to_s
+********************************************************************************
+* Summary:
+*  Converts an RTC date and time in 24 hour format to seconds since
+*  2000-01-01.
+*
+*******************************************************************************/
+static uint32_t rtc_date_to_s(uint32_t year, uint32_t month, uint32_t date,
+                              uint32_t hour, uint32_t min, uint32_t sec)
+{
+    static const uint16_t days_before_month[12] =
+        { 0U, 31U, 59U, 90U, 120U, 151U, 181U, 212U, 243U, 273U, 304U, 334U };
+    uint32_t days = (year * 365U) + ((year + 3U) / 4U) +
+                    days_before_month[month - 1U] + (date - 1U);
+
+    if ((month > 2U) && (0U == (year % 4U)))
+    {
+        days++;
+    }
+    return (((days * 24U) + hour) * 60U + min) * 60U + sec;
+}
+
+/*******************************************************************************
+* Function Name: rtc_now_s
+********************************************************************************
+* Summary:
+*  Returns the RTC time in seconds since 2000-01-01.
+*
+*******************************************************************************/
+static uint32_t rtc_now_s(void)
+{
+    return rtc_base_s + (uint32_t)((sim_time_us() - rtc_set_us) / 1000000U);
+}
+
+cy_en_rtc_status_t Cy_RTC_Init(cy_stc_rtc_config_t const *config)
+{
+    return Cy_RTC_SetDateAndTime(config);
+}
+
+cy_en_rtc_status_t Cy_RTC_SetDateAndTime(cy_stc_rtc_config_t const *dateTime)
+{
+    if ((CY_RTC_24_HOURS != dateTime->hrFormat) || (0U == dateTime->month) ||
+        (dateTime->month > 12U) || (0U == dateTime->date))
+    {
+        return CY_RTC_BAD_PARAM;
+    }
+
+    /* The RTC counts whole seconds from the time it was set */
+    rtc_base_s = rtc_date_to_s(dateTime->year, dateTime->month, dateTime->date,
+                               dateTime->hour, dateTime->min, dateTime->sec);
+    rtc_set_us = sim_time_us();
+    return CY_RTC_SUCCESS;
+}
+
+void Cy_RTC_GetDateAndTime(cy_stc_rtc_config_t *dateTime)
+{
+    uint32_t now_s = rtc_now_s();
+    uint32_t days = now_s / 86400U;
+    uint32_t year = 0U;
+    uint32_t month = 1U;
+    uint32_t year_days;
+    uint32_t month_days;
+
+    dateTime->sec = now_s % 60U;
+    dateTime->min = (now_s / 60U) % 60U;
+    dateTime->hour = (now_s / 3600U) % 24U;
+    dateTime->amPm = CY_RTC_AM;
+    dateTime->hrFormat = CY_RTC_24_HOURS;
+    /* 2000-01-01 was a Saturday */
+    dateTime->dayOfWeek = ((days + CY_RTC_SATURDAY - 1U) % 7U) + 1U;
+
+    for (;;)
+    {
+        year_days = (0U == (year % 4U)) ? 366U : 365U;
+        if (days < year_days)
+        {
+            break;
+        }
+        days -= year_days;
+        year++;
+    }
+    while (month < 12U)
+    {
+        month_days = (rtc_date_to_s(year, month + 1U, 1U, 0U, 0U, 0U) -
+                      rtc_date_to_s(year, month, 1U, 0U, 0U, 0U)) / 86400U;
+        if (days < month_days)
+        {
+            break;
+        }
+        days -= month_days;
+        month++;
+    }
+
+    dateTime->date = days + 1U;
+    dateTime->month = month;
+    dateTime->year = year;
+}
+
+/*******************************************************************************
+* Function Name: Cy_RTC_SetAlarmDateAndTime
+********************************************************************************
+* Summary:
+*  Arms or disarms an alarm. Only alarms that match on month, date, hour,
+*  minute and second are simulated; they fire once, at the start of that
+*  second in the current RTC year.
+*
+*******************************************************************************/
+cy_en_rtc_status_t Cy_RTC_SetAlarmDateAndTime(
+    cy_stc_rtc_alarm_t const *alarmDateTime, cy_en_rtc_alarm_t alarmIndex)
+{
+    cy_stc_rtc_config_t now;
+    uint32_t alarm_s;
+
+    CY_ASSERT((uint32_t)alarmIndex < 2U);
+
+    rtc_alarm_us[alarmIndex] = SIM_TIME_NEVER;
+    if (CY_RTC_ALARM_ENABLE != alarmDateTime->almEn)
+    {
+        return CY_RTC_SUCCESS;
+    }
+    if ((CY_RTC_ALARM_ENABLE != alarmDateTime->secEn) ||
+        (CY_RTC_ALARM_ENABLE != alarmDateTime->minEn) ||
+        (CY_RTC_ALARM_ENABLE != alarmDateTime->hourEn) ||
+        (CY_RTC_ALARM_ENABLE != alarmDateTime->dateEn) ||
+        (CY_RTC_ALARM_ENABLE != alarmDateTime->monthEn))
+    {
+        return CY_RTC_BAD_PARAM;
+    }
+
+    Cy_RTC_GetDateAndTime(&now);
+    alarm_s = rtc_date_to_s(now.year, alarmDateTime->month,
+                            alarmDateTime->date, alarmDateTime->hour,
+                            alarmDateTime->min, alarmDateTime->sec);
+    if (alarm_s > rtc_now_s())
+    {
+        rtc_alarm_us[alarmIndex] = rtc_set_us +
+                                   ((uint64_t)(alarm_s - rtc_base_s) * 1000000U);
+    }
+    return CY_RTC_SUCCESS;
+}
+
+uint32_t Cy_RTC_GetInterruptStatus(void)
+{
+    return rtc_intr;
+}
+
+uint32_t Cy_RTC_GetInterruptStatusMasked(void)
+{
+    return rtc_intr & rtc_intr_mask;
+}
+
+uint32_t Cy_RTC_GetInterruptMask(void)
+{
+    return rtc_intr_mask;
+}
+
+void Cy_RTC_SetInterruptMask(uint32_t interruptMask)
+{
+    rtc_intr_mask = interruptMask;
+}
+
+void Cy_RTC_ClearInterrupt(uint32_t interruptMask)
+{
+    rtc_intr &= ~interruptMask;
+}
+
+/*******************************************************************************
+* Function Name: sim_rtc_next_alarm_us
+********************************************************************************
+* Summary:
+*  Returns the virtual time of the next armed RTC alarm.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint64_t - time in microseconds, SIM_TIME_NEVER if none is armed
+*
+*******************************************************************************/
+uint64_t sim_rtc_next_alarm_us(void)
+{
+    return (rtc_alarm_us[0] < rtc_alarm_us[1]) ? rtc_alarm_us[0]
+                                               : rtc_alarm_us[1];
+}
+
+/*******************************************************************************
+* Function Name: sim_rtc_fire_due
+********************************************************************************
+* Summary:
+*  Sets the interrupt of every alarm due at the given time. ALARM2 belongs to
+*  the POWER_MANAGER partition: if it is unmasked, its interrupt is cleared
+*  and the partition handler runs, like the secure backup domain handler in
+*  power_manager_interrupts.c does.
+*
+* Parameters:
+*  now_us - current virtual time
+*
+* Return:
+*  uint32_t - 1 if the partition handler ran, 0 otherwise
+*
+*******************************************************************************/
+uint32_t sim_rtc_fire_due(uint64_t now_us)
+{
+    uint32_t delivered = 0U;
+
+    if (rtc_alarm_us[CY_RTC_ALARM_1] <= now_us)
+    {
+        rtc_alarm_us[CY_RTC_ALARM_1] = SIM_TIME_NEVER;
+        rtc_intr |= CY_RTC_INTR_ALARM1;
+    }
+    if (rtc_alarm_us[CY_RTC_ALARM_2] <= now_us)
+    {
+        rtc_alarm_us[CY_RTC_ALARM_2] = SIM_TIME_NEVER;
+        rtc_intr |= CY_RTC_INTR_ALARM2;
+        if (0U != (Cy_RTC_GetInterruptStatusMasked() & CY_RTC_INTR_ALARM2))
+        {
+            Cy_RTC_ClearInterrupt(CY_RTC_INTR_ALARM2);
+            if (sim_tfm_raise_irq(RTC_ALARM_INTERRUPT_SIGNAL))
+            {
+                delivered = 1U;
+            }
+        }
+    }
+
+    return delivered;
+}
+
+cy_en_mcwdt_status_t Cy_MCWDT_Init(MCWDT_STRUCT_Type *base,
+                                   cy_stc_mcwdt_config_t const *config)
+{
+    if ((NULL == base) || (NULL == config))
+    {
+        return CY_MCWDT_BAD_PARAM;
+    }
+
+    base->CONFIG = 0U;
+    if (config->c0c1Cascade && !lptimer_single)
+    {
+        base->CONFIG |= (uint32_t)CY_MCWDT_CASCADE_C0C1;
+    }
+    if (config->c1c2Cascade)
+    {
+        base->CONFIG |= (uint32_t)CY_MCWDT_CASCADE_C1C2;
+    }
+    return CY_MCWDT_SUCCESS;
+}
+
+cy_en_mcwdtcascade_t Cy_MCWDT_GetCascade(MCWDT_STRUCT_Type const *base)
+{
+    return (cy_en_mcwdtcascade_t)base->CONFIG;
+}
+
+/*******************************************************************************
+* Function Name: sim_pdl_set_lptimer_single
+********************************************************************************
+* Summary:
+*  Leaves counters 0 and 1 of the LPTimer MCWDT uncascaded, whatever the
+*  configuration asks for, to compare tickless idle with counter 0 alone.
+*
+*******************************************************************************/
+void sim_pdl_set_lptimer_single(bool single)
+{
+    lptimer_single = single;
+}
+
+void Cy_MCWDT_Enable(MCWDT_STRUCT_Type *base, uint32_t counters,
+                     uint16_t waitUs)
+{
+    base->CTL |= counters;
+    sim_time_busy_wait_us(waitUs);
+}
+
+cy_rslt_t mtb_hal_lptimer_setup(mtb_hal_lptimer_t *obj,
+                                const mtb_hal_lptimer_configurator_t *config)
+{
+    obj->configured = config->configured;
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: mtb_hal_lptimer_read
+********************************************************************************
+* Summary:
+*  Returns the LPTimer count derived from the virtual time. The counter keeps
+*  running in simulated DeepSleep like the MCWDT does.
+*
+*******************************************************************************/
+uint32_t mtb_hal_lptimer_read(const mtb_hal_lptimer_t *obj)
+{
+    CY_UNUSED_PARAMETER(obj);
+    /* HAL code is fetched from the external flash */
+    sim_pdl_xip_fetch();
+    return (uint32_t)((sim_time_us() * SIM_LPTIMER_HZ) / USEC_PER_SEC);
+}
+
+void cyabs_rtos_set_lptimer(mtb_hal_lptimer_t *timer)
+{
+    CY_UNUSED_PARAMETER(timer);
+}
+
+cy_en_sysclk_status_t Cy_SysClk_ClkHfSetDivider(uint32_t clkHf,
+                                                cy_en_clkhf_dividers_t divider)
+{
+    if ((0U != clkHf) || (divider > CY_SYSCLK_CLKHF_DIVIDE_BY_8))
+    {
+        return CY_SYSCLK_BAD_PARAM;
+    }
+    clk_hf0_divider = (uint32_t)divider;
+    return CY_SYSCLK_SUCCESS;
+}
+
+uint32_t Cy_SysClk_ClkLfGetFrequency(void)
+{
+    return (uint32_t)SIM_LPTIMER_HZ;
+}
+
+void SystemCoreClockUpdate(void)
+{
+    SystemCoreClock = SIM_CLK_PATH0_HZ / (clk_hf0_divider + 1U);
+}
+
+/*******************************************************************************
+* Function Name: sim_dwt
+********************************************************************************
+* Summary:
+*  Returns the DWT registers with CYCCNT set to the virtual time at the
+*  current core clock. The counter stops in DeepSleep, like the clock of
+*  the CPU.
+*
+*******************************************************************************/
+DWT_Type *sim_dwt(void)
+{
+    sim_power_stats_t power;
+
+    sim_rtos_get_stats(&power);
+    sim_dwt_regs.CYCCNT = (uint32_t)((sim_time_us() - power.deepsleep_us) *
+                                     (SystemCoreClock / USEC_PER_SEC));
+    return &sim_dwt_regs;
+}
+
+/*******************************************************************************
+* System library
+*******************************************************************************/
+
+/* Simulated interrupts only run from the idle task and the simulated sleep,
+ * so there is nothing to mask. */
+uint32_t Cy_SysLib_EnterCriticalSection(void)
+{
+    return 0U;
+}
+
+void Cy_SysLib_ExitCriticalSection(uint32_t savedIntrStatus)
+{
+    CY_UNUSED_PARAMETER(savedIntrStatus);
+}
+
+void Cy_SysLib_Delay(uint32_t milliseconds)
+{
+    sim_time_busy_wait_us((uint64_t)milliseconds * 1000U);
+}
+
+void Cy_SysLib_DelayUs(uint16_t microseconds)
+{
+    sim_time_busy_wait_us(microseconds);
+    cm55_update();
+}
+
+/* Power-on, or a Hibernate wake-up if the run resumed */
+uint32_t Cy_SysLib_GetResetReason(void)
+{
+    return reset_reason;
+}
+
+void Cy_SysLib_ClearResetReason(void)
+{
+    reset_reason = 0U;
+}
+
+/*******************************************************************************
+* GPIO
+*******************************************************************************/
+
+void Cy_GPIO_Set(GPIO_PRT_Type *base, uint32_t pinNum)
+{
+    base->OUT |= (1UL << pinNum);
+}
+
+void Cy_GPIO_Clr(GPIO_PRT_Type *base, uint32_t pinNum)
+{
+    base->OUT &= ~(1UL << pinNum);
+}
+
+void Cy_GPIO_Inv(GPIO_PRT_Type *base, uint32_t pinNum)
+{
+    base->OUT ^= (1UL << pinNum);
+}
+
+uint32_t Cy_GPIO_ReadOut(GPIO_PRT_Type *base, uint32_t pinNum)
+{
+    return (base->OUT >> pinNum) & 1UL;
+}
+
+uint32_t Cy_GPIO_GetInterruptStatus(GPIO_PRT_Type *base, uint32_t pinNum)
+{
+    return (base->INTR >> pinNum) & 1UL;
+}
+
+void Cy_GPIO_ClearInterrupt(GPIO_PRT_Type *base, uint32_t pinNum)
+{
+    base->INTR &= ~(1UL << pinNum);
+}
+
+void Cy_GPIO_SetInterruptMask(GPIO_PRT_Type *base, uint32_t pinNum,
+                              uint32_t value)
+{
+    base->INTR_MASK = (base->INTR_MASK & ~(1UL << pinNum)) |
+                      ((value & 1UL) << pinNum);
+}
+
+uint32_t Cy_GPIO_GetInterruptMask(GPIO_PRT_Type *base, uint32_t pinNum)
+{
+    return (base->INTR_MASK >> pinNum) & 1UL;
+}
+
+uint32_t Cy_GPIO_GetInterruptStatusMasked(GPIO_PRT_Type *base,
+                                          uint32_t pinNum)
+{
+    return ((base->INTR & base->INTR_MASK) >> pinNum) & 1UL;
+}
+
+void sim_gpio_apply_w1c(GPIO_PRT_Type *base)
+{
+    base->INTR &= ~base->INTR_W1C;
+    base->INTR_W1C = 0U;
+}
+
+uint32_t sim_gpio_intr_masked(GPIO_PRT_Type *base)
+{
+    sim_gpio_apply_w1c(base);
+    return base->INTR & base->INTR_MASK;
+}
+
+/*******************************************************************************
+* CM55 and power domains
+*******************************************************************************/
+
+void sim_pdl_set_cm55_boot_us(uint32_t boot_us)
+{
+    cm55_boot_us = boot_us;
+}
+
+/*******************************************************************************
+* Function Name: sim_pdl_cm55_running
+********************************************************************************
+* Summary:
+*  Returns true if the simulated CM55 is out of reset, powered and done with
+*  its boot, so that it runs its wake-up checks.
+*
+*******************************************************************************/
+bool sim_pdl_cm55_running(void)
+{
+    cm55_update();
+    return (0U != sim_mxcm55.CTL) && pd1_enabled && !cm55_booting;
+}
+
+/*******************************************************************************
+* Function Name: Cy_SysEnableCM55
+********************************************************************************
+* Summary:
+*  Releases the simulated CM55 from reset. It reports ready after the
+*  configured boot time, unless its power domain is off.
+*
+*******************************************************************************/
+void Cy_SysEnableCM55(MXCM55_Type *base, uint32_t vectorTableOffset,
+                      uint32_t waitus)
+{
+    CY_UNUSED_PARAMETER(vectorTableOffset);
+
+    base->CTL = 1U;
+    sim_time_busy_wait_us(waitus);
+    if (pd1_enabled)
+    {
+        cm55_booting = true;
+        cm55_ready_at_us = sim_time_us() + cm55_boot_us;
+    }
+}
+
+void Cy_SysDisableCM55(MXCM55_Type *base, uint32_t waitus)
+{
+    /* The CM55 wake-ups until now happened while it was on */
+    sim_cm55_run_due(sim_time_us());
+    base->CTL = 0U;
+    cm55_booting = false;
+    sim_time_busy_wait_us(waitus);
+}
+
+void Cy_System_EnablePD1(void)
+{
+    pd1_enabled = true;
+}
+
+void Cy_System_DisablePD1(void)
+{
+    pd1_enabled = false;
+    cm55_booting = false;
+}
+
+/*******************************************************************************
+* System power management
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: Cy_SysPm_RegisterCallback
+********************************************************************************
+* Summary:
+*  Adds a callback to the list, sorted by order. Callbacks with the same
+*  order are called in registration order.
+*
+*******************************************************************************/
+bool Cy_SysPm_RegisterCallback(cy_stc_syspm_callback_t *handler)
+{
+    cy_stc_syspm_callback_t *curr;
+    cy_stc_syspm_callback_t *prev = NULL;
+
+    if ((NULL == handler) || (NULL == handler->callback))
+    {
+        return false;
+    }
+
+    for (curr = syspm_callbacks; NULL != curr; curr = curr->nextItm)
+    {
+        if (curr == handler)
+        {
+            return false;
+        }
+    }
+
+    for (curr = syspm_callbacks;
+         (NULL != curr) && (curr->order <= handler->order);
+         curr = curr->nextItm)
+    {
+        prev = curr;
+    }
+
+    handler->prevItm = prev;
+    handler->nextItm = curr;
+    if (NULL != curr)
+    {
+        curr->prevItm = handler;
+    }
+    if (NULL != prev)
+    {
+        prev->nextItm = handler;
+    }
+    else
+    {
+        syspm_callbacks = handler;
+    }
+
+    return true;
+}
+
+bool Cy_SysPm_UnregisterCallback(cy_stc_syspm_callback_t const *handler)
+{
+    cy_stc_syspm_callback_t *curr;
+
+    for (curr = syspm_callbacks; NULL != curr; curr = curr->nextItm)
+    {
+        if (curr == handler)
+        {
+            if (NULL != curr->prevItm)
+            {
+                curr->prevItm->nextItm = curr->nextItm;
+            }
+            else
+            {
+                syspm_callbacks = curr->nextItm;
+            }
+            if (NULL != curr->nextItm)
+            {
+                curr->nextItm->prevItm = curr->prevItm;
+            }
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*******************************************************************************
+* Function Name: call
+********************************************************************************
+* Summary:
+*  Calls one callback in the given mode unless it skips that mode. Wake
+*  events that fell due while the previous callbacks ran are delivered
+*  first, as the secure interrupts preempt the chain on the device.
+*
+*******************************************************************************/
+static cy_en_syspm_status_t call(cy_stc_syspm_callback_t *cb,
+                                 cy_en_syspm_callback_mode_t mode)
+{
+    if (0U != (cb->skipMode & (uint32_t)mode))
+    {
+        return CY_SYSPM_SUCCESS;
+    }
+
+    (void)sim_wake_fire_due(sim_time_us());
+    (void)sim_rtc_fire_due(sim_time_us());
+
+    return cb->callback(cb->callbackParams, mode);
+}
+
+/*******************************************************************************
+* Function Name: sim_syspm_enter
+********************************************************************************
+* Summary:
+*  Runs the first half of a power mode transition like the PDL does: all
+*  callbacks of the type get CHECK_READY in ascending order. If one fails,
+*  the callbacks that already agreed get CHECK_FAIL in descending order and
+*  the transition is abandoned. Otherwise all callbacks get
+*  BEFORE_TRANSITION in ascending order.
+*
+* Parameters:
+*  type - callback type of the transition
+*
+* Return:
+*  cy_en_syspm_status_t - CY_SYSPM_SUCCESS or CY_SYSPM_FAIL
+*
+*******************************************************************************/
+cy_en_syspm_status_t sim_syspm_enter(cy_en_syspm_callback_type_t type)
+{
+    cy_stc_syspm_callback_t *cb;
+    cy_stc_syspm_callback_t *last = NULL;
+
+    for (cb = syspm_callbacks; NULL != cb; cb = cb->nextItm)
+    {
+        if (cb->type != type)
+        {
+            continue;
+        }
+        if (CY_SYSPM_SUCCESS != call(cb, CY_SYSPM_CHECK_READY))
+        {
+            for (cb = last; NULL != cb; cb = cb->prevItm)
+            {
+                if (cb->type == type)
+                {
+                    (void)call(cb, CY_SYSPM_CHECK_FAIL);
+                }
+            }
+            return CY_SYSPM_FAIL;
+        }
+        last = cb;
+    }
+
+    for (cb = syspm_callbacks; NULL != cb; cb = cb->nextItm)
+    {
+        if (cb->type == type)
+        {
+            (void)call(cb, CY_SYSPM_BEFORE_TRANSITION);
+        }
+    }
+
+    if ((CY_SYSPM_DEEPSLEEP == type) && (0U != sram_off_mask))
+    {
+        sram_stats.off_mask = sram_off_mask;
+        sram_stats.deepsleeps++;
+    }
+    in_deepsleep = (CY_SYSPM_DEEPSLEEP == type);
+
+    return CY_SYSPM_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: sim_syspm_exit
+********************************************************************************
+* Summary:
+*  Runs the second half of a power mode transition: all callbacks of the
+*  type get AFTER_TRANSITION in descending order. After DeepSleep, the
+*  external flash resumes from now on. A secure interrupt that woke the
+*  device runs first and waits for the flash, see sim_pdl_secure_handler();
+*  the first callback waits for it unless the wake path was built into RAM.
+*
+* Parameters:
+*  type - callback type of the transition
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void sim_syspm_exit(cy_en_syspm_callback_type_t type)
+{
+    cy_stc_syspm_callback_t *cb;
+    cy_stc_syspm_callback_t *tail = NULL;
+    uint64_t wake_us = sim_time_us();
+    uint32_t first_us;
+
+    if (CY_SYSPM_DEEPSLEEP == type)
+    {
+        xip_ready_us = wake_us + xip_resume_us;
+        in_deepsleep = false;
+        if (secure_wake)
+        {
+            secure_wake = false;
+            xip_stats.secure_wakes++;
+            sim_pdl_xip_fetch();
+        }
+#if (APP_RAM_WAKE_PATH == 0)
+        /* The callbacks are fetched from the external flash */
+        sim_pdl_xip_fetch();
+#endif
+        first_us = (uint32_t)(sim_time_us() - wake_us);
+        xip_stats.exits++;
+        xip_stats.first_us += first_us;
+        if (first_us > xip_stats.first_max_us)
+        {
+            xip_stats.first_max_us = first_us;
+        }
+    }
+
+    for (cb = syspm_callbacks; NULL != cb; cb = cb->nextItm)
+    {
+        tail = cb;
+    }
+
+    for (cb = tail; NULL != cb; cb = cb->prevItm)
+    {
+        if (cb->type == type)
+        {
+            (void)call(cb, CY_SYSPM_AFTER_TRANSITION);
+        }
+    }
+
+    /* The application must not hold live data in these macros */
+    if (CY_SYSPM_DEEPSLEEP == type)
+    {
+        sram_stats.off_after_exit |= sram_off_mask;
+    }
+}
+
+/*******************************************************************************
+* Function Name: Cy_SysPm_SetSRAMMacroPwrMode
+********************************************************************************
+* Summary:
+*  Powers an SRAM macro up or down. The contents of the simulated SRAM are
+*  not modelled; the macros powered down are recorded for the report.
+*
+*******************************************************************************/
+cy_en_syspm_status_t Cy_SysPm_SetSRAMMacroPwrMode(cy_en_syspm_sram_index_t sramNum,
+                                                  uint32_t sramMacroNum,
+                                                  cy_en_syspm_sram_pwr_mode_t sramPwrMode)
+{
+    uint32_t bit;
+
+    if ((sramNum > CY_SYSPM_SRAM1_MEMORY) || (sramMacroNum >= 8U))
+    {
+        return CY_SYSPM_INVALID_STATE;
+    }
+
+    bit = 1UL << (((uint32_t)sramNum * 8U) + sramMacroNum);
+    if (CY_SYSPM_SRAM_PWR_MODE_OFF == sramPwrMode)
+    {
+        sram_off_mask |= bit;
+    }
+    else
+    {
+        sram_off_mask &= ~bit;
+    }
+
+    return CY_SYSPM_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: system_enter
+********************************************************************************
+* Summary:
+*  Performs a system power mode transition through the callback chain.
+*
+*******************************************************************************/
+static cy_en_syspm_status_t system_enter(cy_en_syspm_callback_type_t type)
+{
+    if (CY_SYSPM_SUCCESS != sim_syspm_enter(type))
+    {
+        return CY_SYSPM_FAIL;
+    }
+    sim_syspm_exit(type);
+    return CY_SYSPM_SUCCESS;
+}
+
+cy_en_syspm_status_t Cy_SysPm_SystemEnterHp(void)
+{
+    return system_enter(CY_SYSPM_HP);
+}
+
+cy_en_syspm_status_t Cy_SysPm_SystemEnterLp(void)
+{
+    return system_enter(CY_SYSPM_LP);
+}
+
+cy_en_syspm_status_t Cy_SysPm_SystemEnterUlp(void)
+{
+    return system_enter(CY_SYSPM_ULP);
+}
+
+/*******************************************************************************
+* SCB UART of the platform log service
+*******************************************************************************/
+
+/* Bytes of the UART that have not left it at the current time, the one in
+ * the shifter included */
+static uint32_t uart_bytes_left(void)
+{
+    uint64_t now_ns = sim_time_us() * 1000U;
+
+    if (uart_done_ns <= now_ns)
+    {
+        return 0U;
+    }
+    return (uint32_t)((uart_done_ns - now_ns + SIM_LOG_NS_PER_BYTE - 1U) / SIM_LOG_NS_PER_BYTE);
+}
+
+/*******************************************************************************
+* Function Name: sim_pdl_uart_write
+********************************************************************************
+* Summary:
+*  Puts bytes into the TX FIFO, as the platform log service does, and returns
+*  the time the service waits for FIFO space for the last of them.
+*
+*******************************************************************************/
+uint64_t sim_pdl_uart_write(uint32_t size)
+{
+    uint64_t now_ns = sim_time_us() * 1000U;
+    uint32_t queued = uart_bytes_left() + size;
+
+    uart_done_ns = ((uart_done_ns > now_ns) ? uart_done_ns : now_ns) +
+                   ((uint64_t)size * SIM_LOG_NS_PER_BYTE);
+    if (queued <= (SIM_UART_FIFO_SIZE + 1U))
+    {
+        return 0U;
+    }
+    return ((uint64_t)(queued - SIM_UART_FIFO_SIZE - 1U) * SIM_LOG_NS_PER_BYTE) / 1000U;
+}
+
+uint32_t Cy_SCB_GetFifoSize(CySCB_Type const *base)
+{
+    CY_UNUSED_PARAMETER(base);
+    return SIM_UART_FIFO_SIZE;
+}
+
+uint32_t Cy_SCB_UART_GetNumInTxFifo(CySCB_Type const *base)
+{
+    uint32_t left = uart_bytes_left();
+
+    CY_UNUSED_PARAMETER(base);
+    return (0U != left) ? (left - 1U) : 0U;
+}
+
+bool Cy_SCB_UART_IsTxComplete(CySCB_Type const *base)
+{
+    CY_UNUSED_PARAMETER(base);
+    return (0U == uart_bytes_left());
+}
+
+/*******************************************************************************
+* Hibernate
+*******************************************************************************/
+
+void Cy_SysPm_SetHibernateWakeupSource(uint32_t wakeupSource)
+{
+    hibernate_sources |= wakeupSource;
+}
+
+void Cy_SysPm_ClearHibernateWakeupSource(uint32_t wakeupSource)
+{
+    hibernate_sources &= ~wakeupSource;
+}
+
+cy_en_syspm_hibernate_wakeup_source_t Cy_SysPm_GetHibernateWakeupCause(void)
+{
+    return (cy_en_syspm_hibernate_wakeup_source_t)hibernate_cause;
+}
+
+void Cy_SysPm_ClearHibernateWakeupCause(void)
+{
+    hibernate_cause = 0U;
+}
+
+/*******************************************************************************
+* Function Name: Cy_SysPm_SystemEnterHibernate
+********************************************************************************
+* Summary:
+*  Runs the Hibernate callbacks and ends the run, as the device loses all
+*  state but the backup domain. The wake-up is the armed ALARM2 of the RTC
+*  or the next injected press on a wake-up pin, whichever comes first. The
+*  backup registers and the RTC time at the wake-up are written to the
+*  Hibernate file, so that the next run with the file resumes.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  cy_en_syspm_status_t - CY_SYSPM_FAIL if a callback refused the entry;
+*                         does not return otherwise
+*
+*******************************************************************************/
+cy_en_syspm_status_t Cy_SysPm_SystemEnterHibernate(void)
+{
+    sim_hibernate_file_t record;
+    uint64_t now_us;
+    uint64_t wake_us = SIM_TIME_NEVER;
+    uint64_t pin_us;
+    uint32_t cause = 0U;
+    FILE *file;
+
+    if (CY_SYSPM_SUCCESS != sim_syspm_enter(CY_SYSPM_HIBERNATE))
+    {
+        return CY_SYSPM_FAIL;
+    }
+
+    now_us = sim_time_us();
+    if ((0U != (hibernate_sources & (uint32_t)CY_SYSPM_HIBERNATE_RTC_ALARM)) &&
+        (0U != (rtc_intr_mask & CY_RTC_INTR_ALARM2)))
+    {
+        wake_us = rtc_alarm_us[CY_RTC_ALARM_2];
+        cause = (uint32_t)CY_SYSPM_HIBERNATE_RTC_ALARM;
+    }
+    if (0U != (hibernate_sources & SIM_HIBERNATE_PINS))
+    {
+        pin_us = sim_wake_next_us();
+        if (pin_us < wake_us)
+        {
+            wake_us = pin_us;
+            cause = hibernate_sources & SIM_HIBERNATE_PINS;
+        }
+    }
+    if (wake_us < now_us)
+    {
+        wake_us = now_us;
+    }
+
+    hibernate_stats.entered = true;
+    hibernate_stats.entry_us = now_us;
+    hibernate_stats.hibernate_us = SIM_TIME_NEVER;
+    hibernate_stats.wakeup_cause = 0U;
+    if (SIM_TIME_NEVER != wake_us)
+    {
+        hibernate_stats.hibernate_us = wake_us - now_us;
+        hibernate_stats.wakeup_cause = cause;
+
+        if (NULL != hibernate_path)
+        {
+            memcpy(record.breg, (const void *)sim_backup.BREG, sizeof(record.breg));
+            record.rtc_s = rtc_now_s() + (uint32_t)((wake_us - now_us) / USEC_PER_SEC);
+            record.wakeup_cause = cause;
+            file = fopen(hibernate_path, "wb");
+            if (NULL != file)
+            {
+                (void)fwrite(&record, sizeof(record), 1U, file);
+                fclose(file);
+            }
+        }
+    }
+
+    sim_finish();
+    return CY_SYSPM_FAIL;
+}
+
+/*******************************************************************************
+* Function Name: sim_pdl_set_hibernate_file
+********************************************************************************
+* Summary:
+*  Sets the file that carries the backup domain from a run that enters
+*  Hibernate to the next run. If the file exists, it is read and removed,
+*  and this run starts as a Hibernate wake-up: with the backup registers,
+*  the RTC time and the wake-up cause of the file and a Hibernate reset
+*  reason. Call before the partition is initialized.
+*
+* Return:
+*  bool - false if the file exists but cannot be read
+*
+*******************************************************************************/
+bool sim_pdl_set_hibernate_file(const char *path)
+{
+    sim_hibernate_file_t record;
+    FILE *file = fopen(path, "rb");
+    bool ok;
+
+    hibernate_path = path;
+    if (NULL == file)
+    {
+        return true;
+    }
+    ok = (1U == fread(&record, sizeof(record), 1U, file));
+    fclose(file);
+    if (!ok)
+    {
+        return false;
+    }
+    (void)remove(path);
+
+    memcpy((void *)sim_backup.BREG, record.breg, sizeof(record.breg));
+    rtc_base_s = record.rtc_s;
+    rtc_set_us = sim_time_us();
+    hibernate_cause = record.wakeup_cause;
+    reset_reason = CY_SYSLIB_RESET_HIB_WAKEUP;
+    hibernate_stats.resumed = true;
+    hibernate_stats.resume_cause = record.wakeup_cause;
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: sim_pdl_get_hibernate_stats
+********************************************************************************
+* Summary:
+*  Returns the Hibernate wake-up that started the run and the Hibernate
+*  entry that ended it.
+*
+*******************************************************************************/
+void sim_pdl_get_hibernate_stats(sim_hibernate_stats_t *stats)
+{
+    *stats = hibernate_stats;
+}
+
+/*******************************************************************************
+* Function Name: sim_pdl_get_sram_stats
+********************************************************************************
+* Summary:
+*  Returns the SRAM macros powered down in the DeepSleep entries of the run.
+*
+*******************************************************************************/
+void sim_pdl_get_sram_stats(sim_sram_stats_t *stats)
+{
+    *stats = sram_stats;
+}
+
+/*******************************************************************************
+* Function Name: sim_pdl_set_xip_resume_us
+********************************************************************************
+* Summary:
+*  Sets the time from a DeepSleep exit until instructions can be fetched from
+*  the external flash again.
+*
+*******************************************************************************/
+void sim_pdl_set_xip_resume_us(uint32_t resume_us)
+{
+    xip_resume_us = resume_us;
+}
+
+/*******************************************************************************
+* Function Name: sim_pdl_xip_fetch
+********************************************************************************
+* Summary:
+*  Accounts for an instruction fetch from the external flash. Before the
+*  flash has resumed from DeepSleep, the CPU stalls until it has; the stall
+*  is spent as a busy wait.
+*
+*******************************************************************************/
+void sim_pdl_xip_fetch(void)
+{
+    uint64_t now_us = sim_time_us();
+
+    if (now_us < xip_ready_us)
+    {
+        xip_stats.stall_us += xip_ready_us - now_us;
+        sim_time_busy_wait_us(xip_ready_us - now_us);
+    }
+}
+
+/*******************************************************************************
+* Function Name: sim_pdl_secure_handler
+********************************************************************************
+* Summary:
+*  Accounts for the SPM handler of a secure interrupt. The SPM dispatch and
+*  the PDL functions it calls execute from the external flash, wherever the
+*  partition code is placed. The handler of an interrupt raised in DeepSleep
+*  runs at the wake-up, before the non-secure wake path: it is accounted for
+*  at the DeepSleep exit.
+*
+*******************************************************************************/
+void sim_pdl_secure_handler(void)
+{
+    if (in_deepsleep)
+    {
+        secure_wake = true;
+    }
+    else
+    {
+        sim_pdl_xip_fetch();
+    }
+}
+
+/*******************************************************************************
+* Function Name: sim_pdl_get_xip_stats
+********************************************************************************
+* Summary:
+*  Returns the instruction fetch stalls after the DeepSleep exits of the run.
+*
+*******************************************************************************/
+void sim_pdl_get_xip_stats(sim_xip_stats_t *stats)
+{
+    *stats = xip_stats;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,436 @@
+/*****************************************************************************
+* File Name        : sim_rtos.c
+*
+* Description      : Virtual time and simulated low power modes of the POSIX
+*                    simulation. The FreeRTOS tick timer of the POSIX port is
+*                    stopped; the virtual time advances only when the idle task runs
+*                    (one tick per idle hook call), when the system sleeps (the
+*                    whole expected idle time at once) and on busy waits. Time in
+*                    which tasks run is therefore free, which is what makes the
+*                    simulation faster than real time.
+*
+* Related Document : See docs/host_simulation.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/time.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "sim.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+#define USEC_PER_TICK       (1000000ULL / configTICK_RATE_HZ)
+
+/* Same rule as the RTOS abstraction library: the system enters DeepSleep when
+ * the expected idle time is longer than the DeepSleep latency and CPU Sleep
+ * otherwise. */
+#define DEEPSLEEP_MIN_TICKS (pdMS_TO_TICKS(CY_CFG_PWR_DEEPSLEEP_LATENCY))
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/* Virtual time: elapsed ticks plus busy waits shorter than a tick */
+static uint64_t sim_ticks = 0U;
+static uint64_t sim_sub_tick_us = 0U;
+
+static uint64_t sim_end_us = SIM_TIME_NEVER;
+static uint32_t sim_cycle_limit = 0U;
+static bool tick_timer_stopped = false;
+static sim_power_stats_t power_stats;
+
+/*******************************************************************************
+* Function Name: sim_rtos_init
+********************************************************************************
+* Summary:
+*  Sets when the simulation ends: after the simulated time or after the
+*  given number of sleep cycles, whichever comes first.
+*
+* Parameters:
+*  duration_us - simulated time
+*  cycle_limit - number of sleep cycles, 0 for no limit
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void sim_rtos_init(uint64_t duration_us, uint32_t cycle_limit)
+{
+    sim_end_us = duration_us;
+    sim_cycle_limit = cycle_limit;
+}
+
+/*******************************************************************************
+* Function Name: sim_time_us
+********************************************************************************
+* Summary:
+*  Returns the virtual time since start.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint64_t - virtual time in microseconds
+*
+*******************************************************************************/
+uint64_t sim_time_us(void)
+{
+    return (sim_ticks * USEC_PER_TICK) + sim_sub_tick_us;
+}
+
+/*******************************************************************************
+* Function Name: step_ticks
+********************************************************************************
+* Summary:
+*  Advances the virtual time of a running scheduler. Tasks whose delay
+*  expires preempt the caller.
+*
+* Parameters:
+*  ticks - number of ticks
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void step_ticks(TickType_t ticks)
+{
+    sim_ticks += ticks;
+    (void)xTaskCatchUpTicks(ticks);
+}
+
+/*******************************************************************************
+* Function Name: sim_time_busy_wait_us
+********************************************************************************
+* Summary:
+*  Accounts for a busy wait. Whole ticks are passed to the scheduler when it
+*  runs and is not suspended, as the tick interrupt would during a real busy
+*  wait, each at the virtual time it is due; otherwise the time is only added
+*  to the virtual time.
+*
+* Parameters:
+*  duration_us - busy wait time
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void sim_time_busy_wait_us(uint64_t duration_us)
+{
+    if (taskSCHEDULER_RUNNING != xTaskGetSchedulerState())
+    {
+        sim_sub_tick_us += duration_us;
+        return;
+    }
+
+    /* Time added while the scheduler was suspended */
+    while (sim_sub_tick_us >= USEC_PER_TICK)
+    {
+        sim_sub_tick_us -= USEC_PER_TICK;
+        step_ticks(1U);
+    }
+
+    while ((sim_sub_tick_us + duration_us) >= USEC_PER_TICK)
+    {
+        duration_us -= USEC_PER_TICK - sim_sub_tick_us;
+        sim_sub_tick_us = 0U;
+        step_ticks(1U);
+    }
+    sim_sub_tick_us += duration_us;
+}
+
+/*******************************************************************************
+* Function Name: sim_rtos_get_stats
+********************************************************************************
+* Summary:
+*  Returns the power mode statistics. The active time is the virtual time
+*  not spent in CPU Sleep or DeepSleep.
+*
+* Parameters:
+*  stats - filled with the statistics
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void sim_rtos_get_stats(sim_power_stats_t *stats)
+{
+    *stats = power_stats;
+    stats->active_us = sim_time_us() - power_stats.sleep_us -
+                       power_stats.deepsleep_us;
+}
+
+/*******************************************************************************
+* Function Name: next_event_us
+********************************************************************************
+* Summary:
+*  Returns the virtual time of the next wake event: an injected wake or an
+*  RTC alarm.
+*
+*******************************************************************************/
+static uint64_t next_event_us(void)
+{
+    uint64_t wake_us = sim_wake_next_us();
+    uint64_t alarm_us = sim_rtc_next_alarm_us();
+
+    return (wake_us < alarm_us) ? wake_us : alarm_us;
+}
+
+/*******************************************************************************
+* Function Name: fire_due_events
+********************************************************************************
+* Summary:
+*  Delivers the injected wakes and RTC alarms due at the given time and
+*  returns the number of secure interrupts they raised.
+*
+*******************************************************************************/
+static uint32_t fire_due_events(uint64_t now_us)
+{
+    return sim_wake_fire_due(now_us) + sim_rtc_fire_due(now_us);
+}
+
+/*******************************************************************************
+* Function Name: stop_tick_timer
+********************************************************************************
+* Summary:
+*  Stops the interval timer that drives the tick of the FreeRTOS POSIX port
+*  (V10.6.x) so that only the virtual time advances the tick count.
+*
+*******************************************************************************/
+static void stop_tick_timer(void)
+{
+    struct itimerval off = { { 0, 0 }, { 0, 0 } };
+
+    (void)setitimer(ITIMER_REAL, &off, NULL);
+    tick_timer_stopped = true;
+}
+
+/*******************************************************************************
+* Function Name: vApplicationIdleHook
+********************************************************************************
+* Summary:
+*  Runs whenever no task is ready. It delivers the wake events that are
+*  due, advances the virtual time to the next tick and ends the simulation
+*  once the simulated time is reached.
+*
+*******************************************************************************/
+void vApplicationIdleHook(void)
+{
+    if (!tick_timer_stopped)
+    {
+        stop_tick_timer();
+    }
+
+    if (sim_time_us() >= sim_end_us)
+    {
+        sim_finish();
+    }
+
+    (void)fire_due_events(sim_time_us());
+
+    /* The next tick is due at the next tick boundary; a busy wait that ended
+     * between two ticks does not move the tick phase */
+    while (sim_sub_tick_us >= USEC_PER_TICK)
+    {
+        sim_sub_tick_us -= USEC_PER_TICK;
+        step_ticks(1U);
+    }
+    sim_sub_tick_us = 0U;
+    step_ticks(1U);
+}
+
+/*******************************************************************************
+* Function Name: vApplicationSleep
+********************************************************************************
+* Summary:
+*  Simulated tickless idle. It is called by the idle task with the scheduler
+*  suspended. For long idle times the DeepSleep callbacks run like on the
+*  device: CHECK_READY and BEFORE_TRANSITION on entry, AFTER_TRANSITION on
+*  exit. The system sleeps until the expected idle time ends or the next
+*  injected wake event or RTC alarm, whichever comes first. A wake event calls
+*  the secure interrupt handler before the AFTER_TRANSITION callbacks, as the
+*  SPE does before it returns from DeepSleep.
+*
+* Parameters:
+*  xExpectedIdleTime - ticks until the next task unblocks or the end of the
+*                      LPTimer span, UINT32_MAX to sleep until an event
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void vApplicationSleep(uint32_t xExpectedIdleTime)
+{
+    eSleepModeStatus status = eTaskConfirmSleepModeStatus();
+    uint64_t now_tick = sim_ticks;
+    uint64_t wake_tick;
+    uint64_t event_tick;
+    uint64_t end_tick;
+    uint64_t slept_us;
+    uint32_t cycles;
+    bool deepsleep;
+    bool woken_by_event = false;
+    bool woken_by_end = false;
+
+    if (eAbortSleep == status)
+    {
+        return;
+    }
+
+    /* The LPTimer is armed for the expected idle time, bounded to its span
+     * by tickless_idle_sleep(), even if no task waits with a timeout */
+    if (UINT32_MAX == xExpectedIdleTime)
+    {
+        wake_tick = SIM_TIME_NEVER;
+    }
+    else
+    {
+        wake_tick = now_tick + xExpectedIdleTime;
+    }
+
+    deepsleep = ((uint64_t)xExpectedIdleTime > DEEPSLEEP_MIN_TICKS);
+    if (deepsleep)
+    {
+        if (CY_SYSPM_SUCCESS != sim_syspm_enter(CY_SYSPM_DEEPSLEEP))
+        {
+            power_stats.deepsleep_aborts++;
+            return;
+        }
+        power_stats.deepsleep_entries++;
+    }
+    else
+    {
+        power_stats.sleep_entries++;
+    }
+
+    end_tick = (sim_end_us + USEC_PER_TICK - 1U) / USEC_PER_TICK;
+    if (end_tick < wake_tick)
+    {
+        wake_tick = end_tick;
+        woken_by_end = true;
+    }
+    if (wake_tick < now_tick)
+    {
+        wake_tick = now_tick;
+    }
+
+    /* Wake events are rounded up to the next tick; nothing can happen
+     * between two ticks while the system sleeps. An event that reaches no
+     * handler, such as an edge on a masked pin, does not wake the system. */
+    for (;;)
+    {
+        event_tick = next_event_us();
+        if (SIM_TIME_NEVER == event_tick)
+        {
+            break;
+        }
+        event_tick = (event_tick + USEC_PER_TICK - 1U) / USEC_PER_TICK;
+        if (event_tick < now_tick)
+        {
+            event_tick = now_tick;
+        }
+        /* A timeout at the same tick wins, the end of the simulation not */
+        if ((event_tick > wake_tick) ||
+            ((event_tick == wake_tick) && !woken_by_end))
+        {
+            break;
+        }
+        sim_ticks = event_tick;
+        if (0U != fire_due_events(sim_time_us()))
+        {
+            wake_tick = event_tick;
+            woken_by_event = true;
+            woken_by_end = false;
+            break;
+        }
+    }
+
+    slept_us = (wake_tick - now_tick) * USEC_PER_TICK;
+    sim_ticks = wake_tick;
+
+    if (woken_by_event)
+    {
+        power_stats.wakes_by_event++;
+    }
+    else if (!woken_by_end)
+    {
+        power_stats.wakes_by_timer++;
+    }
+
+    if (deepsleep)
+    {
+        power_stats.deepsleep_us += slept_us;
+        sim_syspm_exit(CY_SYSPM_DEEPSLEEP);
+        /* The scheduler resumes from the external flash */
+        sim_pdl_xip_fetch();
+        cycles = sim_tfm_end_cycle();
+        if ((0U != sim_cycle_limit) && (cycles >= sim_cycle_limit))
+        {
+            sim_end_us = sim_time_us();
+        }
+    }
+    else
+    {
+        power_stats.sleep_us += slept_us;
+    }
+
+    /* The idle hook ends the simulation if the end was reached; the report
+     * cannot be taken here with the scheduler suspended. */
+    if (wake_tick > now_tick)
+    {
+        vTaskStepTick((TickType_t)(wake_tick - now_tick));
+    }
+}
+
+/*******************************************************************************
+* Function Name: vApplicationDaemonTaskStartupHook
+********************************************************************************
+* Summary:
+*  Runs once the scheduler has started. The first sleep cycle starts here.
+*
+*******************************************************************************/
+void vApplicationDaemonTaskStartupHook(void)
+{
+    sim_tfm_start_cycles();
+}
+
+/*******************************************************************************
+* Function Name: vApplicationMallocFailedHook
+********************************************************************************
+* Summary:
+*  Stops the simulation when the FreeRTOS heap is exhausted.
+*
+*******************************************************************************/
+void vApplicationMallocFailedHook(void)
+{
+    fprintf(stderr, "FreeRTOS heap exhausted\n");
+    abort();
+}
+
+/* [] END OF FILE */
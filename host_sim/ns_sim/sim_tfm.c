@@ -0,0 +1,798 @@
+/*****************************************************************************
+* File Name        : sim_tfm.c
+*
+* Description      : Stand-in for the TF-M side of the POSIX simulation. psa_call()
+*                    from the non-secure application is dispatched to the real
+*                    POWER_MANAGER partition code (power_manager_mngr.c), and the
+*                    platform log service writes to stdout. Every secure call is
+*                    recorded with its SID, type, vector sizes and simulated
+*                    cost, and checked against a budget per sleep cycle.
+*
+* Related Document : See docs/host_simulation.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cybsp.h"
+#include "cy_pdl.h"
+#include "tfm_ns_interface.h"
+#include "os_wrapper/common.h"
+#include "ifx_platform_api.h"
+#include "psa/client.h"
+#include "psa/service.h"
+#include "psa/internal_trusted_storage.h"
+#include "psa_manifest/sid.h"
+#include "psa_manifest/power_manager.h"
+#include "power_manager_defs.h"
+
+#include "sim.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Message handle passed to the partition for the call in progress */
+#define SIM_MSG_HANDLE      ((psa_handle_t)1)
+
+/* Client ID of the CM33 NS application, as given by the TrustZone NS agent */
+#define SIM_CM33_CLIENT_ID  (-1)
+
+#define ASCII_ESC           (0x1B)
+
+#define NSEC_PER_USEC       (1000U)
+
+/* Internal Trusted Storage: assets and maximum asset size */
+#define SIM_ITS_ASSETS      (4U)
+#define SIM_ITS_ASSET_SIZE  (256U)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/* State generation of the POWER_MANAGER partition, read by the NS side cache */
+volatile uint32_t sim_power_manager_gen = 0U;
+
+/* Vectors of the call in progress, accessed by psa_read() and psa_write() */
+static const psa_invec *call_in_vec = NULL;
+static size_t call_in_len = 0U;
+static psa_outvec *call_out_vec = NULL;
+static size_t call_out_len = 0U;
+
+static psa_signal_t irq_enabled = 0U;
+static bool ns_interface_ready = false;
+
+/* NS client of the calls, and the NS mailbox used by the CM55 client */
+static int32_t call_client_id = SIM_CM33_CLIENT_ID;
+static bool mailbox_ready = false;
+static uint32_t mailbox_calls = 0U;
+
+/* Secure call instrumentation */
+static uint32_t call_base_us = SIM_PSA_CALL_BASE_US_DEFAULT;
+static sim_psa_budget_t call_budget = { 0U, 0U };
+static FILE *call_trace = NULL;
+static sim_psa_stats_t psa_stats;
+static uint32_t cycle_calls = 0U;
+static uint32_t cycle_bytes = 0U;
+static uint32_t cycle_cost_us = 0U;
+
+static bool log_quiet = false;
+static bool log_line_start = true;
+
+/* Internal Trusted Storage, kept in a file across runs if one is given */
+typedef struct
+{
+    uint64_t uid;
+    uint32_t len;
+    uint8_t data[SIM_ITS_ASSET_SIZE];
+} sim_its_asset_t;
+
+static sim_its_asset_t its_assets[SIM_ITS_ASSETS];
+static const char *its_path = NULL;
+static sim_its_stats_t its_stats;
+
+/*******************************************************************************
+* Function Name: panic
+********************************************************************************
+* Summary:
+*  Stops the simulation on a programming error that TF-M would answer with a
+*  panic of the caller.
+*
+*******************************************************************************/
+static void panic(const char *reason)
+{
+    fprintf(stderr, "TF-M panic: %s\n", reason);
+    abort();
+}
+
+/*******************************************************************************
+* Function Name: sim_tfm_init
+********************************************************************************
+* Summary:
+*  Runs the partition initialization, as the SPM does before it starts the
+*  non-secure image. The secure BSP has configured the USER BTN1 and BTN2
+*  pins for edge interrupts at that point.
+*
+*******************************************************************************/
+void sim_tfm_init(void)
+{
+    Cy_GPIO_SetInterruptMask(CYBSP_USER_BTN1_PORT, CYBSP_USER_BTN1_PIN, 1UL);
+    Cy_GPIO_SetInterruptMask(CYBSP_USER_BTN2_PORT, CYBSP_USER_BTN2_PIN, 1UL);
+    (void)power_manager_init();
+}
+
+/*******************************************************************************
+* Function Name: is_mailbox_client
+********************************************************************************
+* Summary:
+*  Returns true if the calls come from CM55 through the NS mailbox.
+*
+*******************************************************************************/
+static bool is_mailbox_client(void)
+{
+    return (call_client_id >= POWER_MANAGER_CM55_CLIENT_ID_MIN) &&
+           (call_client_id <= POWER_MANAGER_CM55_CLIENT_ID_MAX);
+}
+
+int32_t tfm_ns_interface_init(void)
+{
+    if (is_mailbox_client())
+    {
+        mailbox_ready = true;
+    }
+    else
+    {
+        ns_interface_ready = true;
+    }
+    return OS_WRAPPER_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: handle_to_sid
+********************************************************************************
+* Summary:
+*  Returns the SID of the service behind a stateless handle.
+*
+*******************************************************************************/
+static uint32_t handle_to_sid(psa_handle_t handle)
+{
+    return (POWER_MANAGER_SERVICE_HANDLE == handle) ? POWER_MANAGER_SERVICE_SID
+                                                    : 0U;
+}
+
+/*******************************************************************************
+* Function Name: record_call
+********************************************************************************
+* Summary:
+*  Adds a secure call to the totals, the current sleep cycle and the trace.
+*  The UART state reads of the log transport are log traffic, like the
+*  platform log calls they pace, and are not part of the sleep cycle.
+*
+*******************************************************************************/
+static void record_call(const sim_psa_call_t *call)
+{
+    sim_psa_op_stats_t *op = NULL;
+    uint32_t i;
+
+    for (i = 0U; i < psa_stats.op_count; i++)
+    {
+        if ((psa_stats.ops[i].sid == call->sid) &&
+            (psa_stats.ops[i].type == call->type))
+        {
+            op = &psa_stats.ops[i];
+            break;
+        }
+    }
+    if ((NULL == op) && (psa_stats.op_count < SIM_PSA_MAX_OPS))
+    {
+        op = &psa_stats.ops[psa_stats.op_count++];
+        op->sid = call->sid;
+        op->type = call->type;
+    }
+    if (NULL != op)
+    {
+        op->calls++;
+        op->in_bytes += call->in_bytes;
+        op->out_bytes += call->out_bytes;
+        op->cost_us += call->cost_us;
+    }
+
+    psa_stats.calls++;
+    psa_stats.bytes += (uint64_t)call->in_bytes + call->out_bytes;
+    psa_stats.cost_us += call->cost_us;
+    if (POWER_MANAGER_GET_LOG_TX != call->type)
+    {
+        cycle_calls++;
+        cycle_bytes += call->in_bytes + call->out_bytes;
+        cycle_cost_us += call->cost_us;
+    }
+    else
+    {
+        psa_stats.log_calls++;
+    }
+
+    if (NULL != call_trace)
+    {
+        fprintf(call_trace, "%llu,0x%08lx,%ld,%lu,%lu,%lu,%lu,%lu,%ld\n",
+                (unsigned long long)call->time_us, (unsigned long)call->sid,
+                (long)call->type, (unsigned long)call->in_len,
+                (unsigned long)call->in_bytes, (unsigned long)call->out_len,
+                (unsigned long)call->out_bytes, (unsigned long)call->cost_us,
+                (long)call->status);
+    }
+}
+
+/*******************************************************************************
+* Function Name: psa_call
+********************************************************************************
+* Summary:
+*  Calls the POWER_MANAGER service function with the message built from the
+*  vectors. The call runs to completion on the caller's thread, like an SFN
+*  partition call does. The simulated cost of the call, during which NS
+*  interrupts are masked on the device, is spent as a busy wait and the call
+*  is recorded.
+*
+*  Calls of the CM55 client arrive through the NS mailbox. They run in the
+*  SPE without the CM33 NS application, so they take no time of its timeline
+*  and are only counted.
+*
+*******************************************************************************/
+psa_status_t psa_call(psa_handle_t handle, int32_t type,
+                      const psa_invec *in_vec, size_t in_len,
+                      psa_outvec *out_vec, size_t out_len)
+{
+    psa_msg_t msg;
+    psa_status_t status;
+    sim_psa_call_t call;
+    bool mailbox = is_mailbox_client();
+    size_t i;
+
+    if (!(mailbox ? mailbox_ready : ns_interface_ready))
+    {
+        panic("psa_call before tfm_ns_interface_init");
+    }
+
+    /* The TF-M NS interface is fetched from the external flash */
+    if (!mailbox)
+    {
+        sim_pdl_xip_fetch();
+    }
+    if ((type < PSA_IPC_CALL) || ((in_len + out_len) > PSA_MAX_IOVEC))
+    {
+        panic("invalid psa_call parameters");
+    }
+
+    memset(&call, 0, sizeof(call));
+    call.time_us = sim_time_us();
+    call.sid = handle_to_sid(handle);
+    call.type = type;
+    call.in_len = (uint32_t)in_len;
+    call.out_len = (uint32_t)out_len;
+
+    memset(&msg, 0, sizeof(msg));
+    msg.type = type;
+    msg.handle = SIM_MSG_HANDLE;
+    msg.client_id = call_client_id;
+    for (i = 0U; i < in_len; i++)
+    {
+        msg.in_size[i] = in_vec[i].len;
+        call.in_bytes += (uint32_t)in_vec[i].len;
+    }
+    for (i = 0U; i < out_len; i++)
+    {
+        msg.out_size[i] = out_vec[i].len;
+        call.out_bytes += (uint32_t)out_vec[i].len;
+    }
+    call.cost_us = call_base_us +
+        (((call.in_bytes + call.out_bytes) * SIM_PSA_CALL_NS_PER_BYTE) /
+         NSEC_PER_USEC);
+
+    if (POWER_MANAGER_SERVICE_HANDLE != handle)
+    {
+        call.status = PSA_ERROR_CONNECTION_REFUSED;
+        if (!mailbox)
+        {
+            record_call(&call);
+        }
+        return call.status;
+    }
+
+    call_in_vec = in_vec;
+    call_in_len = in_len;
+    call_out_vec = out_vec;
+    call_out_len = out_len;
+
+    status = power_manager_service_sfn(&msg);
+
+    call_in_vec = NULL;
+    call_in_len = 0U;
+    call_out_vec = NULL;
+    call_out_len = 0U;
+
+    if (mailbox)
+    {
+        mailbox_calls++;
+        return status;
+    }
+
+    sim_time_busy_wait_us(call.cost_us);
+    call.status = status;
+    record_call(&call);
+
+    return status;
+}
+
+/*******************************************************************************
+* Function Name: sim_tfm_set_client_id
+********************************************************************************
+* Summary:
+*  Sets the NS client ID of the following calls and returns the previous one.
+*  The CM55 model sets an ID of the mailbox NS agent around its calls.
+*
+*******************************************************************************/
+int32_t sim_tfm_set_client_id(int32_t client_id)
+{
+    int32_t previous = call_client_id;
+
+    call_client_id = client_id;
+    return previous;
+}
+
+/*******************************************************************************
+* Function Name: sim_tfm_get_mailbox_calls
+********************************************************************************
+* Summary:
+*  Returns the number of calls made through the NS mailbox.
+*
+*******************************************************************************/
+uint32_t sim_tfm_get_mailbox_calls(void)
+{
+    return mailbox_calls;
+}
+
+/*******************************************************************************
+* Function Name: sim_tfm_set_call_cost
+********************************************************************************
+* Summary:
+*  Sets the fixed part of the simulated cost of a secure call.
+*
+*******************************************************************************/
+void sim_tfm_set_call_cost(uint32_t base_us)
+{
+    call_base_us = base_us;
+}
+
+/*******************************************************************************
+* Function Name: sim_tfm_set_budget
+********************************************************************************
+* Summary:
+*  Sets the secure call budget that is checked at the end of every sleep
+*  cycle.
+*
+*******************************************************************************/
+void sim_tfm_set_budget(const sim_psa_budget_t *budget)
+{
+    call_budget = *budget;
+}
+
+/*******************************************************************************
+* Function Name: sim_tfm_set_trace
+********************************************************************************
+* Summary:
+*  Writes every secure call as a CSV line to the given file. The header line
+*  is written at once.
+*
+*******************************************************************************/
+void sim_tfm_set_trace(FILE *trace)
+{
+    call_trace = trace;
+    if (NULL != call_trace)
+    {
+        fprintf(call_trace, "time_us,sid,type,in_len,in_bytes,out_len,"
+                            "out_bytes,cost_us,status\n");
+    }
+}
+
+/*******************************************************************************
+* Function Name: sim_tfm_start_cycles
+********************************************************************************
+* Summary:
+*  Starts the first sleep cycle. The secure calls made before are start-up
+*  calls, which the budget does not cover.
+*
+*******************************************************************************/
+void sim_tfm_start_cycles(void)
+{
+    psa_stats.startup_calls = cycle_calls;
+    psa_stats.startup_bytes = cycle_bytes;
+    cycle_calls = 0U;
+    cycle_bytes = 0U;
+    cycle_cost_us = 0U;
+}
+
+/*******************************************************************************
+* Function Name: sim_tfm_end_cycle
+********************************************************************************
+* Summary:
+*  Closes a sleep cycle: checks the secure calls made since the previous
+*  DeepSleep exit against the budget and starts the next cycle.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t - number of completed sleep cycles
+*
+*******************************************************************************/
+uint32_t sim_tfm_end_cycle(void)
+{
+    psa_stats.cycles++;
+
+    if (cycle_calls > psa_stats.max_cycle_calls)
+    {
+        psa_stats.max_cycle_calls = cycle_calls;
+    }
+    if (cycle_bytes > psa_stats.max_cycle_bytes)
+    {
+        psa_stats.max_cycle_bytes = cycle_bytes;
+    }
+    if (cycle_cost_us > psa_stats.max_cycle_cost_us)
+    {
+        psa_stats.max_cycle_cost_us = cycle_cost_us;
+    }
+
+    if (((0U != call_budget.max_calls) && (cycle_calls > call_budget.max_calls)) ||
+        ((0U != call_budget.max_bytes) && (cycle_bytes > call_budget.max_bytes)))
+    {
+        if (0U == psa_stats.over_budget_cycles)
+        {
+            psa_stats.first_over_budget_cycle = psa_stats.cycles;
+        }
+        psa_stats.over_budget_cycles++;
+    }
+
+    cycle_calls = 0U;
+    cycle_bytes = 0U;
+    cycle_cost_us = 0U;
+
+    return psa_stats.cycles;
+}
+
+/*******************************************************************************
+* Function Name: sim_tfm_get_psa_stats
+********************************************************************************
+* Summary:
+*  Returns the secure call statistics.
+*
+*******************************************************************************/
+void sim_tfm_get_psa_stats(sim_psa_stats_t *stats)
+{
+    *stats = psa_stats;
+}
+
+size_t psa_read(psa_handle_t msg_handle, uint32_t invec_idx,
+                void *buffer, size_t num_bytes)
+{
+    size_t len;
+
+    if ((SIM_MSG_HANDLE != msg_handle) || (invec_idx >= call_in_len))
+    {
+        panic("psa_read outside of the call");
+    }
+
+    len = call_in_vec[invec_idx].len;
+    if (num_bytes < len)
+    {
+        len = num_bytes;
+    }
+    memcpy(buffer, call_in_vec[invec_idx].base, len);
+    return len;
+}
+
+void psa_write(psa_handle_t msg_handle, uint32_t outvec_idx,
+               const void *buffer, size_t num_bytes)
+{
+    if ((SIM_MSG_HANDLE != msg_handle) || (outvec_idx >= call_out_len))
+    {
+        panic("psa_write outside of the call");
+    }
+    if (num_bytes > call_out_vec[outvec_idx].len)
+    {
+        panic("psa_write overflows the output vector");
+    }
+    memcpy(call_out_vec[outvec_idx].base, buffer, num_bytes);
+}
+
+void psa_irq_enable(psa_signal_t irq_signal)
+{
+    irq_enabled |= irq_signal;
+}
+
+psa_irq_status_t psa_irq_disable(psa_signal_t irq_signal)
+{
+    psa_irq_status_t was_enabled = (0U != (irq_enabled & irq_signal)) ? 1U : 0U;
+
+    irq_enabled &= ~irq_signal;
+    return was_enabled;
+}
+
+/*******************************************************************************
+* Function Name: sim_tfm_set_its_file
+********************************************************************************
+* Summary:
+*  Keeps the Internal Trusted Storage in a file, so that a run starts with
+*  the assets of the previous one. The file is read now if it exists and
+*  written after every change.
+*
+* Return:
+*  bool - false if the file exists but cannot be read
+*
+*******************************************************************************/
+bool sim_tfm_set_its_file(const char *path)
+{
+    FILE *file = fopen(path, "rb");
+    bool ok = true;
+
+    its_path = path;
+    if (NULL != file)
+    {
+        ok = (1U == fread(its_assets, sizeof(its_assets), 1U, file));
+        fclose(file);
+    }
+
+    return ok;
+}
+
+/*******************************************************************************
+* Function Name: sim_tfm_get_its_stats
+********************************************************************************
+* Summary:
+*  Returns the Internal Trusted Storage write statistics.
+*
+*******************************************************************************/
+void sim_tfm_get_its_stats(sim_its_stats_t *stats)
+{
+    *stats = its_stats;
+}
+
+static sim_its_asset_t *its_find(psa_storage_uid_t uid)
+{
+    uint32_t i;
+
+    for (i = 0U; i < SIM_ITS_ASSETS; i++)
+    {
+        if ((0U != its_assets[i].len) && (uid == its_assets[i].uid))
+        {
+            return &its_assets[i];
+        }
+    }
+
+    return NULL;
+}
+
+psa_status_t psa_its_set(psa_storage_uid_t uid, size_t data_length,
+                         const void *p_data,
+                         psa_storage_create_flags_t create_flags)
+{
+    sim_its_asset_t *asset = its_find(uid);
+    FILE *file;
+    uint32_t i;
+
+    if ((0U == uid) || (0U == data_length) || (data_length > SIM_ITS_ASSET_SIZE) ||
+        (PSA_STORAGE_FLAG_NONE != create_flags))
+    {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+    for (i = 0U; (NULL == asset) && (i < SIM_ITS_ASSETS); i++)
+    {
+        if (0U == its_assets[i].len)
+        {
+            asset = &its_assets[i];
+        }
+    }
+    if (NULL == asset)
+    {
+        return PSA_ERROR_INSUFFICIENT_STORAGE;
+    }
+
+    asset->uid = uid;
+    asset->len = (uint32_t)data_length;
+    memcpy(asset->data, p_data, data_length);
+    its_stats.writes++;
+    its_stats.bytes += data_length;
+
+    if (NULL != its_path)
+    {
+        file = fopen(its_path, "wb");
+        if ((NULL == file) || (1U != fwrite(its_assets, sizeof(its_assets), 1U, file)))
+        {
+            if (NULL != file)
+            {
+                fclose(file);
+            }
+            return PSA_ERROR_STORAGE_FAILURE;
+        }
+        fclose(file);
+    }
+
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_its_get(psa_storage_uid_t uid, size_t data_offset,
+                         size_t data_size, void *p_data,
+                         size_t *p_data_length)
+{
+    const sim_its_asset_t *asset = its_find(uid);
+    size_t len;
+
+    if (NULL == asset)
+    {
+        return PSA_ERROR_DOES_NOT_EXIST;
+    }
+    if (data_offset > asset->len)
+    {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+
+    len = asset->len - data_offset;
+    if (len > data_size)
+    {
+        len = data_size;
+    }
+    memcpy(p_data, &asset->data[data_offset], len);
+    *p_data_length = len;
+
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_its_remove(psa_storage_uid_t uid)
+{
+    sim_its_asset_t *asset = its_find(uid);
+
+    if (NULL == asset)
+    {
+        return PSA_ERROR_DOES_NOT_EXIST;
+    }
+    asset->len = 0U;
+
+    return PSA_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: sim_tfm_raise_irq
+********************************************************************************
+* Summary:
+*  Raises a secure interrupt. The first level handler of the partition runs
+*  at once if the partition has enabled the interrupt, and the state
+*  generation is incremented as by the SPM interrupt handlers. The interrupt
+*  wakes the CM55 client too.
+*
+* Parameters:
+*  irq_signal - interrupt signal from the partition manifest
+*
+* Return:
+*  bool - true if the handler ran
+*
+*******************************************************************************/
+bool sim_tfm_raise_irq(psa_signal_t irq_signal)
+{
+    if (0U == (irq_enabled & irq_signal))
+    {
+        return false;
+    }
+
+    /* CM55 wake-ups before this one see the state before the interrupt */
+    sim_cm55_run_due(sim_time_us());
+    sim_pdl_secure_handler();
+
+    if (USER_BTN1_INTERRUPT_SIGNAL == irq_signal)
+    {
+        (void)user_btn1_interrupt_flih();
+        sim_gpio_apply_w1c(CYBSP_USER_BTN1_PORT);
+        POWER_MANAGER_GEN++;
+        sim_cm55_event();
+        return true;
+    }
+
+    if (RTC_ALARM_INTERRUPT_SIGNAL == irq_signal)
+    {
+        (void)rtc_alarm_interrupt_flih();
+        POWER_MANAGER_GEN++;
+        sim_cm55_event();
+        return true;
+    }
+
+    return false;
+}
+
+/*******************************************************************************
+* Function Name: sim_tfm_set_quiet
+********************************************************************************
+* Summary:
+*  Suppresses the log output of the application.
+*
+*******************************************************************************/
+void sim_tfm_set_quiet(bool quiet)
+{
+    log_quiet = quiet;
+}
+
+/*******************************************************************************
+* Function Name: ifx_platform_log_msg
+********************************************************************************
+* Summary:
+*  Writes a log message to stdout. Every line starts with the virtual time in
+*  seconds; carriage returns and ANSI escape sequences are dropped. The time
+*  the SPE waits for TX FIFO space is spent as busy time after the message.
+*
+*******************************************************************************/
+int32_t ifx_platform_log_msg(const uint8_t *msg, uint32_t msg_size)
+{
+    uint32_t i = 0U;
+    uint64_t now_us;
+    uint64_t cost_us = SIM_LOG_CALL_BASE_US + sim_pdl_uart_write(msg_size);
+
+    if (log_quiet)
+    {
+        sim_time_busy_wait_us(cost_us);
+        return (int32_t)msg_size;
+    }
+
+    while (i < msg_size)
+    {
+        if (ASCII_ESC == msg[i])
+        {
+            /* Skip up to and including the final letter of the sequence */
+            for (i++; (i < msg_size) &&
+                      !(((msg[i] >= 'A') && (msg[i] <= 'Z')) ||
+                        ((msg[i] >= 'a') && (msg[i] <= 'z'))); i++)
+            {
+            }
+            i++;
+            continue;
+        }
+        if ('\r' != msg[i])
+        {
+            if (log_line_start)
+            {
+                now_us = sim_time_us();
+                printf("[%6lu.%03lu] ", (unsigned long)(now_us / 1000000U),
+                       (unsigned long)((now_us / 1000U) % 1000U));
+                log_line_start = false;
+            }
+            putchar(msg[i]);
+            if ('\n' == msg[i])
+            {
+                log_line_start = true;
+            }
+        }
+        i++;
+    }
+
+    sim_time_busy_wait_us(cost_us);
+    return (int32_t)msg_size;
+}
+
+/* [] END OF FILE */
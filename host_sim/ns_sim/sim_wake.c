@@ -0,0 +1,486 @@
+/*****************************************************************************
+* File Name        : sim_wake.c
+*
+* Description      : Wake injection of the POSIX simulation. Generates USER BTN1
+*                    presses from a periodic and a random source, optionally as
+*                    bursts of interrupts, replays the button presses of a
+*                    recorded timeline, and delivers them to the secure
+*                    interrupt handler.
+*
+* Related Document : See docs/host_simulation.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+
+#include <math.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "cybsp.h"
+#include "cy_pdl.h"
+#include "psa_manifest/power_manager.h"
+#include "power_manager_defs.h"
+
+#include "wake_recorder.h"
+#include "sim.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+#define USEC_PER_MSEC       (1000ULL)
+#define NSEC_PER_SEC        (1000000000ULL)
+
+/* Longest timeline line read */
+#define TIMELINE_LINE_MAX   (256U)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+static sim_wake_config_t wake_config;
+static uint64_t next_periodic_us = SIM_TIME_NEVER;
+static uint64_t next_random_us = SIM_TIME_NEVER;
+static uint64_t next_burst_us = SIM_TIME_NEVER;
+static uint32_t burst_left = 0U;
+static uint32_t rng_state = 1U;
+static uint32_t wake_count = 0U;
+static uint32_t wake_delivered = 0U;
+
+/* Button presses of a recorded timeline, in time order */
+typedef struct
+{
+    uint64_t time_us;
+    uint32_t pins;
+} replay_press_t;
+
+static replay_press_t *replay_presses = NULL;
+static uint32_t replay_count = 0U;
+static uint32_t replay_next = 0U;
+
+/*******************************************************************************
+* Function Name: rng_next
+********************************************************************************
+* Summary:
+*  xorshift32 generator, so that a seed gives the same wake times on every
+*  host.
+*
+*******************************************************************************/
+static uint32_t rng_next(void)
+{
+    rng_state ^= rng_state << 13U;
+    rng_state ^= rng_state >> 17U;
+    rng_state ^= rng_state << 5U;
+    return rng_state;
+}
+
+/*******************************************************************************
+* Function Name: random_interval_us
+********************************************************************************
+* Summary:
+*  Draws an exponentially distributed interval (Poisson arrivals) with the
+*  configured mean. The interval is at least one microsecond.
+*
+*******************************************************************************/
+static uint64_t random_interval_us(void)
+{
+    double u = ((double)rng_next() + 1.0) / 4294967297.0;
+    double interval = -log(u) * (double)wake_config.random_mean_ms *
+                      (double)USEC_PER_MSEC;
+
+    return (interval < 1.0) ? 1U : (uint64_t)interval;
+}
+
+/*******************************************************************************
+* Function Name: sim_wake_init
+********************************************************************************
+* Summary:
+*  Sets up the wake sources. The first periodic wake comes after first_ms,
+*  or after one period if first_ms is 0. A burst length of 0 is taken as 1.
+*
+* Parameters:
+*  config - wake injection configuration
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void sim_wake_init(const sim_wake_config_t *config)
+{
+    wake_config = *config;
+    if (0U == wake_config.burst_len)
+    {
+        wake_config.burst_len = 1U;
+    }
+    wake_count = 0U;
+    wake_delivered = 0U;
+    next_burst_us = SIM_TIME_NEVER;
+    burst_left = 0U;
+    rng_state = (0U != config->seed) ? config->seed : 1U;
+
+    next_periodic_us = SIM_TIME_NEVER;
+    if (0U != config->period_ms)
+    {
+        next_periodic_us = ((0U != config->first_ms) ? config->first_ms
+                                                     : config->period_ms) *
+                           USEC_PER_MSEC;
+    }
+
+    next_random_us = SIM_TIME_NEVER;
+    if (0U != config->random_mean_ms)
+    {
+        next_random_us = random_interval_us();
+    }
+}
+
+/*******************************************************************************
+* Function Name: sim_wake_next_us
+********************************************************************************
+* Summary:
+*  Returns the virtual time of the next wake event.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint64_t - time in microseconds, SIM_TIME_NEVER if none is scheduled
+*
+*******************************************************************************/
+uint64_t sim_wake_next_us(void)
+{
+    uint64_t next = (next_periodic_us < next_random_us) ? next_periodic_us
+                                                        : next_random_us;
+    uint64_t replay_us = (replay_next < replay_count) ?
+                         replay_presses[replay_next].time_us : SIM_TIME_NEVER;
+
+    next = (next_burst_us < next) ? next_burst_us : next;
+    return (replay_us < next) ? replay_us : next;
+}
+
+/*******************************************************************************
+* Function Name: replay_add
+********************************************************************************
+* Summary:
+*  Appends a replayed press with the pins of the button wake-up sources.
+*
+* Return:
+*  bool - false if out of memory
+*
+*******************************************************************************/
+static bool replay_add(uint64_t time_us, uint32_t sources)
+{
+    replay_press_t *presses;
+    uint32_t pins = 0U;
+
+    if (0U != (sources & WAKEUP_SOURCE_USER_BTN1))
+    {
+        pins |= 1UL << CYBSP_USER_BTN1_PIN;
+    }
+    if (0U != (sources & WAKEUP_SOURCE_USER_BTN2))
+    {
+        pins |= 1UL << CYBSP_USER_BTN2_PIN;
+    }
+    if (0U == pins)
+    {
+        return true;
+    }
+
+    presses = realloc(replay_presses, (replay_count + 1U) * sizeof(*presses));
+    if (NULL == presses)
+    {
+        return false;
+    }
+    replay_presses = presses;
+    replay_presses[replay_count].time_us = time_us;
+    replay_presses[replay_count].pins = pins;
+    replay_count++;
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: sim_wake_load_timeline
+********************************************************************************
+* Summary:
+*  Reads a timeline of the wake recorder and replays its button wake-ups: a
+*  press of the buttons of each wake-up with USER BTN1 or BTN2 among its
+*  sources, at the recorded time. Wake-ups by the secure timer or without a
+*  source are not replayed, the application under test makes its own. Lines
+*  without the WAKE_RECORDER_TAG word are skipped, so a whole log can be
+*  read. The times must not go back: a timeline covers one start-up.
+*
+* Parameters:
+*  path     - timeline file
+*  recorded - totals of the timeline, zeroed first
+*
+* Return:
+*  bool - false if the file cannot be read or has an invalid line
+*
+*******************************************************************************/
+bool sim_wake_load_timeline(const char *path, wake_recorder_summary_t *recorded)
+{
+    char line[TIMELINE_LINE_MAX];
+    char word[16];
+    const char *tag;
+    wake_recorder_record_t record;
+    unsigned long time_ms;
+    long value;
+    uint32_t line_no = 0U;
+    uint32_t type;
+    bool ok = true;
+    int fields;
+    FILE *file = fopen(path, "r");
+
+    if (NULL == file)
+    {
+        perror(path);
+        return false;
+    }
+
+    memset(recorded, 0, sizeof(*recorded));
+    while (ok && (NULL != fgets(line, sizeof(line), file)))
+    {
+        line_no++;
+        tag = strstr(line, WAKE_RECORDER_TAG " ");
+        if ((NULL == tag) || ('#' == line[0]))
+        {
+            continue;
+        }
+
+        value = 0U;
+        fields = sscanf(tag + sizeof(WAKE_RECORDER_TAG), "%lu %15s %li",
+                        &time_ms, word, &value);
+        for (type = 0U; type < WAKE_RECORDER_TYPES; type++)
+        {
+            if ((fields >= 2) && (0 == strcmp(word, wake_recorder_type_name(type))))
+            {
+                break;
+            }
+        }
+        if ((type == WAKE_RECORDER_TYPES) ||
+            ((fields < 3) && (WAKE_RECORDER_SLEEP != type)) ||
+            (time_ms > UINT32_MAX) || (value < 0) ||
+            ((unsigned long)value > WAKE_RECORDER_VALUE_MAX) ||
+            ((0U != recorded->records + recorded->lost) && (time_ms < recorded->end_ms)))
+        {
+            fprintf(stderr, "%s:%lu: not a timeline line of this build\n",
+                    path, (unsigned long)line_no);
+            ok = false;
+            break;
+        }
+
+        record.time_ms = (uint32_t)time_ms;
+        record.type_value = WAKE_RECORDER_PACK(type, (uint32_t)value);
+        wake_recorder_account(recorded, &record);
+        if (WAKE_RECORDER_WAKE == type)
+        {
+            ok = replay_add((uint64_t)time_ms * USEC_PER_MSEC, (uint32_t)value);
+        }
+    }
+
+    fclose(file);
+    return ok;
+}
+
+/*******************************************************************************
+* Function Name: port_interrupt
+********************************************************************************
+* Summary:
+*  Latches edges on pins of the USER BTN1 port and runs the secure GPIO
+*  handler of power_manager_interrupts.c, which only calls the partition if a
+*  pin that the partition has not masked is pending.
+*
+* Parameters:
+*  pins - bitfield of the pins with an edge
+*
+* Return:
+*  bool - true if the partition handler ran
+*
+*******************************************************************************/
+static bool port_interrupt(uint32_t pins)
+{
+    CYBSP_USER_BTN1_PORT->INTR |= pins;
+    if (0UL == GPIO_PRT_INTR_MASKED(CYBSP_USER_BTN1_PORT))
+    {
+        return false;
+    }
+
+    return sim_tfm_raise_irq(USER_BTN1_INTERRUPT_SIGNAL);
+}
+
+/*******************************************************************************
+* Function Name: sim_wake_fire_due
+********************************************************************************
+* Summary:
+*  Delivers all wake events due at the given time to the secure interrupt
+*  handler and schedules the next ones. A press that comes while a burst is
+*  still running starts a new burst.
+*
+* Parameters:
+*  now_us - current virtual time
+*
+* Return:
+*  uint32_t - number of events that reached the secure interrupt handler
+*
+*******************************************************************************/
+uint32_t sim_wake_fire_due(uint64_t now_us)
+{
+    uint32_t fired = 0U;
+    uint32_t delivered = 0U;
+    uint32_t pins;
+    uint64_t event_us;
+
+    while (sim_wake_next_us() <= now_us)
+    {
+        event_us = sim_wake_next_us();
+        pins = 1UL << CYBSP_USER_BTN1_PIN;
+        if ((replay_next < replay_count) &&
+            (replay_presses[replay_next].time_us == event_us))
+        {
+            /* A replayed press is a single interrupt */
+            pins = replay_presses[replay_next].pins;
+            replay_next++;
+        }
+        else
+        {
+            if (next_burst_us == event_us)
+            {
+                burst_left--;
+            }
+            else
+            {
+                if (next_periodic_us == event_us)
+                {
+                    next_periodic_us += wake_config.period_ms * USEC_PER_MSEC;
+                }
+                else
+                {
+                    next_random_us += random_interval_us();
+                }
+                burst_left = wake_config.burst_len - 1U;
+            }
+            next_burst_us = (0U != burst_left) ?
+                            (event_us + wake_config.burst_gap_us) : SIM_TIME_NEVER;
+        }
+
+        if (port_interrupt(pins))
+        {
+            delivered++;
+        }
+        fired++;
+    }
+
+    wake_count += fired;
+    wake_delivered += delivered;
+    return delivered;
+}
+
+/*******************************************************************************
+* Function Name: sim_wake_get_count
+********************************************************************************
+* Summary:
+*  Returns the number of wake events injected so far.
+*
+*******************************************************************************/
+uint32_t sim_wake_get_count(void)
+{
+    return wake_count;
+}
+
+/*******************************************************************************
+* Function Name: sim_wake_get_delivered
+********************************************************************************
+* Summary:
+*  Returns the number of wake events that reached the secure interrupt
+*  handler, i.e. that came while the partition had the pin unmasked and the
+*  interrupt enabled.
+*
+*******************************************************************************/
+uint32_t sim_wake_get_delivered(void)
+{
+    return wake_delivered;
+}
+
+/*******************************************************************************
+* Function Name: sim_wake_bench_demux
+********************************************************************************
+* Summary:
+*  Measures the host time of the secure GPIO interrupt with edges on several
+*  pins of the USER BTN1 port at once: USER BTN1, then USER BTN2, then the
+*  other pins of the port, which are enabled for interrupts for the
+*  measurement. With all pins, the edge of the glitch filter is pending as
+*  well.
+*
+* Parameters:
+*  pin_count - pins with an edge per interrupt, 1 to CY_GPIO_PINS_MAX
+*  runs      - number of interrupts
+*
+* Return:
+*  uint64_t - mean time per interrupt in nanoseconds
+*
+*******************************************************************************/
+uint64_t sim_wake_bench_demux(uint32_t pin_count, uint32_t runs)
+{
+    GPIO_PRT_Type *port = CYBSP_USER_BTN1_PORT;
+    uint32_t saved_mask = port->INTR_MASK;
+    uint32_t pins = 1UL << CYBSP_USER_BTN1_PIN;
+    uint32_t count = 1U;
+    uint32_t pin;
+    uint32_t run;
+    struct timespec start;
+    struct timespec end;
+
+    if ((pin_count > 1U) && (CYBSP_USER_BTN2_PIN != CYBSP_USER_BTN1_PIN))
+    {
+        pins |= 1UL << CYBSP_USER_BTN2_PIN;
+        count++;
+    }
+    for (pin = 0U; (pin < CY_GPIO_PINS_MAX) && (count < pin_count); pin++)
+    {
+        if (0U == (pins & (1UL << pin)))
+        {
+            pins |= 1UL << pin;
+            count++;
+        }
+    }
+    if (pin_count >= CY_GPIO_PINS_MAX)
+    {
+        pins |= GPIO_PRT_INTR_FLT_EDGE_Msk;
+    }
+    port->INTR_MASK |= pins;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (run = 0U; run < runs; run++)
+    {
+        (void)port_interrupt(pins);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    port->INTR_MASK = saved_mask;
+
+    return ((uint64_t)(end.tv_sec - start.tv_sec) * NSEC_PER_SEC +
+            (uint64_t)end.tv_nsec - (uint64_t)start.tv_nsec) / ((0U != runs) ? runs : 1U);
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,320 @@
+/*****************************************************************************
+* File Name        : retention_report.c
+*
+* Description      : Host tool that maps the memory regions of design.modus
+*                    and the RAM sections of a built image to the SRAM macros
+*                    or SOCMEM partitions through the retention map, and
+*                    reports which of them keep their contents in DeepSleep,
+*                    and the size and, if characterized, the retention
+*                    current of the others.
+*
+* Related Document : See README.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "retention_map.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+#define LINE_BUFFER_SIZE        (256)
+#define SYMBOL_NAME_SIZE        (64)
+
+/* Address of SRAM0 in the memory map of the CM33 non-secure image, as in
+ * sram_retention.h */
+#define DEFAULT_SRAM_BASE       (0x24000000UL)
+
+/* Address of SOCMEM in the memory map of the CM55 image, as in
+ * socmem_retention.h */
+#define DEFAULT_SOCMEM_BASE     (0x26000000UL)
+
+#define SECTION_COUNT           (sizeof(sections) / sizeof(sections[0]))
+
+/*******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+/* RAM section of the image, bounded by two linker script symbols */
+typedef struct
+{
+    const char *name;
+    const char *start_symbol;
+    const char *end_symbol;
+    uint32_t start;
+    uint32_t end;
+    uint32_t found;             /* bit 0: start found, bit 1: end found */
+} section_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/* The sections sram_retention.c and socmem_retention.c register by default */
+static section_t sections[] =
+{
+    { "vectors", "__ram_vectors_start__", "__ram_vectors_end__", 0U, 0U, 0U },
+    { "data",    "__data_start__",        "__bss_end__",         0U, 0U, 0U },
+    { "heap",    "__HeapBase",            "__HeapLimit",         0U, 0U, 0U },
+    { "stack",   "__StackLimit",          "__StackTop",          0U, 0U, 0U }
+};
+
+/*******************************************************************************
+* Function Name: read_symbols
+********************************************************************************
+* Summary:
+*  Reads the section bounds from a symbol listing in the format of nm:
+*  "<address> <type> <name>" per line.
+*
+* Parameters:
+*  listing - symbol listing
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void read_symbols(FILE *listing)
+{
+    char line[LINE_BUFFER_SIZE];
+    char name[SYMBOL_NAME_SIZE];
+    char type;
+    unsigned long addr;
+    uint32_t i;
+
+    while (NULL != fgets(line, sizeof(line), listing))
+    {
+        if (('#' == line[0]) ||
+            (3 != sscanf(line, "%lx %c %63s", &addr, &type, name)))
+        {
+            continue;
+        }
+        for (i = 0U; i < SECTION_COUNT; i++)
+        {
+            if (0 == strcmp(name, sections[i].start_symbol))
+            {
+                sections[i].start = (uint32_t)addr;
+                sections[i].found |= 1U;
+            }
+            if (0 == strcmp(name, sections[i].end_symbol))
+            {
+                sections[i].end = (uint32_t)addr;
+                sections[i].found |= 2U;
+            }
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: print_macros
+********************************************************************************
+* Summary:
+*  Prints a macro mask as a list of macro numbers.
+*
+* Parameters:
+*  mask - macro mask
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void print_macros(uint32_t mask)
+{
+    uint32_t macro;
+    const char *sep = "";
+
+    if (0U == mask)
+    {
+        printf("-");
+    }
+    for (macro = 0U; macro < RETENTION_MAP_MAX_MACROS; macro++)
+    {
+        if (0U != (mask & (1UL << macro)))
+        {
+            printf("%s%lu", sep, (unsigned long)macro);
+            sep = ",";
+        }
+    }
+    printf("\n");
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Parses the arguments, reads the symbol listing and prints the report.
+*  The exit status is 1 if a section of the image is missing from the
+*  listing.
+*
+*******************************************************************************/
+int main(int argc, char *argv[])
+{
+    const retention_memory_t *memory = &retention_map_sram;
+    retention_extent_t extents[SECTION_COUNT];
+    uint32_t extent_count = 0U;
+    uint32_t base = 0U;
+    uint32_t all;
+    uint32_t keep;
+    uint32_t off;
+    uint32_t macro_kb;
+    uint32_t total_na;
+    uint32_t saved_na;
+    const char *path = NULL;
+    FILE *listing;
+    int missing = 0;
+    int i;
+    uint32_t j;
+    uint32_t k;
+
+    for (i = 1; i < argc; i++)
+    {
+        if ((0 == strcmp(argv[i], "-m")) && ((i + 1) < argc))
+        {
+            i++;
+            if (0 == strcmp(argv[i], "socmem"))
+            {
+                memory = &retention_map_socmem;
+            }
+            else if (0 != strcmp(argv[i], "sram"))
+            {
+                path = NULL;
+                break;
+            }
+        }
+        else if ((0 == strcmp(argv[i], "-b")) && ((i + 1) < argc))
+        {
+            base = (uint32_t)strtoul(argv[++i], NULL, 0);
+        }
+        else
+        {
+            path = argv[i];
+        }
+    }
+
+    if (NULL == path)
+    {
+        fprintf(stderr, "usage: %s [-m sram|socmem] [-b base] <symbols|->\n",
+                argv[0]);
+        return 2;
+    }
+    if (0U == base)
+    {
+        base = (memory == &retention_map_sram) ? DEFAULT_SRAM_BASE :
+                                                 DEFAULT_SOCMEM_BASE;
+    }
+
+    listing = (0 == strcmp(path, "-")) ? stdin : fopen(path, "r");
+    if (NULL == listing)
+    {
+        perror(path);
+        return 2;
+    }
+    read_symbols(listing);
+    if (stdin != listing)
+    {
+        fclose(listing);
+    }
+
+    /* Sections outside of the memory, e.g. in the TCM, map to no macro */
+    for (j = 0U; j < SECTION_COUNT; j++)
+    {
+        if (3U != sections[j].found)
+        {
+            fprintf(stderr, "section %s: %s or %s missing\n", sections[j].name,
+                    sections[j].start_symbol, sections[j].end_symbol);
+            missing = 1;
+            continue;
+        }
+        extents[extent_count].name = sections[j].name;
+        extents[extent_count].offset = sections[j].start - base;
+        extents[extent_count].size = sections[j].end - sections[j].start;
+        extent_count++;
+    }
+
+    macro_kb = memory->macro_size / 1024U;
+    all = retention_map_all_macros(memory);
+    keep = retention_map_keep_mask(memory, extents, extent_count);
+    off = all & ~keep;
+    total_na = retention_map_leakage_na(memory, all);
+    saved_na = retention_map_leakage_na(memory, off);
+
+    if (0U != memory->leakage_na_per_kb)
+    {
+        printf("%s: %lu macros of %lu KB, %lu nA/KB in DeepSleep\n\n", memory->name,
+               (unsigned long)memory->macro_count, (unsigned long)macro_kb,
+               (unsigned long)memory->leakage_na_per_kb);
+    }
+    else
+    {
+        printf("%s: %lu macros of %lu KB, retention current not characterized\n\n",
+               memory->name, (unsigned long)memory->macro_count,
+               (unsigned long)macro_kb);
+    }
+
+    printf("%-28s %10s %10s %-6s %s\n", "region", "offset", "size", "keep", "macros");
+    for (j = 0U; j < memory->region_count; j++)
+    {
+        const retention_region_t *region = &memory->regions[j];
+
+        printf("%-28s 0x%08lx 0x%08lx %-6s ", region->name,
+               (unsigned long)region->offset, (unsigned long)region->size,
+               region->keep ? "yes" : "used");
+        print_macros(retention_map_range_macros(memory, region->offset,
+                                                region->size));
+    }
+
+    if (0U != extent_count)
+    {
+        printf("\n%-28s %10s %10s %-6s %s\n", "section", "offset", "size", "", "macros");
+        for (k = 0U; k < extent_count; k++)
+        {
+            printf("%-28s 0x%08lx 0x%08lx %-6s ", extents[k].name,
+                   (unsigned long)extents[k].offset, (unsigned long)extents[k].size, "");
+            print_macros(retention_map_range_macros(memory, extents[k].offset,
+                                                    extents[k].size));
+        }
+    }
+
+    printf("\nretained in DeepSleep : ");
+    print_macros(keep & all);
+    printf("off in DeepSleep      : ");
+    print_macros(off);
+    printf("\n%lu of %lu KB off, %lu KB retained",
+           (unsigned long)retention_map_kb(memory, off),
+           (unsigned long)retention_map_kb(memory, all),
+           (unsigned long)retention_map_kb(memory, keep & all));
+    if (0U != total_na)
+    {
+        printf(", retention current %lu nA instead of %lu nA (%lu nA saved)",
+               (unsigned long)(total_na - saved_na), (unsigned long)total_na,
+               (unsigned long)saved_na);
+    }
+    printf("\n");
+
+    return missing;
+}
+
+/* [] END OF FILE */
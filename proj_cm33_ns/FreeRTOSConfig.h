@@ -104,7 +104,7 @@ when application makefile has VFP_SELECT configured as softfloat */
 
 /* Hook function related definitions. */
 #define configUSE_IDLE_HOOK                     0
-#define configUSE_TICK_HOOK                     0
+#define configUSE_TICK_HOOK                     1
 #define configCHECK_FOR_STACK_OVERFLOW          2
 #define configUSE_MALLOC_FAILED_HOOK            1
 #define configUSE_DAEMON_TASK_STARTUP_HOOK      0
@@ -202,11 +202,19 @@ standard names - or at least those used in the unmodified vector table. */
  * The Low Power Assistant library provides additional portable configuration layer
  * for low-power features supported by the PSoC 6 devices:
  * https://github.com/Infineon/lpa
+ * tickless_idle_sleep() (tickless_idle.c) bounds the idle time to the LPTimer
+ * span and counts overflow wakes before it calls vApplicationSleep().
  */
 extern void vApplicationSleep( uint32_t xExpectedIdleTime );
-#define portSUPPRESS_TICKS_AND_SLEEP( xIdleTime ) vApplicationSleep( xIdleTime )
+extern void tickless_idle_sleep( uint32_t expected_idle_ticks );
+#define portSUPPRESS_TICKS_AND_SLEEP( xIdleTime ) tickless_idle_sleep( xIdleTime )
 #define configUSE_TICKLESS_IDLE                 2
 
+/* deferred_work_pre_sleep() (deferred_work.c) runs the queued background jobs
+ * as one batch instead of a sleep that is long enough for DeepSleep. */
+extern void deferred_work_pre_sleep( uint32_t *expected_idle_ticks );
+#define configPRE_SLEEP_PROCESSING( x )         deferred_work_pre_sleep( &( x ) )
+
 #else
 #define configUSE_TICKLESS_IDLE                 0
 #endif
@@ -0,0 +1,52 @@
+/*****************************************************************************
+* File Name        : app_state.h
+*
+* Description      : This file contains the application states of the CM33
+*                    non-secure application
+*
+* Related Document : See README.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+#ifndef APP_STATE_H
+#define APP_STATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+/* App States */
+typedef enum
+{
+    APP_STATE_ACTIVE = 1U,
+    APP_STATE_IDLE = 2U,
+    APP_STATE_HIBERNATE = 3U
+} en_app_state_t;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* APP_STATE_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,253 @@
+/*****************************************************************************
+* File Name        : cm55_power.c
+*
+* Description      : This source file implements on-demand power control of
+*                    the CM55 core from the CM33 non-secure application
+*
+* Related Document : See README.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+
+#include "cybsp.h"
+#include "cy_pdl.h"
+
+#include "cm55_boot_status.h"
+#include "cm55_power.h"
+#include "pd_manager.h"
+#include "energy_monitor.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* The timeout value in microseconds used to wait for CM55 core to be booted */
+#define CM55_BOOT_WAIT_TIME_USEC (10U)
+
+/* App boot address for CM55 project */
+#define CM55_APP_BOOT_ADDR (CYMEM_CM33_0_m55_nvm_START + \
+                            CYBSP_MCUBOOT_HEADER_SIZE)
+
+/* Time given to CM55 to run its startup code and report ready */
+#define CM55_READY_TIMEOUT_USEC  (500000U)
+#define CM55_READY_POLL_USEC     (5U)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+static cm55_power_state_t cm55_state = CM55_POWER_STATE_OFF;
+static uint32_t cm55_off_threshold_ms = CM55_POWER_OFF_THRESHOLD_MS_DEFAULT;
+static cm55_power_stats_t cm55_stats;
+
+/*******************************************************************************
+* Function Name: cm55_power_init
+********************************************************************************
+* Summary:
+*  Initializes the CM55 power control. CM55 is not booted until the first
+*  call to cm55_power_on().
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cm55_power_init(void)
+{
+    cm55_state = CM55_POWER_STATE_OFF;
+    CM55_BOOT_STATUS.ready = CM55_BOOT_STATUS_NOT_READY;
+    CM55_BOOT_STATUS.boot_count = 0U;
+    CM55_BOOT_STATUS.main_to_ready_cycles = 0U;
+    perf_stat_reset(&cm55_stats.cold_start);
+}
+
+/*******************************************************************************
+* Function Name: cm55_power_on
+********************************************************************************
+* Summary:
+*  Acquires the CM55 power domain, releases the core from reset and waits
+*  until the CM55 application reports ready through the boot status record
+*  in SRAM. The time from the request to ready is recorded as the cold start
+*  latency.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  cy_rslt_t - CY_RSLT_SUCCESS or CM55_POWER_RSLT_ERR_BOOT_TIMEOUT
+*
+*******************************************************************************/
+cy_rslt_t cm55_power_on(void)
+{
+    uint32_t start;
+    uint32_t waited_usec = 0U;
+
+    if (CM55_POWER_STATE_ON == cm55_state)
+    {
+        return CY_RSLT_SUCCESS;
+    }
+
+    CM55_BOOT_STATUS.ready = CM55_BOOT_STATUS_NOT_READY;
+    start = perf_counter_get();
+
+    /* PD1 stays on while other users, e.g. of SOCMEM, hold a reference */
+    pd_manager_acquire(PD_DOMAIN_PD1);
+
+    Cy_SysEnableCM55(MXCM55, CM55_APP_BOOT_ADDR, CM55_BOOT_WAIT_TIME_USEC);
+
+    while (CM55_BOOT_STATUS_READY != CM55_BOOT_STATUS.ready)
+    {
+        if (waited_usec >= CM55_READY_TIMEOUT_USEC)
+        {
+            cm55_stats.boot_timeouts++;
+            Cy_SysDisableCM55(MXCM55, CM55_BOOT_WAIT_TIME_USEC);
+            pd_manager_release(PD_DOMAIN_PD1);
+            return CM55_POWER_RSLT_ERR_BOOT_TIMEOUT;
+        }
+        Cy_SysLib_DelayUs(CM55_READY_POLL_USEC);
+        waited_usec += CM55_READY_POLL_USEC;
+    }
+
+    perf_stat_add(&cm55_stats.cold_start, perf_counter_get() - start);
+    cm55_stats.main_to_ready_cycles = CM55_BOOT_STATUS.main_to_ready_cycles;
+    cm55_state = CM55_POWER_STATE_ON;
+
+    energy_monitor_add_transition(ENERGY_TRANSITION_CM55_BOOT);
+    energy_monitor_set_load(ENERGY_LOAD_CM55, true);
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: cm55_power_off
+********************************************************************************
+* Summary:
+*  Holds CM55 in reset and drops its reference on the CM55 power domain,
+*  which is powered down unless another user holds it. CM55 keeps no state
+*  across this transition, the next cm55_power_on() is a cold start.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cm55_power_off(void)
+{
+    if (CM55_POWER_STATE_ON != cm55_state)
+    {
+        return;
+    }
+
+    CM55_BOOT_STATUS.ready = CM55_BOOT_STATUS_NOT_READY;
+    Cy_SysDisableCM55(MXCM55, CM55_BOOT_WAIT_TIME_USEC);
+    pd_manager_release(PD_DOMAIN_PD1);
+
+    cm55_stats.off_count++;
+    cm55_state = CM55_POWER_STATE_OFF;
+
+    energy_monitor_set_load(ENERGY_LOAD_CM55, false);
+}
+
+/*******************************************************************************
+* Function Name: cm55_power_idle
+********************************************************************************
+* Summary:
+*  Chooses between power-off and DeepSleep for an idle CM55. CM55 enters
+*  DeepSleep on its own when it has nothing to do, so only the power-off
+*  decision needs an action here.
+*
+* Parameters:
+*  next_job_ms - expected time until the next CM55 job, or
+*                CM55_NEXT_JOB_UNKNOWN
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cm55_power_idle(uint32_t next_job_ms)
+{
+    if ((CM55_POWER_STATE_ON == cm55_state) &&
+        (next_job_ms >= cm55_off_threshold_ms))
+    {
+        cm55_power_off();
+    }
+}
+
+/*******************************************************************************
+* Function Name: cm55_power_set_off_threshold
+********************************************************************************
+* Summary:
+*  Sets the expected idle time from which CM55 is powered off.
+*
+* Parameters:
+*  threshold_ms - power-off threshold in milliseconds
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cm55_power_set_off_threshold(uint32_t threshold_ms)
+{
+    cm55_off_threshold_ms = threshold_ms;
+}
+
+/*******************************************************************************
+* Function Name: cm55_power_get_state
+********************************************************************************
+* Summary:
+*  Returns the current CM55 power state.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  cm55_power_state_t - current state
+*
+*******************************************************************************/
+cm55_power_state_t cm55_power_get_state(void)
+{
+    return cm55_state;
+}
+
+/*******************************************************************************
+* Function Name: cm55_power_get_stats
+********************************************************************************
+* Summary:
+*  Copies the CM55 power statistics.
+*
+* Parameters:
+*  stats - destination of the statistics
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cm55_power_get_stats(cm55_power_stats_t *stats)
+{
+    *stats = cm55_stats;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,117 @@
+/*****************************************************************************
+* File Name        : cm55_power.h
+*
+* Description      : This file contains the interface used by the CM33
+*                    non-secure application to power the CM55 core on and
+*                    off on demand
+*
+* Related Document : See README.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+#ifndef CM55_POWER_H
+#define CM55_POWER_H
+
+#include <stdint.h>
+#include "cy_result.h"
+#include "perf_counter.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Passed to cm55_power_idle() when the time until the next job is unknown */
+#define CM55_NEXT_JOB_UNKNOWN               (UINT32_MAX)
+
+/* Default expected idle time from which CM55 is powered off instead of being
+ * left in DeepSleep. Below it, a cold start costs more time and energy than
+ * the DeepSleep leakage of the CM55 power domain saves. */
+#define CM55_POWER_OFF_THRESHOLD_MS_DEFAULT (1000U)
+
+/* CM55 did not report ready within the boot timeout */
+#define CM55_POWER_RSLT_ERR_BOOT_TIMEOUT    \
+    (CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_MIDDLEWARE_BASE, 1U))
+
+/*******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+/* CM55 power states */
+typedef enum
+{
+    CM55_POWER_STATE_OFF = 0U,  /* Core held in reset, power domain off */
+    CM55_POWER_STATE_ON  = 1U   /* Core running or in its own DeepSleep */
+} cm55_power_state_t;
+
+/* CM55 power statistics */
+typedef struct
+{
+    /* CM33 cycles from the boot request to CM55 ready, including the CM55
+     * startup code (TCM and cache init) */
+    perf_stat_t cold_start;
+
+    /* CM55 cycles from CM55 main() to ready, for the last cold start */
+    uint32_t main_to_ready_cycles;
+
+    /* Number of power-off transitions */
+    uint32_t off_count;
+
+    /* Number of boot requests that timed out */
+    uint32_t boot_timeouts;
+} cm55_power_stats_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+/* Initializes the CM55 power control. CM55 is left off. */
+void cm55_power_init(void);
+
+/* Boots CM55 and waits until it reports ready. Returns immediately if CM55
+ * is already on. */
+cy_rslt_t cm55_power_on(void);
+
+/* Holds CM55 in reset and releases its power domain */
+void cm55_power_off(void);
+
+/* Applies the idle policy: powers CM55 off when the expected time until the
+ * next CM55 job is at least the power-off threshold, otherwise leaves it in
+ * DeepSleep. */
+void cm55_power_idle(uint32_t next_job_ms);
+
+/* Sets the power-off threshold of the idle policy in milliseconds */
+void cm55_power_set_off_threshold(uint32_t threshold_ms);
+
+/* Returns the current CM55 power state */
+cm55_power_state_t cm55_power_get_state(void);
+
+/* Copies the CM55 power statistics */
+void cm55_power_get_stats(cm55_power_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CM55_POWER_H */
+
+/* [] END OF FILE */
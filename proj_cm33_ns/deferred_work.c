@@ -0,0 +1,322 @@
+/*****************************************************************************
+* File Name        : deferred_work.c
+*
+* Description      : This source file implements the deferred work service.
+*                    Queued jobs run in one batch in a low priority task,
+*                    started by the pre-sleep hook of tickless idle or by the
+*                    earliest job deadline.
+*
+* Related Document : See README.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+
+#include <string.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "cy_pdl.h"
+#include "deferred_work.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Just above the idle task, below all application tasks */
+#define DEFERRED_WORK_TASK_PRIORITY     (tskIDLE_PRIORITY + 1U)
+#define DEFERRED_WORK_TASK_STACK_SIZE   (1024U)
+
+/* Idle time from which tickless idle enters DeepSleep */
+#if defined(CY_CFG_PWR_DEEPSLEEP_LATENCY)
+#define DEFERRED_WORK_DEEPSLEEP_TICKS   (pdMS_TO_TICKS(CY_CFG_PWR_DEEPSLEEP_LATENCY))
+#else
+#define DEFERRED_WORK_DEEPSLEEP_TICKS   (0U)
+#endif
+
+/*******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+typedef struct
+{
+    deferred_work_fn_t fn;
+    void *arg;
+    TickType_t deadline;
+} deferred_job_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+static TaskHandle_t deferred_task = NULL;
+
+/* Queued jobs, in submission order */
+static deferred_job_t deferred_jobs[DEFERRED_WORK_MAX_JOBS];
+static uint32_t deferred_count = 0U;
+
+/* Set by the pre-sleep hook, cleared by the task when it takes the batch */
+static volatile bool deferred_sleep_pending = false;
+
+static deferred_work_stats_t deferred_stats;
+
+/*******************************************************************************
+* Function Name: deferred_work_take
+********************************************************************************
+* Summary:
+*  Takes all queued jobs if the system is about to sleep or a deadline has
+*  passed, otherwise returns the ticks until the earliest deadline.
+*
+* Parameters:
+*  batch - destination of the jobs
+*  count - number of jobs taken, 0 if the batch is not due
+*
+* Return:
+*  TickType_t - ticks to wait for the next batch
+*
+*******************************************************************************/
+static TickType_t deferred_work_take(deferred_job_t *batch, uint32_t *count)
+{
+    TickType_t now = xTaskGetTickCount();
+    TickType_t wait = portMAX_DELAY;
+    TickType_t left;
+    bool sleep = false;
+    bool due = false;
+    uint32_t intr_state;
+    uint32_t i;
+
+    intr_state = Cy_SysLib_EnterCriticalSection();
+    for (i = 0U; i < deferred_count; i++)
+    {
+        left = deferred_jobs[i].deadline - now;
+        if ((0U == left) || (left > portMAX_DELAY / 2U))
+        {
+            due = true;
+        }
+        else if (left < wait)
+        {
+            wait = left;
+        }
+    }
+    sleep = deferred_sleep_pending;
+    deferred_sleep_pending = false;
+
+    *count = 0U;
+    if ((0U != deferred_count) && (sleep || due))
+    {
+        *count = deferred_count;
+        memcpy(batch, deferred_jobs, deferred_count * sizeof(deferred_jobs[0]));
+        deferred_count = 0U;
+        if (sleep)
+        {
+            deferred_stats.sleep_batches++;
+        }
+        else
+        {
+            deferred_stats.deadline_batches++;
+        }
+        deferred_stats.jobs_run += *count;
+        if (*count > deferred_stats.max_batch)
+        {
+            deferred_stats.max_batch = *count;
+        }
+        wait = portMAX_DELAY;
+    }
+    Cy_SysLib_ExitCriticalSection(intr_state);
+
+    return wait;
+}
+
+/*******************************************************************************
+* Function Name: deferred_work_task
+********************************************************************************
+* Summary:
+*  Runs the queued jobs as one batch when the pre-sleep hook asks for it or
+*  when the earliest deadline has passed.
+*
+* Parameters:
+*  pvParameters - unused
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void deferred_work_task(void *pvParameters)
+{
+    deferred_job_t batch[DEFERRED_WORK_MAX_JOBS];
+    TickType_t wait;
+    uint32_t count;
+    uint32_t i;
+
+    CY_UNUSED_PARAMETER(pvParameters);
+
+    for (;;)
+    {
+        wait = deferred_work_take(batch, &count);
+        for (i = 0U; i < count; i++)
+        {
+            batch[i].fn(batch[i].arg);
+        }
+        if (0U == count)
+        {
+            (void)ulTaskNotifyTake(pdTRUE, wait);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: deferred_work_init
+********************************************************************************
+* Summary:
+*  Clears the queue and creates the deferred work task.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  bool - false if the task could not be created
+*
+*******************************************************************************/
+bool deferred_work_init(void)
+{
+    deferred_count = 0U;
+    deferred_sleep_pending = false;
+    memset(&deferred_stats, 0, sizeof(deferred_stats));
+
+    return (pdPASS == xTaskCreate(deferred_work_task, "Deferred",
+                                  DEFERRED_WORK_TASK_STACK_SIZE, NULL,
+                                  DEFERRED_WORK_TASK_PRIORITY, &deferred_task));
+}
+
+/*******************************************************************************
+* Function Name: deferred_work_submit
+********************************************************************************
+* Summary:
+*  Queues a job. A job with the same function and argument that is already
+*  queued keeps its place and the earlier of both deadlines.
+*
+* Parameters:
+*  fn          - job function
+*  arg         - argument of the job function
+*  deadline_ms - latest start of the job from now
+*
+* Return:
+*  bool - false if the queue is full
+*
+*******************************************************************************/
+bool deferred_work_submit(deferred_work_fn_t fn, void *arg,
+                          uint32_t deadline_ms)
+{
+    TickType_t now = xTaskGetTickCount();
+    TickType_t deadline = now + pdMS_TO_TICKS(deadline_ms);
+    bool queued = true;
+    uint32_t intr_state;
+    uint32_t i;
+
+    intr_state = Cy_SysLib_EnterCriticalSection();
+    deferred_stats.submitted++;
+    for (i = 0U; i < deferred_count; i++)
+    {
+        if ((fn == deferred_jobs[i].fn) && (arg == deferred_jobs[i].arg))
+        {
+            break;
+        }
+    }
+    if (i < deferred_count)
+    {
+        if ((TickType_t)(deadline - now) < (TickType_t)(deferred_jobs[i].deadline - now))
+        {
+            deferred_jobs[i].deadline = deadline;
+        }
+        deferred_stats.coalesced++;
+    }
+    else if (deferred_count < DEFERRED_WORK_MAX_JOBS)
+    {
+        deferred_jobs[deferred_count].fn = fn;
+        deferred_jobs[deferred_count].arg = arg;
+        deferred_jobs[deferred_count].deadline = deadline;
+        deferred_count++;
+    }
+    else
+    {
+        deferred_stats.rejected++;
+        queued = false;
+    }
+    Cy_SysLib_ExitCriticalSection(intr_state);
+
+    /* Let the task wait for the new earliest deadline */
+    if (queued && (NULL != deferred_task))
+    {
+        xTaskNotifyGive(deferred_task);
+    }
+
+    return queued;
+}
+
+/*******************************************************************************
+* Function Name: deferred_work_pre_sleep
+********************************************************************************
+* Summary:
+*  Starts the batch instead of a sleep that is long enough for DeepSleep.
+*  Idle times too short for DeepSleep leave the jobs queued.
+*
+* Parameters:
+*  expected_idle_ticks - idle time, set to 0 to skip the sleep
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void deferred_work_pre_sleep(uint32_t *expected_idle_ticks)
+{
+    if ((0U != deferred_count) && (NULL != deferred_task) &&
+        (*expected_idle_ticks > DEFERRED_WORK_DEEPSLEEP_TICKS))
+    {
+        deferred_sleep_pending = true;
+        xTaskNotifyGive(deferred_task);
+        *expected_idle_ticks = 0U;
+    }
+}
+
+/*******************************************************************************
+* Function Name: deferred_work_get_stats
+********************************************************************************
+* Summary:
+*  Returns a copy of the statistics.
+*
+* Parameters:
+*  stats - destination
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void deferred_work_get_stats(deferred_work_stats_t *stats)
+{
+    uint32_t intr_state = Cy_SysLib_EnterCriticalSection();
+
+    *stats = deferred_stats;
+    Cy_SysLib_ExitCriticalSection(intr_state);
+}
+
+/* [] END OF FILE */
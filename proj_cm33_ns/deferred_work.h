@@ -0,0 +1,96 @@
+/*****************************************************************************
+* File Name        : deferred_work.h
+*
+* Description      : This file contains the interface of the deferred work
+*                    service. Low priority background jobs are queued and run
+*                    as one batch just before the system enters DeepSleep,
+*                    or at their deadline if the system stays busy.
+*
+* Related Document : See README.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+
+#ifndef DEFERRED_WORK_H
+#define DEFERRED_WORK_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Maximum number of queued jobs */
+#define DEFERRED_WORK_MAX_JOBS          (8U)
+
+/*******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+/* Job function. Runs in the deferred work task at the lowest application
+ * priority; it may block and make secure calls. */
+typedef void (*deferred_work_fn_t)(void *arg);
+
+/* Deferred work statistics */
+typedef struct
+{
+    uint32_t submitted;
+    uint32_t coalesced;         /* submissions merged into a queued job */
+    uint32_t rejected;          /* submissions with the queue full */
+    uint32_t jobs_run;
+    uint32_t sleep_batches;     /* batches run before a DeepSleep entry */
+    uint32_t deadline_batches;  /* batches run at a deadline */
+    uint32_t max_batch;         /* most jobs in one batch */
+} deferred_work_stats_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+/* Creates the deferred work task. Call before the scheduler starts. */
+bool deferred_work_init(void);
+
+/* Queues a job that runs before the next DeepSleep entry, at the latest
+ * deadline_ms from now. A job with the same function and argument that is
+ * already queued is not queued again; it keeps the earlier deadline. Call
+ * from a task. */
+bool deferred_work_submit(deferred_work_fn_t fn, void *arg,
+                          uint32_t deadline_ms);
+
+/* Pre-sleep hook, called through configPRE_SLEEP_PROCESSING() by the idle
+ * task with the scheduler suspended. If jobs are queued and the idle time is
+ * long enough for DeepSleep, it starts the batch and sets the idle time to 0,
+ * which skips this sleep. */
+void deferred_work_pre_sleep(uint32_t *expected_idle_ticks);
+
+/* Returns a copy of the statistics */
+void deferred_work_get_stats(deferred_work_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DEFERRED_WORK_H */
+
+/* [] END OF FILE */
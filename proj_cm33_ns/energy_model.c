@@ -0,0 +1,400 @@
+/*****************************************************************************
+* File Name        : energy_model.c
+*
+* Description      : This source file implements the energy model and the
+*                    residency tracker used by the on-device energy monitor
+*                    and the host energy replay tool
+*
+* Related Document : See README.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+
+#include <stddef.h>
+#include <string.h>
+#include "energy_model.h"
+#include "wake_path.h"
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+const energy_model_t energy_model_default =
+{
+    .supply_mv = 1800U,
+    .state_current_ua =
+    {
+        [ENERGY_STATE_HP]        = 18000U,
+        [ENERGY_STATE_LP]        = 7500U,
+        [ENERGY_STATE_ULP]       = 2800U,
+        [ENERGY_STATE_DEEPSLEEP] = 25U
+    },
+    .load_current_ua =
+    {
+        [ENERGY_LOAD_CM55] = 120U,
+        [ENERGY_LOAD_LED1] = 1500U,
+        [ENERGY_LOAD_LED2] = 1500U
+    },
+    .transition_energy_nj =
+    {
+        [ENERGY_TRANSITION_DEEPSLEEP] = 15000U,
+        [ENERGY_TRANSITION_PERF_MODE] = 2000U,
+        [ENERGY_TRANSITION_CM55_BOOT] = 60000U
+    }
+};
+
+/*******************************************************************************
+* Function Name: energy_model_charge_to_nj
+********************************************************************************
+* Summary:
+*  Converts a current flowing for a time into energy.
+*
+* Parameters:
+*  current_ua - current in microamperes
+*  time_us    - time in microseconds
+*  supply_mv  - supply voltage in millivolts
+*
+* Return:
+*  uint64_t - energy in nanojoules
+*
+*******************************************************************************/
+static uint64_t energy_model_charge_to_nj(uint32_t current_ua, uint64_t time_us,
+                                          uint32_t supply_mv)
+{
+    /* uA * us = pC, pC * mV = fJ; scaled in two steps to avoid overflow */
+    return (((uint64_t)current_ua * time_us) / 1000U) * supply_mv / 1000U;
+}
+
+/*******************************************************************************
+* Function Name: energy_model_estimate
+********************************************************************************
+* Summary:
+*  Computes the energy of an account with a model.
+*
+* Parameters:
+*  model    - energy model
+*  account  - residency counters
+*  estimate - resulting estimate
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void energy_model_estimate(const energy_model_t *model,
+                           const energy_account_t *account,
+                           energy_estimate_t *estimate)
+{
+    uint32_t i;
+
+    memset(estimate, 0, sizeof(*estimate));
+
+    for (i = 0U; i < (uint32_t)ENERGY_STATE_COUNT; i++)
+    {
+        estimate->duration_us += account->state_us[i];
+        estimate->state_nj[i] = energy_model_charge_to_nj(
+                                    model->state_current_ua[i],
+                                    account->state_us[i], model->supply_mv);
+        estimate->total_nj += estimate->state_nj[i];
+    }
+
+    for (i = 0U; i < (uint32_t)ENERGY_LOAD_COUNT; i++)
+    {
+        estimate->load_nj[i] = energy_model_charge_to_nj(
+                                    model->load_current_ua[i],
+                                    account->load_us[i], model->supply_mv);
+        estimate->total_nj += estimate->load_nj[i];
+    }
+
+    for (i = 0U; i < (uint32_t)ENERGY_TRANSITION_COUNT; i++)
+    {
+        estimate->transition_nj[i] = (uint64_t)account->transitions[i] *
+                                     model->transition_energy_nj[i];
+        estimate->total_nj += estimate->transition_nj[i];
+    }
+
+    if ((0U != estimate->duration_us) && (0U != model->supply_mv))
+    {
+        /* nJ * 1e6 / mV = uA * us */
+        estimate->average_ua = (uint32_t)((estimate->total_nj * 1000000U /
+                                           model->supply_mv) /
+                                          estimate->duration_us);
+    }
+}
+
+/*******************************************************************************
+* Function Name: energy_model_battery_life_hours
+********************************************************************************
+* Summary:
+*  Returns the battery life for a workload that repeats the estimate.
+*
+* Parameters:
+*  estimate     - energy estimate
+*  capacity_mah - battery capacity in milliampere-hours
+*
+* Return:
+*  uint32_t - battery life in hours, 0 if the estimate is empty
+*
+*******************************************************************************/
+uint32_t energy_model_battery_life_hours(const energy_estimate_t *estimate,
+                                         uint32_t capacity_mah)
+{
+    if (0U == estimate->average_ua)
+    {
+        return 0U;
+    }
+
+    return (uint32_t)(((uint64_t)capacity_mah * 1000U) / estimate->average_ua);
+}
+
+/*******************************************************************************
+* Function Name: energy_model_state_name
+********************************************************************************
+* Summary:
+*  Returns the name of a state.
+*
+* Parameters:
+*  state - power state
+*
+* Return:
+*  const char* - state name
+*
+*******************************************************************************/
+const char *energy_model_state_name(energy_state_t state)
+{
+    static const char *const names[ENERGY_STATE_COUNT] =
+    {
+        "HP", "LP", "ULP", "DEEPSLEEP"
+    };
+
+    return ((uint32_t)state < (uint32_t)ENERGY_STATE_COUNT) ? names[state] : "?";
+}
+
+/*******************************************************************************
+* Function Name: energy_model_load_name
+********************************************************************************
+* Summary:
+*  Returns the name of a load.
+*
+* Parameters:
+*  load - load
+*
+* Return:
+*  const char* - load name
+*
+*******************************************************************************/
+const char *energy_model_load_name(energy_load_t load)
+{
+    static const char *const names[ENERGY_LOAD_COUNT] =
+    {
+        "CM55", "LED1", "LED2"
+    };
+
+    return ((uint32_t)load < (uint32_t)ENERGY_LOAD_COUNT) ? names[load] : "?";
+}
+
+/*******************************************************************************
+* Function Name: energy_model_transition_name
+********************************************************************************
+* Summary:
+*  Returns the name of a transition.
+*
+* Parameters:
+*  transition - transition
+*
+* Return:
+*  const char* - transition name
+*
+*******************************************************************************/
+const char *energy_model_transition_name(energy_transition_t transition)
+{
+    static const char *const names[ENERGY_TRANSITION_COUNT] =
+    {
+        "DEEPSLEEP", "PERF_MODE", "CM55_BOOT"
+    };
+
+    return ((uint32_t)transition < (uint32_t)ENERGY_TRANSITION_COUNT) ?
+           names[transition] : "?";
+}
+
+/*******************************************************************************
+* Function Name: energy_tracker_init
+********************************************************************************
+* Summary:
+*  Starts tracking in a state with all loads off.
+*
+* Parameters:
+*  tracker - tracker
+*  state   - initial state
+*  now_us  - current time in microseconds
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void energy_tracker_init(energy_tracker_t *tracker, energy_state_t state,
+                         uint64_t now_us)
+{
+    memset(tracker, 0, sizeof(*tracker));
+    tracker->state = state;
+    tracker->last_us = now_us;
+}
+
+/*******************************************************************************
+* Function Name: energy_tracker_update
+********************************************************************************
+* Summary:
+*  Accounts the time since the last update to the current state and to every
+*  load that is on.
+*
+* Parameters:
+*  tracker - tracker
+*  now_us  - current time in microseconds
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+WAKE_PATH_FUNC_BEGIN
+void energy_tracker_update(energy_tracker_t *tracker, uint64_t now_us)
+{
+    uint64_t elapsed_us;
+    uint32_t i;
+
+    if (now_us <= tracker->last_us)
+    {
+        return;
+    }
+
+    elapsed_us = now_us - tracker->last_us;
+    tracker->account.state_us[tracker->state] += elapsed_us;
+    for (i = 0U; i < (uint32_t)ENERGY_LOAD_COUNT; i++)
+    {
+        if (tracker->load_on[i])
+        {
+            tracker->account.load_us[i] += elapsed_us;
+        }
+    }
+    tracker->last_us = now_us;
+}
+WAKE_PATH_FUNC_END
+
+/*******************************************************************************
+* Function Name: energy_tracker_set_state
+********************************************************************************
+* Summary:
+*  Moves the tracker to a new state.
+*
+* Parameters:
+*  tracker - tracker
+*  state   - new state
+*  now_us  - current time in microseconds
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+WAKE_PATH_FUNC_BEGIN
+void energy_tracker_set_state(energy_tracker_t *tracker, energy_state_t state,
+                              uint64_t now_us)
+{
+    energy_tracker_update(tracker, now_us);
+    tracker->state = state;
+}
+WAKE_PATH_FUNC_END
+
+/*******************************************************************************
+* Function Name: energy_tracker_set_load
+********************************************************************************
+* Summary:
+*  Switches a load on or off.
+*
+* Parameters:
+*  tracker - tracker
+*  load    - load
+*  on      - true if the load is switched on
+*  now_us  - current time in microseconds
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+WAKE_PATH_FUNC_BEGIN
+void energy_tracker_set_load(energy_tracker_t *tracker, energy_load_t load,
+                             bool on, uint64_t now_us)
+{
+    energy_tracker_update(tracker, now_us);
+    if ((uint32_t)load < (uint32_t)ENERGY_LOAD_COUNT)
+    {
+        tracker->load_on[load] = on;
+    }
+}
+WAKE_PATH_FUNC_END
+
+/*******************************************************************************
+* Function Name: energy_tracker_add_transition
+********************************************************************************
+* Summary:
+*  Counts a transition.
+*
+* Parameters:
+*  tracker    - tracker
+*  transition - transition
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+WAKE_PATH_FUNC_BEGIN
+void energy_tracker_add_transition(energy_tracker_t *tracker,
+                                   energy_transition_t transition)
+{
+    if ((uint32_t)transition < (uint32_t)ENERGY_TRANSITION_COUNT)
+    {
+        tracker->account.transitions[transition]++;
+    }
+}
+WAKE_PATH_FUNC_END
+
+/*******************************************************************************
+* Function Name: energy_tracker_take
+********************************************************************************
+* Summary:
+*  Copies the account up to now and clears it. State and loads are kept.
+*
+* Parameters:
+*  tracker - tracker
+*  now_us  - current time in microseconds
+*  account - destination of the account
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void energy_tracker_take(energy_tracker_t *tracker, uint64_t now_us,
+                         energy_account_t *account)
+{
+    energy_tracker_update(tracker, now_us);
+    *account = tracker->account;
+    memset(&tracker->account, 0, sizeof(tracker->account));
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,166 @@
+/*****************************************************************************
+* File Name        : energy_model.h
+*
+* Description      : This file contains the energy model of the application:
+*                    current figures per power state and per load, energy
+*                    costs per transition, and the estimator that combines
+*                    them with residency counters. It has no hardware
+*                    dependency so that it is shared with the host tools.
+*
+* Related Document : See README.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+#ifndef ENERGY_MODEL_H
+#define ENERGY_MODEL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+/* System power states. Exactly one is active at any time. */
+typedef enum
+{
+    ENERGY_STATE_HP        = 0U,    /* Running in system HP mode */
+    ENERGY_STATE_LP        = 1U,    /* Running in system LP mode */
+    ENERGY_STATE_ULP       = 2U,    /* Running in system ULP mode */
+    ENERGY_STATE_DEEPSLEEP = 3U,    /* System DeepSleep */
+    ENERGY_STATE_COUNT
+} energy_state_t;
+
+/* Loads whose current adds to the state current while they are on */
+typedef enum
+{
+    ENERGY_LOAD_CM55 = 0U,          /* CM55 core and PD1 powered */
+    ENERGY_LOAD_LED1 = 1U,          /* USER LED1 lit */
+    ENERGY_LOAD_LED2 = 2U,          /* USER LED2 lit */
+    ENERGY_LOAD_COUNT
+} energy_load_t;
+
+/* Transitions with a fixed energy cost */
+typedef enum
+{
+    ENERGY_TRANSITION_DEEPSLEEP = 0U,   /* DeepSleep entry and exit */
+    ENERGY_TRANSITION_PERF_MODE = 1U,   /* One HP/LP/ULP step */
+    ENERGY_TRANSITION_CM55_BOOT = 2U,   /* CM55 cold start */
+    ENERGY_TRANSITION_COUNT
+} energy_transition_t;
+
+/* Energy model: current figures and transition costs */
+typedef struct
+{
+    uint32_t supply_mv;
+    uint32_t state_current_ua[ENERGY_STATE_COUNT];
+    uint32_t load_current_ua[ENERGY_LOAD_COUNT];
+    uint32_t transition_energy_nj[ENERGY_TRANSITION_COUNT];
+} energy_model_t;
+
+/* Residency counters an estimate is computed from */
+typedef struct
+{
+    uint64_t state_us[ENERGY_STATE_COUNT];
+    uint64_t load_us[ENERGY_LOAD_COUNT];
+    uint32_t transitions[ENERGY_TRANSITION_COUNT];
+} energy_account_t;
+
+/* Energy estimate */
+typedef struct
+{
+    uint64_t duration_us;
+    uint64_t state_nj[ENERGY_STATE_COUNT];
+    uint64_t load_nj[ENERGY_LOAD_COUNT];
+    uint64_t transition_nj[ENERGY_TRANSITION_COUNT];
+    uint64_t total_nj;
+    uint32_t average_ua;
+} energy_estimate_t;
+
+/* Tracks the current state and loads and accumulates residency */
+typedef struct
+{
+    energy_account_t account;
+    energy_state_t state;
+    bool load_on[ENERGY_LOAD_COUNT];
+    uint64_t last_us;
+} energy_tracker_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/* Default figures of the application on the evaluation kit. Replace them with
+ * figures measured on the target board. */
+extern const energy_model_t energy_model_default;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+/* Computes the energy of an account */
+void energy_model_estimate(const energy_model_t *model,
+                           const energy_account_t *account,
+                           energy_estimate_t *estimate);
+
+/* Returns the battery life in hours for a workload that repeats the
+ * estimate, or 0 if the estimate is empty */
+uint32_t energy_model_battery_life_hours(const energy_estimate_t *estimate,
+                                         uint32_t capacity_mah);
+
+/* Returns the name of a state, load or transition */
+const char *energy_model_state_name(energy_state_t state);
+const char *energy_model_load_name(energy_load_t load);
+const char *energy_model_transition_name(energy_transition_t transition);
+
+/* Starts tracking in a state at time now_us with all loads off */
+void energy_tracker_init(energy_tracker_t *tracker, energy_state_t state,
+                         uint64_t now_us);
+
+/* Accounts the time up to now_us to the current state and loads */
+void energy_tracker_update(energy_tracker_t *tracker, uint64_t now_us);
+
+/* Moves to a new state at time now_us */
+void energy_tracker_set_state(energy_tracker_t *tracker, energy_state_t state,
+                              uint64_t now_us);
+
+/* Switches a load on or off at time now_us */
+void energy_tracker_set_load(energy_tracker_t *tracker, energy_load_t load,
+                             bool on, uint64_t now_us);
+
+/* Counts a transition */
+void energy_tracker_add_transition(energy_tracker_t *tracker,
+                                   energy_transition_t transition);
+
+/* Accounts the time up to now_us, copies the account and clears it. Used to
+ * compute the energy of one application state cycle. */
+void energy_tracker_take(energy_tracker_t *tracker, uint64_t now_us,
+                         energy_account_t *account);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ENERGY_MODEL_H */
+
+/* [] END OF FILE */
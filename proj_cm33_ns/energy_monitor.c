@@ -0,0 +1,358 @@
+/*****************************************************************************
+* File Name        : energy_monitor.c
+*
+* Description      : This source file implements the on-device energy
+*                    monitor of the CM33 non-secure application
+*
+* Related Document : See README.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+
+#include "cybsp.h"
+#include "cy_pdl.h"
+
+#include "energy_monitor.h"
+#include "wake_path.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* LPTimer counting frequency, the CLK_LF frequency set by the BSP */
+#define ENERGY_MONITOR_LPTIMER_HZ   (32768U)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+static mtb_hal_lptimer_t *energy_lptimer = NULL;
+static energy_tracker_t energy_tracker;
+
+/* Running state to return to after DeepSleep */
+static energy_state_t energy_running_state = ENERGY_STATE_HP;
+static bool energy_in_deepsleep = false;
+
+/* LPTimer extended to 64 bits */
+static uint32_t energy_last_count;
+static uint64_t energy_ticks;
+
+/*******************************************************************************
+* Function Name: energy_monitor_read_ticks
+********************************************************************************
+* Summary:
+*  Reads the LPTimer and extends it to 64 bits. Must be called at least once
+*  per LPTimer wrap period. Called with interrupts masked.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint64_t - LPTimer ticks since energy_monitor_init()
+*
+*******************************************************************************/
+WAKE_PATH_FUNC_BEGIN
+static uint64_t energy_monitor_read_ticks(void)
+{
+    uint32_t count = mtb_hal_lptimer_read(energy_lptimer);
+
+    energy_ticks += (uint32_t)(count - energy_last_count);
+    energy_last_count = count;
+
+    return energy_ticks;
+}
+WAKE_PATH_FUNC_END
+
+/*******************************************************************************
+* Function Name: energy_monitor_now_us
+********************************************************************************
+* Summary:
+*  Returns the monitor time in microseconds. Called with interrupts masked.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint64_t - time in microseconds
+*
+*******************************************************************************/
+WAKE_PATH_FUNC_BEGIN
+static uint64_t energy_monitor_now_us(void)
+{
+    return (energy_monitor_read_ticks() * 1000000U) / ENERGY_MONITOR_LPTIMER_HZ;
+}
+WAKE_PATH_FUNC_END
+
+/*******************************************************************************
+* Function Name: energy_monitor_init
+********************************************************************************
+* Summary:
+*  Starts the monitor in the running state of the boot configuration (HP).
+*
+* Parameters:
+*  lptimer - LPTimer used as time base
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void energy_monitor_init(mtb_hal_lptimer_t *lptimer)
+{
+    uint32_t intr_state = Cy_SysLib_EnterCriticalSection();
+
+    energy_lptimer = lptimer;
+    energy_last_count = mtb_hal_lptimer_read(energy_lptimer);
+    energy_ticks = 0U;
+    energy_running_state = ENERGY_STATE_HP;
+    energy_in_deepsleep = false;
+    energy_tracker_init(&energy_tracker, energy_running_state, 0U);
+
+    Cy_SysLib_ExitCriticalSection(intr_state);
+}
+
+/*******************************************************************************
+* Function Name: energy_monitor_set_perf_mode
+********************************************************************************
+* Summary:
+*  Records a performance mode change and counts the transition.
+*
+* Parameters:
+*  mode - new performance mode
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void energy_monitor_set_perf_mode(perf_mode_t mode)
+{
+    static const energy_state_t states[PERF_MODE_COUNT] =
+    {
+        ENERGY_STATE_ULP,
+        ENERGY_STATE_LP,
+        ENERGY_STATE_HP
+    };
+    uint32_t intr_state;
+
+    if ((NULL == energy_lptimer) || (mode >= PERF_MODE_COUNT))
+    {
+        return;
+    }
+
+    intr_state = Cy_SysLib_EnterCriticalSection();
+    energy_running_state = states[mode];
+    if (!energy_in_deepsleep)
+    {
+        energy_tracker_set_state(&energy_tracker, energy_running_state,
+                                 energy_monitor_now_us());
+    }
+    energy_tracker_add_transition(&energy_tracker, ENERGY_TRANSITION_PERF_MODE);
+    Cy_SysLib_ExitCriticalSection(intr_state);
+}
+
+/*******************************************************************************
+* Function Name: energy_monitor_enter_deepsleep
+********************************************************************************
+* Summary:
+*  Records DeepSleep entry.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+WAKE_PATH_FUNC_BEGIN
+void energy_monitor_enter_deepsleep(void)
+{
+    uint32_t intr_state;
+
+    if (NULL == energy_lptimer)
+    {
+        return;
+    }
+
+    intr_state = Cy_SysLib_EnterCriticalSection();
+    energy_in_deepsleep = true;
+    energy_tracker_set_state(&energy_tracker, ENERGY_STATE_DEEPSLEEP,
+                             energy_monitor_now_us());
+    Cy_SysLib_ExitCriticalSection(intr_state);
+}
+WAKE_PATH_FUNC_END
+
+/*******************************************************************************
+* Function Name: energy_monitor_exit_deepsleep
+********************************************************************************
+* Summary:
+*  Records DeepSleep exit and counts the DeepSleep transition.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+WAKE_PATH_FUNC_BEGIN
+void energy_monitor_exit_deepsleep(void)
+{
+    uint32_t intr_state;
+
+    if (NULL == energy_lptimer)
+    {
+        return;
+    }
+
+    intr_state = Cy_SysLib_EnterCriticalSection();
+    energy_in_deepsleep = false;
+    energy_tracker_set_state(&energy_tracker, energy_running_state,
+                             energy_monitor_now_us());
+    energy_tracker_add_transition(&energy_tracker, ENERGY_TRANSITION_DEEPSLEEP);
+    Cy_SysLib_ExitCriticalSection(intr_state);
+}
+WAKE_PATH_FUNC_END
+
+/*******************************************************************************
+* Function Name: energy_monitor_set_load
+********************************************************************************
+* Summary:
+*  Records a load switching on or off.
+*
+* Parameters:
+*  load - load
+*  on   - true if the load is switched on
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+WAKE_PATH_FUNC_BEGIN
+void energy_monitor_set_load(energy_load_t load, bool on)
+{
+    uint32_t intr_state;
+
+    if (NULL == energy_lptimer)
+    {
+        return;
+    }
+
+    intr_state = Cy_SysLib_EnterCriticalSection();
+    energy_tracker_set_load(&energy_tracker, load, on, energy_monitor_now_us());
+    Cy_SysLib_ExitCriticalSection(intr_state);
+}
+WAKE_PATH_FUNC_END
+
+/*******************************************************************************
+* Function Name: energy_monitor_add_transition
+********************************************************************************
+* Summary:
+*  Counts a transition with a fixed energy cost.
+*
+* Parameters:
+*  transition - transition
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void energy_monitor_add_transition(energy_transition_t transition)
+{
+    uint32_t intr_state;
+
+    if (NULL == energy_lptimer)
+    {
+        return;
+    }
+
+    intr_state = Cy_SysLib_EnterCriticalSection();
+    energy_tracker_add_transition(&energy_tracker, transition);
+    Cy_SysLib_ExitCriticalSection(intr_state);
+}
+
+/*******************************************************************************
+* Function Name: energy_monitor_get_time_us
+********************************************************************************
+* Summary:
+*  Returns the current time of the monitor time base.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint64_t - time in microseconds since energy_monitor_init()
+*
+*******************************************************************************/
+WAKE_PATH_FUNC_BEGIN
+uint64_t energy_monitor_get_time_us(void)
+{
+    uint32_t intr_state;
+    uint64_t now_us;
+
+    if (NULL == energy_lptimer)
+    {
+        return 0U;
+    }
+
+    intr_state = Cy_SysLib_EnterCriticalSection();
+    now_us = energy_monitor_now_us();
+    Cy_SysLib_ExitCriticalSection(intr_state);
+
+    return now_us;
+}
+WAKE_PATH_FUNC_END
+
+/*******************************************************************************
+* Function Name: energy_monitor_end_cycle
+********************************************************************************
+* Summary:
+*  Takes the residency counters of the cycle that ends now and estimates its
+*  energy with the default energy model.
+*
+* Parameters:
+*  estimate - energy estimate of the cycle
+*  account  - residency counters of the cycle, or NULL
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void energy_monitor_end_cycle(energy_estimate_t *estimate,
+                              energy_account_t *account)
+{
+    energy_account_t cycle = { 0 };
+    uint32_t intr_state;
+
+    if (NULL != energy_lptimer)
+    {
+        intr_state = Cy_SysLib_EnterCriticalSection();
+        energy_tracker_take(&energy_tracker, energy_monitor_now_us(), &cycle);
+        Cy_SysLib_ExitCriticalSection(intr_state);
+    }
+
+    energy_model_estimate(&energy_model_default, &cycle, estimate);
+    if (NULL != account)
+    {
+        *account = cycle;
+    }
+}
+
+/* [] END OF FILE */
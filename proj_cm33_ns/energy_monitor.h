@@ -0,0 +1,79 @@
+/*****************************************************************************
+* File Name        : energy_monitor.h
+*
+* Description      : This file contains the interface of the on-device energy
+*                    monitor. It tracks the residency of the power states and
+*                    loads of the CM33 non-secure application and estimates
+*                    the energy per application state cycle.
+*
+* Related Document : See README.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+#ifndef ENERGY_MONITOR_H
+#define ENERGY_MONITOR_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "cybsp.h"
+#include "energy_model.h"
+#include "perf_policy.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+/* Starts the monitor. The LPTimer keeps counting in DeepSleep and is the
+ * time base of the residency counters. */
+void energy_monitor_init(mtb_hal_lptimer_t *lptimer);
+
+/* Records a performance mode change */
+void energy_monitor_set_perf_mode(perf_mode_t mode);
+
+/* Records DeepSleep entry and exit. Called from the DeepSleep callback. */
+void energy_monitor_enter_deepsleep(void);
+void energy_monitor_exit_deepsleep(void);
+
+/* Records a load switching on or off */
+void energy_monitor_set_load(energy_load_t load, bool on);
+
+/* Counts a transition with a fixed energy cost */
+void energy_monitor_add_transition(energy_transition_t transition);
+
+/* Returns the current time of the monitor time base in microseconds */
+uint64_t energy_monitor_get_time_us(void);
+
+/* Ends the current application state cycle and estimates its energy with
+ * the default energy model. The residency counters of the cycle are copied
+ * to account unless it is NULL. */
+void energy_monitor_end_cycle(energy_estimate_t *estimate,
+                              energy_account_t *account);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ENERGY_MONITOR_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,223 @@
+/*****************************************************************************
+* File Name        : hibernate.c
+*
+* Description      : This source file implements the Hibernate support. The
+*                    snapshot is written to the backup registers with a magic
+*                    word and a check word before the entry, and read back
+*                    and invalidated by the boot path.
+*
+* Related Document : See README.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+
+#include <string.h>
+
+#include "cy_pdl.h"
+#include "perf_counter.h"
+#include "hibernate.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* "HIB" and the layout version of the snapshot */
+#define HIBERNATE_MAGIC                 (0x48494201UL)
+
+/* Magic, the snapshot and the check word */
+#define HIBERNATE_SNAPSHOT_WORDS        (sizeof(hibernate_snapshot_t) / sizeof(uint32_t))
+#define HIBERNATE_BREG_WORDS            (HIBERNATE_SNAPSHOT_WORDS + 2U)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+static hibernate_stats_t hibernate_stats;
+static uint32_t hibernate_boot_cycles = 0U;
+
+/*******************************************************************************
+* Function Name: snapshot_check
+********************************************************************************
+* Summary:
+*  Returns the check word of a snapshot. A cold boot leaves the backup
+*  registers in their reset state or with the contents of an older image,
+*  which must not pass as a snapshot.
+*
+* Parameters:
+*  words - snapshot words
+*
+* Return:
+*  uint32_t - check word
+*
+*******************************************************************************/
+static uint32_t snapshot_check(const uint32_t *words)
+{
+    uint32_t check = HIBERNATE_MAGIC;
+    uint32_t i;
+
+    for (i = 0U; i < HIBERNATE_SNAPSHOT_WORDS; i++)
+    {
+        check = ((check << 5U) | (check >> 27U)) ^ words[i];
+    }
+
+    return ~check;
+}
+
+/*******************************************************************************
+* Function Name: hibernate_init
+********************************************************************************
+* Summary:
+*  Starts the start-up measurement and restores the snapshot of the last
+*  Hibernate entry, if the device woke up from Hibernate. The snapshot is
+*  invalidated, so that a later reset of any other kind starts from scratch.
+*
+*  A valid snapshot alone does not prove a Hibernate wake-up: a reset after
+*  the snapshot was written and before the entry completed leaves it in the
+*  backup registers. The wake-up cause is also required. The POWER_MANAGER
+*  partition clears the reset reason at its start-up, before this image
+*  runs, so the reset reason is only taken when it is still set.
+*
+* Parameters:
+*  snapshot - filled with the snapshot if it is valid
+*
+* Return:
+*  bool - true if the snapshot was restored
+*
+*******************************************************************************/
+bool hibernate_init(hibernate_snapshot_t *snapshot)
+{
+    uint32_t words[HIBERNATE_SNAPSHOT_WORDS];
+    uint32_t cause;
+    uint32_t i;
+    bool valid;
+
+    hibernate_boot_cycles = perf_counter_get();
+    memset(&hibernate_stats, 0, sizeof(hibernate_stats));
+    cause = (uint32_t)Cy_SysPm_GetHibernateWakeupCause();
+
+    for (i = 0U; i < HIBERNATE_SNAPSHOT_WORDS; i++)
+    {
+        words[i] = HIBERNATE_BREG(HIBERNATE_BREG_FIRST + 1U + i);
+    }
+    valid = (HIBERNATE_MAGIC == HIBERNATE_BREG(HIBERNATE_BREG_FIRST)) &&
+            (snapshot_check(words) ==
+             HIBERNATE_BREG(HIBERNATE_BREG_FIRST + HIBERNATE_BREG_WORDS - 1U)) &&
+            ((0U != cause) ||
+             (0U != (Cy_SysLib_GetResetReason() & CY_SYSLIB_RESET_HIB_WAKEUP)));
+    HIBERNATE_BREG(HIBERNATE_BREG_FIRST) = 0U;
+
+    if (valid)
+    {
+        memcpy(snapshot, words, sizeof(*snapshot));
+        hibernate_stats.resumed = true;
+        hibernate_stats.wakeup_cause = cause;
+    }
+    Cy_SysPm_ClearHibernateWakeupCause();
+
+    return valid;
+}
+
+/*******************************************************************************
+* Function Name: hibernate_on_first_task
+********************************************************************************
+* Summary:
+*  Ends the start-up measurement. Only the first call counts.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void hibernate_on_first_task(void)
+{
+    if (0U == hibernate_stats.startup_us)
+    {
+        hibernate_stats.startup_us =
+            perf_counter_cycles_to_us(perf_counter_get() - hibernate_boot_cycles);
+    }
+}
+
+/*******************************************************************************
+* Function Name: hibernate_enter
+********************************************************************************
+* Summary:
+*  Stores the snapshot in the backup registers and enters Hibernate. The
+*  device wakes up through a reset, so the function returns only if a SysPm
+*  callback refused the entry.
+*
+* Parameters:
+*  snapshot       - application state to restore after the wake-up
+*  wakeup_sources - cy_en_syspm_hibernate_wakeup_source_t bits
+*
+* Return:
+*  cy_en_syspm_status_t - status of the failed entry
+*
+*******************************************************************************/
+cy_en_syspm_status_t hibernate_enter(const hibernate_snapshot_t *snapshot,
+                                     uint32_t wakeup_sources)
+{
+    uint32_t words[HIBERNATE_SNAPSHOT_WORDS];
+    cy_en_syspm_status_t status;
+    uint32_t i;
+
+    memcpy(words, snapshot, sizeof(*snapshot));
+    for (i = 0U; i < HIBERNATE_SNAPSHOT_WORDS; i++)
+    {
+        HIBERNATE_BREG(HIBERNATE_BREG_FIRST + 1U + i) = words[i];
+    }
+    HIBERNATE_BREG(HIBERNATE_BREG_FIRST + HIBERNATE_BREG_WORDS - 1U) =
+        snapshot_check(words);
+    HIBERNATE_BREG(HIBERNATE_BREG_FIRST) = HIBERNATE_MAGIC;
+
+    Cy_SysPm_ClearHibernateWakeupCause();
+    Cy_SysPm_SetHibernateWakeupSource(wakeup_sources);
+    status = Cy_SysPm_SystemEnterHibernate();
+
+    /* Still awake: the snapshot must not be restored by a later reset */
+    HIBERNATE_BREG(HIBERNATE_BREG_FIRST) = 0U;
+    Cy_SysPm_ClearHibernateWakeupSource(wakeup_sources);
+
+    return status;
+}
+
+/*******************************************************************************
+* Function Name: hibernate_get_stats
+********************************************************************************
+* Summary:
+*  Returns a copy of the start-up statistics.
+*
+* Parameters:
+*  stats - destination
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void hibernate_get_stats(hibernate_stats_t *stats)
+{
+    *stats = hibernate_stats;
+}
+
+/* [] END OF FILE */
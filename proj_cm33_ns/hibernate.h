@@ -0,0 +1,108 @@
+/*****************************************************************************
+* File Name        : hibernate.h
+*
+* Description      : This file contains the interface of the Hibernate
+*                    support. The minimal application state is kept in the
+*                    backup registers across Hibernate, so that the boot path
+*                    after a Hibernate wake-up restores it instead of starting
+*                    from scratch.
+*
+* Related Document : See README.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+
+#ifndef HIBERNATE_H
+#define HIBERNATE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "cy_pdl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Backup register that holds the first word of the snapshot. The backup
+ * registers are in the backup domain, which keeps its state in Hibernate. */
+#if !defined(HIBERNATE_BREG_FIRST)
+#define HIBERNATE_BREG_FIRST            (0U)
+#endif
+
+/* Backup register access */
+#if !defined(HIBERNATE_BREG)
+#define HIBERNATE_BREG(index)           (BACKUP->BREG[(index)])
+#endif
+
+/*******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+/* Application state kept across Hibernate */
+typedef struct
+{
+    uint32_t app_state;         /* en_app_state_t at the entry */
+    uint32_t hibernations;      /* Hibernate entries since the cold boot */
+    uint32_t wake_after_s;      /* timed wake-up armed at the entry, 0 for none */
+    uint32_t telemetry_ms;      /* DeepSleep residency not sent to the partition */
+} hibernate_snapshot_t;
+
+/* Start-up of this boot */
+typedef struct
+{
+    bool resumed;               /* a valid snapshot was restored */
+    uint32_t wakeup_cause;      /* Hibernate wake-up cause, 0 on a cold boot */
+    uint32_t startup_us;        /* main() to the first task, 0 until known */
+} hibernate_stats_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+/* Starts the start-up measurement and restores the snapshot of the last
+ * Hibernate entry if the wake-up cause or the reset reason shows a wake-up
+ * from Hibernate. The snapshot is invalidated, so it is used only once.
+ * Call at the start of main(), after perf_counter_init(). Returns true if
+ * the snapshot was valid. */
+bool hibernate_init(hibernate_snapshot_t *snapshot);
+
+/* Ends the start-up measurement. Call when the first task runs. */
+void hibernate_on_first_task(void);
+
+/* Stores the snapshot, sets the Hibernate wake-up sources and enters
+ * Hibernate. Returns only if the entry failed, with the snapshot
+ * invalidated. */
+cy_en_syspm_status_t hibernate_enter(const hibernate_snapshot_t *snapshot,
+                                     uint32_t wakeup_sources);
+
+/* Returns a copy of the start-up statistics */
+void hibernate_get_stats(hibernate_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HIBERNATE_H */
+
+/* [] END OF FILE */
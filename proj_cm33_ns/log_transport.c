@@ -0,0 +1,471 @@
+/*****************************************************************************
+* File Name        : log_transport.c
+*
+* Description      : This source file implements the log transport. The
+*                    platform log service transmits synchronously in the SPE,
+*                    with the NS interrupts masked; the transmit task hands it
+*                    the queued bytes in chunks short enough to keep every
+*                    blackout below a tick period.
+*
+* Related Document : See README.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+
+#include <string.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "cy_pdl.h"
+#include "ifx_platform_api.h"
+#include "power_manager_api.h"
+#include "spe_profiler.h"
+#include "log_transport.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+#define LOG_TRANSPORT_TASK_PRIORITY     (tskIDLE_PRIORITY + 1U)
+#define LOG_TRANSPORT_TASK_STACK_SIZE   (1024U)
+
+#define LOG_TRANSPORT_RING_MASK         (LOG_TRANSPORT_RING_SIZE - 1U)
+
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+static TaskHandle_t log_task = NULL;
+
+/* Free running byte counts, the difference is the ring level */
+static uint8_t log_ring[LOG_TRANSPORT_RING_SIZE];
+static uint32_t log_head = 0U;
+static uint32_t log_tail = 0U;
+
+/* Bytes may still be in the UART: set by a write to the platform service,
+ * cleared once the SPE reports the transmission complete */
+static bool log_tx_busy = false;
+
+/* The UART state can be read from the SPE: set by log_transport_init(),
+ * which is called once the TF-M NS interface is up */
+static bool log_tx_readable = false;
+
+static log_transport_stats_t log_stats;
+
+/*******************************************************************************
+* Function Name: log_transport_drain_us
+********************************************************************************
+* Summary:
+*  Returns the time the UART needs to send a number of bytes, 10 bits per
+*  byte.
+*
+* Parameters:
+*  bytes - number of bytes
+*
+* Return:
+*  uint32_t - time in microseconds
+*
+*******************************************************************************/
+static uint32_t log_transport_drain_us(uint32_t bytes)
+{
+    return (uint32_t)((((uint64_t)bytes * 10U * 1000000U) + LOG_TRANSPORT_BAUD_RATE - 1U) /
+                      LOG_TRANSPORT_BAUD_RATE);
+}
+
+/*******************************************************************************
+* Function Name: log_transport_get_tx
+********************************************************************************
+* Summary:
+*  Reads the TX FIFO state of the UART from the SPE. Without it, the FIFO is
+*  taken as LOG_TRANSPORT_FALLBACK_SIZE bytes, empty and done.
+*
+* Parameters:
+*  tx - destination
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void log_transport_get_tx(power_manager_log_tx_t *tx)
+{
+    uint32_t intr_state;
+
+    if (log_tx_readable && (PSA_SUCCESS == power_manager_get_log_tx(tx)) &&
+        (0U != tx->fifo_size))
+    {
+        intr_state = Cy_SysLib_EnterCriticalSection();
+        log_stats.tx_queries++;
+        Cy_SysLib_ExitCriticalSection(intr_state);
+        return;
+    }
+
+    tx->fifo_size = LOG_TRANSPORT_FALLBACK_SIZE;
+    tx->fifo_used = 0U;
+    tx->tx_done = 1U;
+}
+
+/*******************************************************************************
+* Function Name: log_transport_batch_size
+********************************************************************************
+* Summary:
+*  Returns the size of the next batch of queued bytes and the number of
+*  them the TX FIFO has no room for yet.
+*
+* Parameters:
+*  tx     - TX FIFO state
+*  queued - bytes waiting to be sent
+*  wait   - destination of the bytes without room
+*
+* Return:
+*  uint32_t - bytes in the batch
+*
+*******************************************************************************/
+static uint32_t log_transport_batch_size(const power_manager_log_tx_t *tx,
+                                         uint32_t queued, uint32_t *wait)
+{
+    uint32_t space = (tx->fifo_used < tx->fifo_size) ? (tx->fifo_size - tx->fifo_used) : 0U;
+    uint32_t n = (queued < LOG_TRANSPORT_BATCH_MAX) ? queued : LOG_TRANSPORT_BATCH_MAX;
+
+    n = (n < tx->fifo_size) ? n : tx->fifo_size;
+    *wait = (space < n) ? (n - space) : 0U;
+
+    return n;
+}
+
+/*******************************************************************************
+* Function Name: log_transport_send
+********************************************************************************
+* Summary:
+*  Writes one batch to the platform log service in a secure call.
+*
+* Parameters:
+*  msg  - bytes to write
+*  size - number of bytes, at most LOG_TRANSPORT_BATCH_MAX
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void log_transport_send(const uint8_t *msg, uint32_t size)
+{
+    uint32_t intr_state;
+    uint32_t start;
+
+    start = spe_profiler_enter();
+    (void)ifx_platform_log_msg(msg, size);
+    spe_profiler_exit(SPE_PROFILER_PLATFORM, start);
+
+    intr_state = Cy_SysLib_EnterCriticalSection();
+    log_stats.bytes += size;
+    log_stats.calls++;
+    Cy_SysLib_ExitCriticalSection(intr_state);
+}
+
+/*******************************************************************************
+* Function Name: log_transport_send_now
+********************************************************************************
+* Summary:
+*  Writes a message without the task. Before every batch it waits, in the
+*  NSPE with interrupts enabled, until the TX FIFO has room for it.
+*
+* Parameters:
+*  msg  - bytes to write
+*  size - number of bytes
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void log_transport_send_now(const uint8_t *msg, uint32_t size)
+{
+    power_manager_log_tx_t tx;
+    uint32_t wait;
+    uint32_t n;
+
+    while (0U != size)
+    {
+        log_transport_get_tx(&tx);
+        n = log_transport_batch_size(&tx, size, &wait);
+        if (0U != wait)
+        {
+            Cy_SysLib_DelayUs((uint16_t)log_transport_drain_us(wait));
+            continue;
+        }
+        log_transport_send(msg, n);
+        msg += n;
+        size -= n;
+    }
+}
+
+/*******************************************************************************
+* Function Name: log_transport_task
+********************************************************************************
+* Summary:
+*  Reads the TX FIFO state of the UART from the SPE and writes as many queued
+*  bytes as the free FIFO space takes in one secure call. While the FIFO has
+*  no room for the next batch, it sleeps for the time the UART needs to make
+*  room. Once the ring is empty, it reads the UART state until the SPE
+*  reports the transmission complete, and then reports idle.
+*
+* Parameters:
+*  pvParameters - unused
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void log_transport_task(void *pvParameters)
+{
+    uint8_t batch[LOG_TRANSPORT_BATCH_MAX];
+    power_manager_log_tx_t tx;
+    uint32_t intr_state;
+    uint32_t queued;
+    uint32_t wait;
+    uint32_t n;
+    uint32_t i;
+    bool busy;
+
+    CY_UNUSED_PARAMETER(pvParameters);
+
+    for (;;)
+    {
+        intr_state = Cy_SysLib_EnterCriticalSection();
+        queued = log_head - log_tail;
+        busy = log_tx_busy;
+        Cy_SysLib_ExitCriticalSection(intr_state);
+
+        if ((0U == queued) && !busy)
+        {
+            (void)ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            continue;
+        }
+
+        log_transport_get_tx(&tx);
+        if (0U == queued)
+        {
+            if (0U == tx.tx_done)
+            {
+                /* The FIFO and the shifter */
+                wait = tx.fifo_used + 1U;
+            }
+            else
+            {
+                wait = 0U;
+                intr_state = Cy_SysLib_EnterCriticalSection();
+                if (log_head == log_tail)
+                {
+                    log_tx_busy = false;
+                }
+                Cy_SysLib_ExitCriticalSection(intr_state);
+            }
+        }
+        else
+        {
+            n = log_transport_batch_size(&tx, queued, &wait);
+            if (0U == wait)
+            {
+                intr_state = Cy_SysLib_EnterCriticalSection();
+                for (i = 0U; i < n; i++)
+                {
+                    batch[i] = log_ring[(log_tail + i) & LOG_TRANSPORT_RING_MASK];
+                }
+                log_tail += n;
+                log_tx_busy = true;
+                Cy_SysLib_ExitCriticalSection(intr_state);
+
+                log_transport_send(batch, n);
+            }
+        }
+
+        if (0U != wait)
+        {
+            vTaskDelay(pdMS_TO_TICKS((log_transport_drain_us(wait) + 999U) / 1000U));
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: log_transport_init
+********************************************************************************
+* Summary:
+*  Clears the ring and creates the transmit task. From here on, the UART
+*  state is read from the SPE.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  bool - false if the task could not be created
+*
+*******************************************************************************/
+bool log_transport_init(void)
+{
+    log_head = 0U;
+    log_tail = 0U;
+    log_tx_busy = false;
+    log_tx_readable = true;
+
+    return (pdPASS == xTaskCreate(log_transport_task, "Log",
+                                  LOG_TRANSPORT_TASK_STACK_SIZE, NULL,
+                                  LOG_TRANSPORT_TASK_PRIORITY, &log_task));
+}
+
+/*******************************************************************************
+* Function Name: log_transport_write
+********************************************************************************
+* Summary:
+*  Queues a message for the transmit task. Without a running scheduler the
+*  message is written at once.
+*
+* Parameters:
+*  msg  - message
+*  size - message length
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void log_transport_write(const uint8_t *msg, uint32_t size)
+{
+    uint32_t intr_state;
+    uint32_t level;
+    uint32_t n;
+    uint32_t i;
+
+    if ((NULL == log_task) || (taskSCHEDULER_RUNNING != xTaskGetSchedulerState()))
+    {
+        log_transport_send_now(msg, size);
+        return;
+    }
+
+    while (0U != size)
+    {
+        intr_state = Cy_SysLib_EnterCriticalSection();
+        n = LOG_TRANSPORT_RING_SIZE - (log_head - log_tail);
+        if (n > size)
+        {
+            n = size;
+        }
+        for (i = 0U; i < n; i++)
+        {
+            log_ring[(log_head + i) & LOG_TRANSPORT_RING_MASK] = msg[i];
+        }
+        log_head += n;
+        level = log_head - log_tail;
+        if (level > log_stats.max_level)
+        {
+            log_stats.max_level = level;
+        }
+        if (n < size)
+        {
+            log_stats.writer_waits++;
+        }
+        Cy_SysLib_ExitCriticalSection(intr_state);
+
+        if (0U != n)
+        {
+            xTaskNotifyGive(log_task);
+        }
+        msg += n;
+        size -= n;
+        if (0U != size)
+        {
+            vTaskDelay(1U);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: log_transport_tx_idle
+********************************************************************************
+* Summary:
+*  Returns true when the ring is empty and the SPE has reported that the UART
+*  has sent the last byte.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  bool - transmitter idle
+*
+*******************************************************************************/
+bool log_transport_tx_idle(void)
+{
+    uint32_t intr_state = Cy_SysLib_EnterCriticalSection();
+    bool idle = (log_head == log_tail) && !log_tx_busy;
+
+    Cy_SysLib_ExitCriticalSection(intr_state);
+
+    return idle;
+}
+
+/*******************************************************************************
+* Function Name: log_transport_flush
+********************************************************************************
+* Summary:
+*  Waits, one tick at a time, until the transmitter is idle.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void log_transport_flush(void)
+{
+    if (taskSCHEDULER_RUNNING != xTaskGetSchedulerState())
+    {
+        return;
+    }
+
+    while (!log_transport_tx_idle())
+    {
+        vTaskDelay(1U);
+    }
+}
+
+/*******************************************************************************
+* Function Name: log_transport_get_stats
+********************************************************************************
+* Summary:
+*  Returns a copy of the statistics.
+*
+* Parameters:
+*  stats - destination
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void log_transport_get_stats(log_transport_stats_t *stats)
+{
+    uint32_t intr_state = Cy_SysLib_EnterCriticalSection();
+
+    *stats = log_stats;
+    Cy_SysLib_ExitCriticalSection(intr_state);
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,104 @@
+/*****************************************************************************
+* File Name        : log_transport.h
+*
+* Description      : This file contains the interface of the log transport.
+*                    Log messages are queued in a ring and written to the
+*                    secure platform log service in short chunks by a low
+*                    priority task, so that neither the caller nor the NS
+*                    interrupts wait for the whole UART transfer.
+*
+* Related Document : See README.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+
+#ifndef LOG_TRANSPORT_H
+#define LOG_TRANSPORT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Ring size, a power of two */
+#define LOG_TRANSPORT_RING_SIZE         (2048U)
+
+/* Most bytes per secure call. A batch is only sent once the TX FIFO of the
+ * UART has room for it, so the call returns without waiting for the UART.
+ * Larger than the FIFO, a batch is cut to the FIFO size. */
+#ifndef LOG_TRANSPORT_BATCH_MAX
+#define LOG_TRANSPORT_BATCH_MAX         (128U)
+#endif
+
+/* Bytes per secure call while the UART state cannot be read from the SPE.
+ * 8 bytes take 694 us at 115200 baud, less than a tick period. */
+#define LOG_TRANSPORT_FALLBACK_SIZE     (8U)
+
+/* Baud rate of the secure UART */
+#define LOG_TRANSPORT_BAUD_RATE         (115200U)
+
+/*******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+/* Log transport statistics */
+typedef struct
+{
+    uint32_t bytes;             /* bytes written to the platform service */
+    uint32_t calls;             /* secure calls of the platform service */
+    uint32_t tx_queries;        /* UART state reads from the SPE */
+    uint32_t max_level;         /* most bytes queued at once */
+    uint32_t writer_waits;      /* ticks writers waited for a full ring */
+} log_transport_stats_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+/* Creates the transmit task. Call once the TF-M NS interface is up, before
+ * the scheduler starts. */
+bool log_transport_init(void);
+
+/* Queues a message. Before the scheduler runs, or with the scheduler
+ * suspended, the message is written at once. Waits while the ring is full. */
+void log_transport_write(const uint8_t *msg, uint32_t size);
+
+/* Returns true when all queued bytes have left the UART, as last read from
+ * the SPE */
+bool log_transport_tx_idle(void);
+
+/* Waits until all queued bytes have left the UART. Call from a task. */
+void log_transport_flush(void);
+
+/* Returns a copy of the statistics */
+void log_transport_get_stats(log_transport_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOG_TRANSPORT_H */
+
+/* [] END OF FILE */
@@ -33,7 +33,6 @@
 #include "cy_pdl.h"
 #include "tfm_ns_interface.h"
 #include "os_wrapper/common.h"
-#include "ifx_platform_api.h"
 
 #include "cy_time.h"
 #include "FreeRTOS.h"
@@ -44,17 +43,28 @@
 #include "power_manager_defs.h"
 #include "power_manager_api.h"
 
+#include "app_state.h"
+#include "perf_counter.h"
+#include "pd_manager.h"
+#include "sram_retention.h"
+#include "wake_path.h"
+#include "wake_resume.h"
+#include "power_event.h"
+#include "cm55_power.h"
+#include "perf_governor.h"
+#include "energy_monitor.h"
+#include "tickless_idle.h"
+#include "deferred_work.h"
+#include "log_transport.h"
+#include "hibernate.h"
+#include "wake_monitor.h"
+#include "spe_profiler.h"
+#include "wake_recorder.h"
+
 /*******************************************************************************
 * Macros
 *******************************************************************************/
 
-/* The timeout value in microseconds used to wait for CM55 core to be booted */
-#define CM55_BOOT_WAIT_TIME_USEC (10U)
-
-/* App boot address for CM55 project */
-#define CM55_APP_BOOT_ADDR (CYMEM_CM33_0_m55_nvm_START + \
-                            CYBSP_MCUBOOT_HEADER_SIZE)
-
 #define TASK_DELAY_MSEC (1000U)
 #define TASK_STACK_SIZE (4096)
 #define TASK_PRIORITY (3)
@@ -64,28 +74,100 @@
  * frequency set by the BSP.*/
 #define LPTIMER_0_WAIT_TIME_USEC (62U)
 
-/* App State Timeouts */
+/* App State Timeouts. Can be shortened by the build for wake soak runs. */
+#ifndef APP_STATE_ACTIVE_TIME_MS
 #define APP_STATE_ACTIVE_TIME_MS (20000)
+#endif
+
+/* Secure timed wake-up from the Idle state, in seconds. 0 waits for USER BTN1
+ * only. */
+#ifndef APP_IDLE_WAKE_INTERVAL_S
+#define APP_IDLE_WAKE_INTERVAL_S (0U)
+#endif
+
+/* Time in the Idle state without a wake-up event after which the
+ * application hibernates, in seconds. 0 never hibernates. */
+#ifndef APP_HIBERNATE_IDLE_S
+#define APP_HIBERNATE_IDLE_S (0U)
+#endif
+
+/* Secure timed wake-up from Hibernate, in seconds. 0 waits for the wake-up
+ * pin only. */
+#ifndef APP_HIBERNATE_WAKE_S
+#define APP_HIBERNATE_WAKE_S (0U)
+#endif
+
+/* Hibernate wake-up pin driven by USER BTN1, a Hibernate wake-up source such
+ * as CY_SYSPM_HIBERNATE_PIN1_LOW. It has no default: the wake-up input the
+ * button is routed to depends on the board, and a wrong one leaves a
+ * Hibernate that USER BTN1 cannot end. */
+#ifndef APP_HIBERNATE_WAKEUP_PIN
+#if (APP_HIBERNATE_IDLE_S != 0U)
+#error "Define APP_HIBERNATE_WAKEUP_PIN to the Hibernate wake-up pin of USER BTN1 on the board"
+#endif
+/* Not used without Hibernate */
+#define APP_HIBERNATE_WAKEUP_PIN (0U)
+#endif
+
+/* 1 if CM55 calls the POWER_MANAGER partition, see proj_cm55/cm55_wake.h.
+ * Set APP_CM55_POWER_MANAGER in common.mk. */
+#ifndef APP_CM55_POWER_MANAGER
+#define APP_CM55_POWER_MANAGER (0)
+#endif
+
+/* Expected time until the next CM55 job in the Idle state. A CM55 that calls
+ * the partition checks the wake-up sources after every wake-up and stays on;
+ * otherwise CM55 has no job while idle and is powered off. */
+#if (APP_CM55_POWER_MANAGER != 0)
+#define APP_CM55_IDLE_NEXT_JOB_MS (0U)
+#else
+#define APP_CM55_IDLE_NEXT_JOB_MS (CM55_NEXT_JOB_UNKNOWN)
+#endif
+
+/* Secure commands of the HIBERNATE state entry: cancel the Idle timed
+ * wake-up, arm the Hibernate one, record DeepSleep residency and wake
+ * latency, write the telemetry to storage */
+#define APP_HIBERNATE_CMDS_MAX (5U)
+
+/* Wait of the Idle state for a wake-up event */
+#define APP_IDLE_TIMEOUT_TICKS ((0U != APP_HIBERNATE_IDLE_S) ? \
+    ((TickType_t)APP_HIBERNATE_IDLE_S * configTICK_RATE_HZ) : portMAX_DELAY)
+
+/* Secure commands of the IDLE state exit: cancel the timed wake-up, read the
+ * rate limiter, record DeepSleep residency and wake latency */
+#define APP_WAKE_CMDS_MAX (4U)
+
+/* Unsent DeepSleep residency after which the telemetry is sent by a deferred
+ * job, at the latest APP_TELEMETRY_DEADLINE_MS later. Until then it is sent
+ * along with other IDLE exit commands. */
+#ifndef APP_TELEMETRY_REPORT_MS
+#define APP_TELEMETRY_REPORT_MS (3600000U)
+#endif
+#define APP_TELEMETRY_DEADLINE_MS (600000U)
+
+/* The pending event check runs after all other CHECK_READY callbacks */
+#define APP_DEEPSLEEP_ABORT_ORDER (255U)
+
+/* A DeepSleep period shorter than the DeepSleep latency costs more energy
+ * than it saves */
+#define APP_DEEPSLEEP_WASTED_US (CY_CFG_PWR_DEEPSLEEP_LATENCY * 1000U)
+
+/* Measures the cost of single secure calls against a batch and the NS side
+ * cache at start-up */
+#ifndef APP_PSA_BATCH_BENCH
+#define APP_PSA_BATCH_BENCH (0)
+#endif
+#define APP_PSA_BATCH_BENCH_RUNS (16U)
 
 /* Heart Beat freqyency */
 #define HEART_BEAT_FREQ_MS (500)
 
 
-/* Logging */
+/* Logging. Messages are queued and sent by the log transport task. */
 #define LOG_BUFFER_SIZE (256)
-#define LOG(fmt, ...) ifx_platform_log_msg((const uint8_t *)log_buffer, snprintf(log_buffer, LOG_BUFFER_SIZE, (fmt), ##__VA_ARGS__))
-#define LOG_WAIT_FOR_TX_COMPLETE() Cy_SysLib_Delay(100U);
-
-/*******************************************************************************
-* Typedefs
-*******************************************************************************/
-
-/* App States */
-typedef enum
-{
-    APP_STATE_ACTIVE = 1U,
-    APP_STATE_IDLE = 2U
-} en_app_state_t;
+#define LOG(fmt, ...) \
+    log_transport_write((const uint8_t *)log_buffer, snprintf(log_buffer, LOG_BUFFER_SIZE, (fmt), ##__VA_ARGS__))
+#define LOG_WAIT_FOR_TX_COMPLETE() log_transport_flush()
 
 /*******************************************************************************
 * Function Prototypes
@@ -93,6 +175,8 @@ typedef enum
 
 cy_en_syspm_status_t deepsleep_callback(cy_stc_syspm_callback_params_t *callbackParams,
                                         cy_en_syspm_callback_mode_t mode);
+cy_en_syspm_status_t deepsleep_abort_callback(cy_stc_syspm_callback_params_t *callbackParams,
+                                              cy_en_syspm_callback_mode_t mode);
 
 /*******************************************************************************
 * Global Variables
@@ -124,14 +208,60 @@ cy_stc_syspm_callback_t sys_ds_cback =
 {
     .callback = deepsleep_callback,
     .type = CY_SYSPM_DEEPSLEEP,
-    .skipMode = ~(CY_SYSPM_BEFORE_TRANSITION | CY_SYSPM_AFTER_TRANSITION),
+    .skipMode = ~(CY_SYSPM_CHECK_READY | CY_SYSPM_BEFORE_TRANSITION | CY_SYSPM_AFTER_TRANSITION),
     .callbackParams = &cback_params,
     .prevItm = NULL,
     .nextItm = NULL,
     .order = 0
 };
+cy_stc_syspm_callback_t sys_ds_abort_cback =
+{
+    .callback = deepsleep_abort_callback,
+    .type = CY_SYSPM_DEEPSLEEP,
+    .skipMode = ~(CY_SYSPM_CHECK_READY),
+    .callbackParams = &cback_params,
+    .prevItm = NULL,
+    .nextItm = NULL,
+    .order = APP_DEEPSLEEP_ABORT_ORDER
+};
+
+/* Wake-ups by the sources the App State Manager handles, subscribed by the
+ * task itself. Wake-ups without one do not end the Idle state. */
+static power_event_sub_t app_wake_sub =
+{
+    .type_mask = POWER_EVENT_MASK(POWER_EVENT_WAKE),
+    .source_mask = WAKEUP_SOURCE_USER_BTN1 | WAKEUP_SOURCE_USER_BTN2 |
+                   WAKEUP_SOURCE_TIMER,
+    .priority = 0U,
+    .task = NULL,
+    .callback = NULL,
+    .arg = NULL
+};
 
-static uint32_t wakeup_src = 0U;
+/* Partition state generation when the App State Manager started to wait for
+ * a wake-up event. A later generation aborts the DeepSleep entry. */
+static uint32_t deepsleep_gen = 0U;
+static volatile bool deepsleep_armed = false;
+
+/* Cycle counter at the first CHECK_READY callback, LPTimer time at the
+ * DeepSleep entry */
+static uint32_t deepsleep_check_cycles = 0U;
+static uint64_t deepsleep_entry_us = 0U;
+
+/* Secure services can be called */
+static bool tfm_ready = false;
+
+/* Telemetry not yet sent to the partition, shared by the App State Manager
+ * and the deferred telemetry job */
+static uint32_t app_telemetry_deepsleep_ms = 0U;
+static uint32_t app_telemetry_latency_us = 0U;
+
+/* Application state restored after a Hibernate wake-up */
+static hibernate_snapshot_t app_snapshot = { 0U, 0U, 0U, 0U };
+static bool app_resumed = false;
+
+/* Wake recorder records not yet logged */
+static wake_recorder_reader_t app_recorder_reader;
 
 /*******************************************************************************
 * Function Name: handle_app_error
@@ -148,6 +278,12 @@ static uint32_t wakeup_src = 0U;
 *******************************************************************************/
 static void handle_app_error(void)
 {
+    /* Keep the telemetry since the last periodic write */
+    if (tfm_ready)
+    {
+        (void)power_manager_flush_telemetry(POWER_MANAGER_FLUSH_POWER_LOSS);
+    }
+
     /* Disable all interrupts. */
     __disable_irq();
 
@@ -161,9 +297,10 @@ static void handle_app_error(void)
 * Function Name: setup_clib_support
 ********************************************************************************
 * Summary:
-*    1. This function configures and initializes the Real-Time Clock (RTC).
-*    2. It then initializes the RTC HAL object to enable CLIB support library 
-*       to work with the provided Real-Time Clock (RTC) module.
+*    Initializes the RTC HAL object to enable CLIB support library to work
+*    with the provided Real-Time Clock (RTC) module. The RTC is owned by the
+*    POWER_MANAGER partition, which sets it on a cold boot; the application
+*    only reads it.
 *
 * Parameters:
 *  void
@@ -174,10 +311,6 @@ static void handle_app_error(void)
 *******************************************************************************/
 static void setup_clib_support(void)
 {
-    /* RTC Initialization */
-    Cy_RTC_Init(&CYBSP_RTC_config);
-    Cy_RTC_SetDateAndTime(&CYBSP_RTC_config);
-
     /* Initialize the ModusToolbox CLIB support library */
     mtb_clib_support_init(&rtc_obj);
 }
@@ -192,6 +325,9 @@ static void setup_clib_support(void)
 *       when idle task runs. LPTIMER_0 instance is configured for CM33 CPU.
 *    3. It then passes the LPTimer object to abstraction RTOS library that 
 *       implements tickless idle mode
+*    4. It sets the tickless idle span from the counter cascading: counters
+*       0 and 1 cascaded (design.modus) suppress up to 36 hours of ticks in
+*       one period, counter 0 alone 2 seconds
 *
 * Parameters:
 *  void
@@ -233,6 +369,10 @@ static void setup_tickless_idle_timer(void)
      * tickless idle mode 
      */
     cyabs_rtos_set_lptimer(&lptimer_obj);
+
+    tickless_idle_init(
+        (CY_MCWDT_CASCADE_C0C1 == Cy_MCWDT_GetCascade(CYBSP_CM33_LPTIMER_0_HW)) ||
+        (CY_MCWDT_CASCADE_BOTH == Cy_MCWDT_GetCascade(CYBSP_CM33_LPTIMER_0_HW)));
 }
 
 /*******************************************************************************
@@ -248,26 +388,50 @@ static void setup_tickless_idle_timer(void)
 *  void
 *
 *******************************************************************************/
+WAKE_PATH_FUNC_BEGIN
 cy_en_syspm_status_t deepsleep_callback(cy_stc_syspm_callback_params_t *callbackParams,
                                         cy_en_syspm_callback_mode_t mode)
 {
+    uint32_t exit_cycles = perf_counter_get();
+    power_manager_wakeup_info_t wakeup_info = { 0U, 0U };
+    uint64_t sleep_us;
+
     CY_UNUSED_PARAMETER(callbackParams);
 
     switch (mode)
     {
+        case CY_SYSPM_CHECK_READY:
+            /* Only the time: the wake-up source is taken at the exit, so an
+             * event before it is still seen by deepsleep_abort_callback() */
+            deepsleep_check_cycles = exit_cycles;
+            break;
         case CY_SYSPM_BEFORE_TRANSITION:
-            /* Clear the wake-up source */
-            power_manager_clr_wakeup_src();
             /* Turn On LED to indicate Deep Sleep Entry */
             Cy_GPIO_Set(CYBSP_USER_LED2_PORT, CYBSP_USER_LED2_PIN);
+            energy_monitor_set_load(ENERGY_LOAD_LED2, true);
+            energy_monitor_enter_deepsleep();
+            deepsleep_entry_us = energy_monitor_get_time_us();
+            power_event_publish(POWER_EVENT_SLEEP_ENTRY, 0U, 0U);
             break;
         case CY_SYSPM_AFTER_TRANSITION:
             /* Turn Off LED to indicate Deep Sleep Exit */
+            energy_monitor_exit_deepsleep();
+            sleep_us = energy_monitor_get_time_us() - deepsleep_entry_us;
+            if (sleep_us < APP_DEEPSLEEP_WASTED_US)
+            {
+                wake_monitor_on_wasted_sleep((uint32_t)sleep_us);
+            }
             Cy_GPIO_Clr(CYBSP_USER_LED2_PORT, CYBSP_USER_LED2_PIN);
-            /* Read the wake-up source */
-            power_manager_get_wakeup_src(&wakeup_src);
-            /* Unblock AppStateManager Task */
-            xTaskNotifyGive(vTaskHandelAppStateManager);
+            energy_monitor_set_load(ENERGY_LOAD_LED2, false);
+            /* Read and clear the wake-up source with the wake-up event
+             * count, without losing an event in between */
+            power_manager_take_wakeup_info(&wakeup_info);
+            wake_monitor_on_wakeup(wakeup_info.sources, wakeup_info.event_seq,
+                                   exit_cycles);
+            deepsleep_armed = false;
+            /* Unblock the AppStateManager Task and the other subscribers */
+            power_event_publish(POWER_EVENT_WAKE, wakeup_info.sources,
+                                wakeup_info.event_seq);
             break;
         default:
             break;
@@ -275,6 +439,337 @@ cy_en_syspm_status_t deepsleep_callback(cy_stc_syspm_callback_params_t *callback
     
     return CY_SYSPM_SUCCESS;
 }
+WAKE_PATH_FUNC_END
+
+/*******************************************************************************
+* Function Name: deepsleep_abort_callback
+********************************************************************************
+* Summary:
+*  Last CHECK_READY callback of a DeepSleep entry. A wake-up event handled by
+*  the partition since the App State Manager started to wait, or a pending NS
+*  interrupt, would end the sleep at once; the entry is aborted instead and
+*  the event is handled like a wake-up. Of the callbacks before it, only
+*  deepsleep_callback() runs in CHECK_READY, and it only takes a timestamp,
+*  so no callback has a CHECK_FAIL step to undo.
+*
+* Parameter:
+*  callbackParams - unused
+*  mode           - CY_SYSPM_CHECK_READY
+*
+* Return:
+*  cy_en_syspm_status_t - CY_SYSPM_FAIL to abort the entry
+*
+*******************************************************************************/
+cy_en_syspm_status_t deepsleep_abort_callback(cy_stc_syspm_callback_params_t *callbackParams,
+                                              cy_en_syspm_callback_mode_t mode)
+{
+    power_manager_wakeup_info_t wakeup_info = { 0U, 0U };
+    bool event = false;
+    bool pending = false;
+    uint32_t gen;
+    uint32_t i;
+
+    CY_UNUSED_PARAMETER(callbackParams);
+    CY_UNUSED_PARAMETER(mode);
+
+    /* The state generation is read without a secure call */
+    if (deepsleep_armed && power_manager_get_state_gen(&gen) && (gen != deepsleep_gen))
+    {
+        event = true;
+    }
+
+    /* Secure interrupts read as not pending from the NSPE */
+    for (i = 0U; i < (sizeof(NVIC->ISPR) / sizeof(NVIC->ISPR[0])); i++)
+    {
+        if (0U != (NVIC->ISPR[i] & NVIC->ISER[i]))
+        {
+            pending = true;
+        }
+    }
+
+    if (!event && !pending)
+    {
+        return CY_SYSPM_SUCCESS;
+    }
+
+    wake_monitor_on_abort(deepsleep_check_cycles);
+    if (event)
+    {
+        power_manager_take_wakeup_info(&wakeup_info);
+        wake_monitor_on_wakeup(wakeup_info.sources, wakeup_info.event_seq,
+                               perf_counter_get());
+        deepsleep_armed = false;
+        power_event_publish(POWER_EVENT_WAKE, wakeup_info.sources,
+                            wakeup_info.event_seq);
+    }
+
+    return CY_SYSPM_FAIL;
+}
+
+#if (APP_PSA_BATCH_BENCH != 0)
+/*******************************************************************************
+* Function Name: psa_batch_bench
+********************************************************************************
+* Summary:
+*  Measures the POWER_MANAGER operations of a wake-up done as single secure
+*  calls, as one batch and answered by the NS side cache, and logs the mean
+*  cost per operation.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void psa_batch_bench(void)
+{
+    static const power_manager_cmd_t bench_cmds[] =
+    {
+        { POWER_MANAGER_GET_WAKEUP_INFO, 0U },
+        { POWER_MANAGER_GET_RATE_LIMIT, WAKEUP_SOURCE_USER_BTN1 },
+        { POWER_MANAGER_GET_WAKEUP_SOURCE, 0U },
+        { POWER_MANAGER_CLR_WAKEUP_SOURCE, 0U },
+    };
+    const uint32_t ops = sizeof(bench_cmds) / sizeof(bench_cmds[0]);
+    power_manager_result_t bench_results[sizeof(bench_cmds) / sizeof(bench_cmds[0])];
+    power_manager_wakeup_info_t wakeup_info;
+    power_manager_rate_limit_t rate_limit;
+    uint32_t sources;
+    perf_stat_t single;
+    perf_stat_t batch;
+    perf_stat_t cached;
+    power_manager_cache_stats_t cache_stats;
+    uint32_t start;
+    uint32_t run;
+
+    perf_stat_reset(&single);
+    perf_stat_reset(&batch);
+    perf_stat_reset(&cached);
+
+    for (run = 0U; run < APP_PSA_BATCH_BENCH_RUNS; run++)
+    {
+        power_manager_set_cache_enabled(false);
+        start = perf_counter_get();
+        (void)power_manager_get_wakeup_info(&wakeup_info);
+        (void)power_manager_get_rate_limit(WAKEUP_SOURCE_USER_BTN1, &rate_limit);
+        (void)power_manager_get_wakeup_src(&sources);
+        (void)power_manager_clr_wakeup_src();
+        perf_stat_add(&single, perf_counter_get() - start);
+
+        start = perf_counter_get();
+        (void)power_manager_batch(bench_cmds, bench_results, ops);
+        perf_stat_add(&batch, perf_counter_get() - start);
+
+        /* The same calls with the NS side cache, the first run fills it */
+        power_manager_set_cache_enabled(true);
+        (void)power_manager_get_wakeup_info(&wakeup_info);
+        (void)power_manager_get_rate_limit(WAKEUP_SOURCE_USER_BTN1, &rate_limit);
+        start = perf_counter_get();
+        (void)power_manager_get_wakeup_info(&wakeup_info);
+        (void)power_manager_get_rate_limit(WAKEUP_SOURCE_USER_BTN1, &rate_limit);
+        (void)power_manager_get_wakeup_src(&sources);
+        (void)power_manager_clr_wakeup_src();
+        perf_stat_add(&cached, perf_counter_get() - start);
+    }
+    power_manager_get_cache_stats(&cache_stats);
+
+    LOG(" Secure Calls   : %lu ops, single %lu cycles/op, batch %lu cycles/op\r\n",
+        (unsigned long)ops,
+        (unsigned long)(single.total / ((uint64_t)single.count * ops)),
+        (unsigned long)(batch.total / ((uint64_t)batch.count * ops)));
+    LOG(" NS Cache       : %lu cycles/op unchanged state, %lu hits, %lu misses\r\n\n",
+        (unsigned long)(cached.total / ((uint64_t)cached.count * ops)),
+        (unsigned long)cache_stats.hits, (unsigned long)cache_stats.misses);
+}
+#endif /* APP_PSA_BATCH_BENCH */
+
+/*******************************************************************************
+* Function Name: vApplicationTickHook
+********************************************************************************
+* Summary:
+*  Measures the tick period to detect NS interrupt blackouts caused by
+*  secure interrupts.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void vApplicationTickHook(void)
+{
+    spe_profiler_on_tick();
+}
+
+/*******************************************************************************
+* Function Name: app_telemetry_take
+********************************************************************************
+* Summary:
+*  Appends the telemetry records not yet sent to a secure command list. The
+*  DeepSleep residency is taken out of the unsent total until the result of
+*  the command is known, so that the App State Manager and the deferred job
+*  never send it twice.
+*
+* Parameters:
+*  cmds           - room for 2 commands
+*  latency_max_us - worst wake-to-task latency seen so far
+*
+* Return:
+*  uint32_t - number of commands appended
+*
+*******************************************************************************/
+static uint32_t app_telemetry_take(power_manager_cmd_t *cmds, uint32_t latency_max_us)
+{
+    uint32_t intr_state = Cy_SysLib_EnterCriticalSection();
+    uint32_t count = 0U;
+
+    if (0U != app_telemetry_deepsleep_ms)
+    {
+        cmds[count].op = POWER_MANAGER_RECORD_DEEPSLEEP;
+        cmds[count].arg = app_telemetry_deepsleep_ms;
+        app_telemetry_deepsleep_ms = 0U;
+        count++;
+    }
+    if (latency_max_us > app_telemetry_latency_us)
+    {
+        cmds[count].op = POWER_MANAGER_RECORD_LATENCY;
+        cmds[count].arg = latency_max_us;
+        count++;
+    }
+    Cy_SysLib_ExitCriticalSection(intr_state);
+
+    return count;
+}
+
+/*******************************************************************************
+* Function Name: app_telemetry_sent
+********************************************************************************
+* Summary:
+*  Completes the commands of app_telemetry_take(). Records that failed are
+*  sent again with the next batch.
+*
+* Parameters:
+*  cmds    - commands returned by app_telemetry_take()
+*  results - results of the commands, unused if the batch failed
+*  count   - number of commands
+*  sent    - the batch call succeeded
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void app_telemetry_sent(const power_manager_cmd_t *cmds,
+                               const power_manager_result_t *results,
+                               uint32_t count, bool sent)
+{
+    uint32_t intr_state = Cy_SysLib_EnterCriticalSection();
+    uint32_t i;
+
+    for (i = 0U; i < count; i++)
+    {
+        if (POWER_MANAGER_RECORD_DEEPSLEEP == cmds[i].op)
+        {
+            if (!sent || (PSA_SUCCESS != results[i].status))
+            {
+                app_telemetry_deepsleep_ms += cmds[i].arg;
+            }
+        }
+        else if (sent && (PSA_SUCCESS == results[i].status) &&
+                 (cmds[i].arg > app_telemetry_latency_us))
+        {
+            app_telemetry_latency_us = cmds[i].arg;
+        }
+    }
+    Cy_SysLib_ExitCriticalSection(intr_state);
+}
+
+/*******************************************************************************
+* Function Name: app_telemetry_add_deepsleep
+********************************************************************************
+* Summary:
+*  Adds DeepSleep residency to the unsent telemetry.
+*
+* Parameters:
+*  ms - DeepSleep residency
+*
+* Return:
+*  bool - the unsent residency has reached APP_TELEMETRY_REPORT_MS
+*
+*******************************************************************************/
+static bool app_telemetry_add_deepsleep(uint32_t ms)
+{
+    uint32_t intr_state = Cy_SysLib_EnterCriticalSection();
+    bool due;
+
+    app_telemetry_deepsleep_ms += ms;
+    due = (app_telemetry_deepsleep_ms >= APP_TELEMETRY_REPORT_MS);
+    Cy_SysLib_ExitCriticalSection(intr_state);
+
+    return due;
+}
+
+/*******************************************************************************
+* Function Name: app_telemetry_job
+********************************************************************************
+* Summary:
+*  Deferred job that sends the telemetry in a secure call of its own when no
+*  IDLE exit had other secure commands to carry it.
+*
+* Parameters:
+*  arg - unused
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void app_telemetry_job(void *arg)
+{
+    power_manager_cmd_t cmds[2];
+    power_manager_result_t results[2];
+    wake_monitor_stats_t wake_stats;
+    uint32_t count;
+
+    CY_UNUSED_PARAMETER(arg);
+
+    wake_monitor_get_stats(&wake_stats);
+    count = app_telemetry_take(cmds, wake_stats.latency_max_us);
+    if (0U != count)
+    {
+        app_telemetry_sent(cmds, results, count,
+                           PSA_SUCCESS == power_manager_batch(cmds, results, count));
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_recorder_dump
+********************************************************************************
+* Summary:
+*  Logs the wake recorder records not yet logged as timeline lines, once
+*  WAKE_RECORDER_DUMP_RECORDS are waiting or when all is set. Does nothing
+*  unless built with APP_WAKE_RECORDER.
+*
+* Parameters:
+*  all - log even a few records, before they would be lost
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void app_recorder_dump(bool all)
+{
+    char line[WAKE_RECORDER_LINE_SIZE];
+
+    if (!all && (wake_recorder_pending(&app_recorder_reader) < WAKE_RECORDER_DUMP_RECORDS))
+    {
+        return;
+    }
+    while (wake_recorder_read_line(&app_recorder_reader, line, sizeof(line)))
+    {
+        LOG("%s\r\n", line);
+    }
+}
 
 /********************************************************************************
  * Function Name: vHeartBeatTask
@@ -297,6 +792,8 @@ static void vHeartBeatTask(void* pvParameters)
     {
         /* Toggle LED1 according to HeartBeat Frequency */
         Cy_GPIO_Inv(CYBSP_USER_LED1_PORT, CYBSP_USER_LED1_PIN);
+        energy_monitor_set_load(ENERGY_LOAD_LED1,
+            0UL != Cy_GPIO_ReadOut(CYBSP_USER_LED1_PORT, CYBSP_USER_LED1_PIN));
         vTaskDelay(HEART_BEAT_FREQ_MS / portTICK_PERIOD_MS);
     }
 }
@@ -319,8 +816,52 @@ static void vAppStateManagerTask(void* pvParameters)
     en_app_state_t app_state_next = APP_STATE_ACTIVE;
     bool tasks_suspended = false;
     uint32_t timeout_cnt = 0;
-
+    energy_estimate_t energy;
+    wake_monitor_stats_t wake_stats;
+    uint32_t notifications;
+    uint32_t wakeup_src = 0U;
+    power_event_t event;
+    uint32_t spurious_wakes = 0U;
+    power_manager_wakeup_info_t wakeup_info;
+    uint32_t wake_timer_id = 0U;
+    power_manager_cmd_t cmds[APP_WAKE_CMDS_MAX];
+    power_manager_result_t results[APP_WAKE_CMDS_MAX];
+    uint32_t cmd_count;
+    uint32_t rate_limit_cmd;
+    uint32_t telemetry_cmd;
+    psa_status_t batch_status;
+    energy_account_t energy_account;
+    spe_profiler_service_t blackout_service;
+    uint32_t blackout_us;
+    power_manager_cache_stats_t cache_stats;
+    tickless_idle_stats_t tickless_stats;
+    deferred_work_stats_t deferred_stats;
+    wake_resume_stats_t resume_stats;
+    hibernate_stats_t startup;
+    hibernate_snapshot_t snapshot;
+    power_manager_cmd_t hibernate_cmds[APP_HIBERNATE_CMDS_MAX];
+    power_manager_result_t hibernate_results[APP_HIBERNATE_CMDS_MAX];
+    uint32_t hibernate_timer_cmd;
+    uint32_t hibernate_timer_id;
+    TickType_t idle_start;
+
+    hibernate_on_first_task();
+    app_wake_sub.task = xTaskGetCurrentTaskHandle();
+    power_event_subscribe(&app_wake_sub);
     LOG(" App State Manager Task - Running\r\n");
+    hibernate_get_stats(&startup);
+    LOG(" Start-up        : %lu us from main() to this task, %s\r\n",
+        (unsigned long)startup.startup_us,
+        app_resumed ? "Hibernate resume" : "cold boot");
+    if (app_resumed)
+    {
+        /* Continue where the Hibernate entry left off */
+        LOG(" App State Switch: APP_STATE_HIBERNATE -> APP_STATE_ACTIVE\r\n");
+        LOG(" Reason          : %s (Hibernate %lu)\r\n",
+            (0U != (startup.wakeup_cause & (uint32_t)CY_SYSPM_HIBERNATE_RTC_ALARM)) ?
+            "Secure Timer" : "Hibernate Wake-up Pin",
+            (unsigned long)app_snapshot.hibernations);
+    }
     vTaskDelay(1U / portTICK_PERIOD_MS);
 
     for (;;)
@@ -338,10 +879,23 @@ static void vAppStateManagerTask(void* pvParameters)
                     tasks_suspended = false;
                 }
 
+                /* CM55 is off after a Hibernate resume or a failed boot.
+                 * Boot it again if it has a job. */
+                if ((0 != APP_CM55_POWER_MANAGER) &&
+                    (CM55_POWER_STATE_OFF == cm55_power_get_state()) &&
+                    (CY_RSLT_SUCCESS != cm55_power_on()))
+                {
+                    LOG(" CM55 cold start: timeout\r\n");
+                }
+
                 /* In Active State */
                 app_state = APP_STATE_ACTIVE;
+                power_event_publish(POWER_EVENT_APP_STATE, 0U, (uint32_t)app_state);
+                perf_governor_set_app_state(app_state);
                 LOG(" Current App State: APP_STATE_ACTIVE\r\n");
                 LOG(" -----------------------------------\r\n");
+                LOG(" Performance Mode : %s\r\n",
+                    perf_policy_mode_name(perf_governor_get_mode()));
                 timeout_cnt = 0;
                 while(timeout_cnt != APP_STATE_ACTIVE_TIME_MS)
                 {
@@ -356,23 +910,239 @@ static void vAppStateManagerTask(void* pvParameters)
             }
             break;
 
+            case APP_STATE_HIBERNATE:
+            {
+                /* In Hibernate State */
+                app_state = APP_STATE_HIBERNATE;
+                power_event_publish(POWER_EVENT_APP_STATE, 0U, (uint32_t)app_state);
+                LOG(" Current App State: APP_STATE_HIBERNATE\r\n");
+                LOG(" --------------------------------------\r\n");
+
+                /* The Idle time before the entry completes the cycle */
+                energy_monitor_end_cycle(&energy, &energy_account);
+                wake_recorder_add_cycle((uint32_t)(energy.total_nj / 1000U));
+                (void)app_telemetry_add_deepsleep(
+                    (uint32_t)(energy_account.state_us[ENERGY_STATE_DEEPSLEEP] / 1000U));
+
+                /* Secure work of the entry in one secure call. The partition
+                 * loses its RAM in Hibernate: the telemetry is written to
+                 * storage, and only the RTC alarm of the earliest timer
+                 * survives. */
+                cmd_count = 0U;
+                if (0U != wake_timer_id)
+                {
+                    hibernate_cmds[cmd_count].op = POWER_MANAGER_WAKE_CANCEL;
+                    hibernate_cmds[cmd_count].arg = wake_timer_id;
+                    cmd_count++;
+                }
+                hibernate_timer_cmd = cmd_count;
+                if (0U != APP_HIBERNATE_WAKE_S)
+                {
+                    hibernate_cmds[cmd_count].op = POWER_MANAGER_WAKE_AFTER;
+                    hibernate_cmds[cmd_count].arg = APP_HIBERNATE_WAKE_S;
+                    cmd_count++;
+                }
+                telemetry_cmd = cmd_count;
+                cmd_count += app_telemetry_take(&hibernate_cmds[cmd_count],
+                                                wake_stats.latency_max_us);
+                hibernate_cmds[cmd_count].op = POWER_MANAGER_FLUSH_TELEMETRY;
+                hibernate_cmds[cmd_count].arg = POWER_MANAGER_FLUSH_POWER_LOSS;
+                batch_status = power_manager_batch(hibernate_cmds, hibernate_results,
+                                                   cmd_count + 1U);
+                app_telemetry_sent(&hibernate_cmds[telemetry_cmd],
+                                   &hibernate_results[telemetry_cmd],
+                                   cmd_count - telemetry_cmd, PSA_SUCCESS == batch_status);
+                wake_timer_id = 0U;
+                hibernate_timer_id = 0U;
+                if ((PSA_SUCCESS == batch_status) && (hibernate_timer_cmd < telemetry_cmd) &&
+                    (PSA_SUCCESS == hibernate_results[hibernate_timer_cmd].status))
+                {
+                    hibernate_timer_id = hibernate_results[hibernate_timer_cmd].data.value;
+                }
+
+                /* Snapshot of the state to restore after the wake-up */
+                snapshot.app_state = (uint32_t)APP_STATE_HIBERNATE;
+                snapshot.hibernations = app_snapshot.hibernations + 1U;
+                snapshot.wake_after_s = (0U != hibernate_timer_id) ? APP_HIBERNATE_WAKE_S : 0U;
+                snapshot.telemetry_ms = app_telemetry_deepsleep_ms;
+                LOG(" Hibernate Wake  : %s%lu s\r\n",
+                    (0U != hibernate_timer_id) ? "USER BTN1 or secure timer in " :
+                                                 "USER BTN1 only, ",
+                    (unsigned long)snapshot.wake_after_s);
+                /* The recorder loses its RAM as well */
+                app_recorder_dump(true);
+                LOG_WAIT_FOR_TX_COMPLETE();
+
+                (void)hibernate_enter(&snapshot, (uint32_t)APP_HIBERNATE_WAKEUP_PIN |
+                    ((0U != hibernate_timer_id) ? (uint32_t)CY_SYSPM_HIBERNATE_RTC_ALARM : 0U));
+
+                /* Still awake: a SysPm callback refused the entry */
+                if (0U != hibernate_timer_id)
+                {
+                    (void)power_manager_wake_cancel(hibernate_timer_id);
+                }
+                LOG(" App State Switch: APP_STATE_HIBERNATE -> APP_STATE_IDLE\r\n");
+                LOG(" Reason          : Hibernate Entry Failed\r\n");
+                app_state_next = APP_STATE_IDLE;
+            }
+            break;
+
             default:
             {
-                /* Idle State Set-up*/
+                /* Idle State Set-up. From here on, a wake-up event aborts
+                 * the next DeepSleep entry. Wake-ups before it do not
+                 * count, and their sources are taken here; no secure call
+                 * when there was none. */
+                while (power_event_take(&app_wake_sub, &event))
+                {
+                }
+                (void)power_manager_take_wakeup_info(&wakeup_info);
+                deepsleep_armed = power_manager_get_state_gen(&deepsleep_gen);
                 vTaskSuspend(vTaskHandelHeartBeat);
                 tasks_suspended = true;
 
+                /* CM55 is left on only for its wake-up checks */
+                cm55_power_idle(APP_CM55_IDLE_NEXT_JOB_MS);
+
                 /* In Idle State */
                 app_state = APP_STATE_IDLE;
+                power_event_publish(POWER_EVENT_APP_STATE, 0U, (uint32_t)app_state);
+                perf_governor_set_app_state(app_state);
                 LOG(" Current App State: APP_STATE_IDLE\r\n");
                 LOG(" ---------------------------------\r\n");
                 LOG_WAIT_FOR_TX_COMPLETE();
                 Cy_GPIO_Clr(CYBSP_USER_LED1_PORT, CYBSP_USER_LED1_PIN);
-                ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+                energy_monitor_set_load(ENERGY_LOAD_LED1, false);
+                if ((0U != APP_IDLE_WAKE_INTERVAL_S) &&
+                    (PSA_SUCCESS != power_manager_wake_after(APP_IDLE_WAKE_INTERVAL_S,
+                                                             &wake_timer_id)))
+                {
+                    wake_timer_id = 0U;
+                }
+                idle_start = xTaskGetTickCount();
+                notifications = ulTaskNotifyTake(pdTRUE, APP_IDLE_TIMEOUT_TICKS);
+                wakeup_src = 0U;
+                while (power_event_take(&app_wake_sub, &event))
+                {
+                    wakeup_src |= event.sources;
+                }
+                wake_monitor_on_task_wake(notifications);
+                wake_monitor_get_stats(&wake_stats);
+
+                /* The wait ends without a wake-up event, or with the DeepSleep
+                 * exit at its end */
+                if ((0U != APP_HIBERNATE_IDLE_S) && (0U == wakeup_src) &&
+                    ((xTaskGetTickCount() - idle_start) >= APP_IDLE_TIMEOUT_TICKS))
+                {
+                    deepsleep_armed = false;
+                    LOG(" App State Switch: APP_STATE_IDLE -> APP_STATE_HIBERNATE\r\n");
+                    LOG(" Reason          : Idle State Timeout\r\n");
+                    app_state_next = APP_STATE_HIBERNATE;
+                    break;
+                }
+
+                /* Secure work of the wake-up in one secure call. The timed
+                 * wake-up is not needed once woken by the button. Wakes
+                 * without an event, which do not end the wait, come from a
+                 * rate limited wake-up source or from the end of its
+                 * backoff. */
+                cmd_count = 0U;
+                if ((0U != wake_timer_id) && (0U == (wakeup_src & WAKEUP_SOURCE_TIMER)))
+                {
+                    cmds[cmd_count].op = POWER_MANAGER_WAKE_CANCEL;
+                    cmds[cmd_count].arg = wake_timer_id;
+                    cmd_count++;
+                }
+                rate_limit_cmd = cmd_count;
+                if (wake_stats.spurious_wakes != spurious_wakes)
+                {
+                    cmds[cmd_count].op = POWER_MANAGER_GET_RATE_LIMIT;
+                    cmds[cmd_count].arg = WAKEUP_SOURCE_USER_BTN1;
+                    cmd_count++;
+                }
+                telemetry_cmd = cmd_count;
+                if (0U != cmd_count)
+                {
+                    cmd_count += app_telemetry_take(&cmds[cmd_count], wake_stats.latency_max_us);
+                }
+                batch_status = PSA_SUCCESS;
+                if (0U != cmd_count)
+                {
+                    batch_status = power_manager_batch(cmds, results, cmd_count);
+                }
+                app_telemetry_sent(&cmds[telemetry_cmd], &results[telemetry_cmd],
+                                   cmd_count - telemetry_cmd, PSA_SUCCESS == batch_status);
+                if (PSA_SUCCESS != batch_status)
+                {
+                    cmd_count = 0U;
+                }
+                wake_timer_id = 0U;
+                spurious_wakes = wake_stats.spurious_wakes;
 
                 /* Time to move to next state */
                 LOG(" App State Switch: APP_STATE_IDLE -> APP_STATE_ACTIVE\r\n");
-                LOG(" Reason          : %s\r\n", wakeup_src ? "User Button-1 Interrupt" : "Unkown Interrupt");
+                LOG(" Reason          : %s\r\n",
+                    (wakeup_src & WAKEUP_SOURCE_USER_BTN1) ? "User Button-1 Interrupt" :
+                    (wakeup_src & WAKEUP_SOURCE_USER_BTN2) ? "User Button-2 Interrupt" :
+                    (wakeup_src & WAKEUP_SOURCE_TIMER) ? "Secure Timer" : "Unkown Interrupt");
+
+                /* One ACTIVE + IDLE cycle completed */
+                energy_monitor_end_cycle(&energy, &energy_account);
+                wake_recorder_add_cycle((uint32_t)(energy.total_nj / 1000U));
+                if (app_telemetry_add_deepsleep(
+                        (uint32_t)(energy_account.state_us[ENERGY_STATE_DEEPSLEEP] / 1000U)))
+                {
+                    /* No IDLE exit had a batch to carry it */
+                    (void)deferred_work_submit(app_telemetry_job, NULL,
+                                               APP_TELEMETRY_DEADLINE_MS);
+                }
+                LOG(" Cycle Energy    : %lu uJ in %lu ms (average %lu uA)\r\n",
+                    (unsigned long)(energy.total_nj / 1000U),
+                    (unsigned long)(energy.duration_us / 1000U),
+                    (unsigned long)energy.average_ua);
+                LOG(" Wake Events     : %lu (%lu coalesced, %lu spurious wakes)\r\n",
+                    (unsigned long)wake_stats.events,
+                    (unsigned long)wake_stats.events_coalesced,
+                    (unsigned long)wake_stats.spurious_wakes);
+                LOG(" Sleep Entries   : %lu aborted (%lu us), %lu wasted (%lu us)\r\n",
+                    (unsigned long)wake_stats.aborts,
+                    (unsigned long)wake_stats.abort_us,
+                    (unsigned long)wake_stats.wasted_sleeps,
+                    (unsigned long)wake_stats.wasted_us);
+                if ((rate_limit_cmd < cmd_count) &&
+                    (PSA_SUCCESS == results[rate_limit_cmd].status))
+                {
+                    LOG(" Wake Throttle   : %lu dropped, %lu masks, %s\r\n",
+                        (unsigned long)results[rate_limit_cmd].data.rate_limit.throttled_events,
+                        (unsigned long)results[rate_limit_cmd].data.rate_limit.mask_count,
+                        (0U != results[rate_limit_cmd].data.rate_limit.masked) ? "masked" : "unmasked");
+                }
+                wake_resume_get_stats(&resume_stats);
+                LOG(" Wake Resume     : %lu us (max %lu us) with the wake path in %s, wake-to-task p99 %lu us\r\n",
+                    (unsigned long)resume_stats.last_us,
+                    (unsigned long)resume_stats.max_us,
+                    resume_stats.in_ram ? "RAM" : "flash",
+                    (unsigned long)wake_monitor_latency_percentile_us(990U));
+                blackout_us = spe_profiler_worst_blackout_us(&blackout_service);
+                LOG(" NS Blackout     : %lu us worst (%s), POWER_MANAGER p99 %lu us\r\n",
+                    (unsigned long)blackout_us,
+                    spe_profiler_service_name(blackout_service),
+                    (unsigned long)spe_profiler_percentile_us(SPE_PROFILER_POWER_MANAGER, 990U));
+                power_manager_get_cache_stats(&cache_stats);
+                LOG(" Secure Cache    : %lu hits, %lu misses\r\n",
+                    (unsigned long)cache_stats.hits,
+                    (unsigned long)cache_stats.misses);
+                tickless_idle_get_stats(&tickless_stats);
+                LOG(" Tickless Idle   : %lu overflow wakes in %lu periods, longest %lu ms\r\n",
+                    (unsigned long)tickless_stats.overflow_wakes,
+                    (unsigned long)tickless_stats.sleeps,
+                    (unsigned long)(tickless_stats.longest_sleep_ticks * portTICK_PERIOD_MS));
+                deferred_work_get_stats(&deferred_stats);
+                LOG(" Deferred Work   : %lu jobs in %lu sleep and %lu deadline batches\r\n",
+                    (unsigned long)deferred_stats.jobs_run,
+                    (unsigned long)deferred_stats.sleep_batches,
+                    (unsigned long)deferred_stats.deadline_batches);
+                app_recorder_dump(false);
                 app_state_next = APP_STATE_ACTIVE;
             }
             break;
@@ -401,8 +1171,12 @@ static void vAppStateManagerTask(void* pvParameters)
 int main(void)
 {
     cy_rslt_t result;
+    cy_rslt_t cm55_boot_rslt;
     uint32_t rslt;
     BaseType_t status;
+    cm55_power_stats_t cm55_stats;
+    sram_retention_stats_t sram_stats;
+    power_manager_wakeup_info_t wakeup_info;
 
     /* Initialize the device and board peripherals */
     result = cybsp_init();
@@ -413,17 +1187,53 @@ int main(void)
         handle_app_error();
     }
 
+    /* Start the cycle counter used for latency and start-up measurements */
+    perf_counter_init();
+
+    /* After a Hibernate wake-up, continue from the snapshot of the entry */
+    app_resumed = hibernate_init(&app_snapshot);
+    if (app_resumed)
+    {
+        app_telemetry_deepsleep_ms = app_snapshot.telemetry_ms;
+    }
+
     /* Setup CLIB support library. */
     setup_clib_support();
 
     /* Setup the LPTimer instance for CM33 CPU. */
     setup_tickless_idle_timer();
 
+    /* Track power state residency with the LPTimer as time base */
+    energy_monitor_init(&lptimer_obj);
+
     /* Register Deepsleep entry/exit callback */
     Cy_SysPm_RegisterCallback(&sys_ds_cback);
+    Cy_SysPm_RegisterCallback(&sys_ds_abort_cback);
 
-    /* Enable CM55. */
-    Cy_SysEnableCM55(MXCM55, CM55_APP_BOOT_ADDR, CM55_BOOT_WAIT_TIME_USEC);
+    wake_monitor_init();
+    spe_profiler_init();
+
+    /* Record the power events for a replay on the host, if built in */
+    wake_recorder_init();
+
+    /* Start the power domain manager before the domain users */
+    pd_manager_init();
+
+    /* Power down the SRAM macros without live data in DeepSleep */
+    sram_retention_init();
+
+    /* Time the DeepSleep exits */
+    wake_resume_init();
+
+    /* Enable CM55. The idle policy powers it off again unless it has a job
+     * in the Idle state, see APP_CM55_IDLE_NEXT_JOB_MS. After a Hibernate
+     * resume the Active state boots it if needed. */
+    cm55_power_init();
+    cm55_boot_rslt = CY_RSLT_SUCCESS;
+    if (!app_resumed)
+    {
+        cm55_boot_rslt = cm55_power_on();
+    }
 
     /* Enable global interrupts */
     __enable_irq();
@@ -434,12 +1244,68 @@ int main(void)
     {
         handle_app_error();
     }
+    tfm_ready = true;
 
-    /* \x1b[2J\x1b[;H - ANSI ESC sequence for clear screen */
-    LOG("\x1b[2J\x1b[;H");
+    /* Log messages are sent in the background once the scheduler runs, and
+     * in batches the secure UART FIFO has room for from here on */
+    if (!log_transport_init())
+    {
+        handle_app_error();
+    }
+
+    /* Start without a wake-up source. The take of every IDLE entry is then
+     * answered by the NS side cache unless a wake-up event came. */
+    (void)power_manager_take_wakeup_info(&wakeup_info);
+
+    if (app_resumed)
+    {
+        /* The banner was shown by the cold boot */
+        LOG("\r\n**** Resumed from Hibernate ****\r\n\n");
+    }
+    else
+    {
+        /* \x1b[2J\x1b[;H - ANSI ESC sequence for clear screen */
+        LOG("\x1b[2J\x1b[;H");
 
-    LOG("**** PSOC Edge MCU: Secure Power Management (using TF_M) ****\r\n\n");
+        LOG("**** PSOC Edge MCU: Secure Power Management (using TF_M) ****\r\n\n");
+
+        cm55_power_get_stats(&cm55_stats);
+        if (CY_RSLT_SUCCESS == cm55_boot_rslt)
+        {
+            LOG(" CM55 cold start: %lu us (CM55 main to ready: %lu cycles)\r\n\n",
+                (unsigned long)perf_counter_cycles_to_us(cm55_stats.cold_start.last),
+                (unsigned long)cm55_stats.main_to_ready_cycles);
+        }
+        else
+        {
+            LOG(" CM55 cold start: timeout\r\n\n");
+        }
+        LOG(" Tickless idle  : up to %lu ticks per period\r\n\n",
+            (unsigned long)tickless_idle_max_suppressible_ticks());
+
+        sram_retention_get_stats(&sram_stats);
+        if (0U != sram_stats.saved_na)
+        {
+            LOG(" SRAM retention : %lu of %lu KB off in DeepSleep, %lu nA saved\r\n\n",
+                (unsigned long)sram_stats.off_kb,
+                (unsigned long)(sram_stats.off_kb + sram_stats.retained_kb),
+                (unsigned long)sram_stats.saved_na);
+        }
+        else
+        {
+            LOG(" SRAM retention : %lu of %lu KB off in DeepSleep\r\n\n",
+                (unsigned long)sram_stats.off_kb,
+                (unsigned long)(sram_stats.off_kb + sram_stats.retained_kb));
+        }
+    }
  
+#if (APP_PSA_BATCH_BENCH != 0)
+    psa_batch_bench();
+#endif
+
+    /* Start the performance mode governor */
+    perf_governor_init();
+
     /* Create Tasks */
     status = xTaskCreate(vHeartBeatTask, "HeartBeat", TASK_STACK_SIZE,
                          NULL, TASK_PRIORITY, &vTaskHandelHeartBeat);
@@ -454,6 +1320,15 @@ int main(void)
         handle_app_error();
     }
 
+    /* Background jobs run before DeepSleep entries */
+    if (!deferred_work_init())
+    {
+        handle_app_error();
+    }
+
+    /* Power down the domains nobody took a reference on */
+    pd_manager_release_unused();
+
     /* Start the Scheduler */
     vTaskStartScheduler();
 
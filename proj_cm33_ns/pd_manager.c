@@ -0,0 +1,444 @@
+/*****************************************************************************
+* File Name        : pd_manager.c
+*
+* Description      : This source file implements the reference counted power
+*                    domain manager. Domains are powered while at least one
+*                    user holds a reference and may be dropped before
+*                    DeepSleep and restored on their first use after wake-up.
+*
+* Related Document : See README.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+
+#include "cybsp.h"
+#include "cy_pdl.h"
+
+#include "pd_manager.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Domains are dropped after the callbacks of their drivers ran */
+#define PD_MANAGER_CALLBACK_ORDER   (250U)
+
+/*******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+typedef struct
+{
+    const pd_domain_ops_t *ops;
+    pd_domain_stats_t stats;
+    bool dropped;
+} pd_domain_entry_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+static cy_en_syspm_status_t pd_manager_deepsleep_callback(
+                                cy_stc_syspm_callback_params_t *callbackParams,
+                                cy_en_syspm_callback_mode_t mode);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/* PD1 keeps the CM55 state and SOCMEM. The CM55 power control holds it
+ * while CM55 runs; the CM33 image keeps no data in SOCMEM, the CM55 boot
+ * status lives in SRAM (cm55_boot_status.h). */
+static const pd_domain_ops_t pd1_ops =
+{
+    .name = "PD1",
+    .power_on = Cy_System_EnablePD1,
+    .power_off = Cy_System_DisablePD1,
+    .drop_in_deepsleep = false,
+    .on_at_boot = true
+};
+
+static pd_domain_entry_t pd_domains[PD_MANAGER_MAX_DOMAINS];
+
+static cy_stc_syspm_callback_params_t pd_cback_params =
+{
+    .base = NULL,
+    .context = NULL
+};
+
+static cy_stc_syspm_callback_t pd_ds_cback =
+{
+    .callback = pd_manager_deepsleep_callback,
+    .type = CY_SYSPM_DEEPSLEEP,
+    .skipMode = ~(CY_SYSPM_BEFORE_TRANSITION),
+    .callbackParams = &pd_cback_params,
+    .prevItm = NULL,
+    .nextItm = NULL,
+    .order = PD_MANAGER_CALLBACK_ORDER
+};
+
+/*******************************************************************************
+* Function Name: pd_manager_get_entry
+********************************************************************************
+* Summary:
+*  Returns the entry of a registered domain.
+*
+* Parameters:
+*  domain - domain id
+*
+* Return:
+*  pd_domain_entry_t* - domain entry, or NULL if not registered
+*
+*******************************************************************************/
+static pd_domain_entry_t *pd_manager_get_entry(pd_domain_t domain)
+{
+    if (((uint32_t)domain >= PD_MANAGER_MAX_DOMAINS) ||
+        (NULL == pd_domains[domain].ops))
+    {
+        return NULL;
+    }
+
+    return &pd_domains[domain];
+}
+
+/*******************************************************************************
+* Function Name: pd_manager_power_on
+********************************************************************************
+* Summary:
+*  Powers a domain on if it is off. Called with interrupts masked.
+*
+* Parameters:
+*  entry - domain entry
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void pd_manager_power_on(pd_domain_entry_t *entry)
+{
+    if (!entry->stats.powered)
+    {
+        entry->ops->power_on();
+        entry->stats.powered = true;
+        entry->stats.on_count++;
+        if (entry->dropped)
+        {
+            entry->dropped = false;
+            entry->stats.lazy_restores++;
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: pd_manager_power_off
+********************************************************************************
+* Summary:
+*  Powers a domain off if it is on. Called with interrupts masked.
+*
+* Parameters:
+*  entry - domain entry
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void pd_manager_power_off(pd_domain_entry_t *entry)
+{
+    if (entry->stats.powered)
+    {
+        entry->ops->power_off();
+        entry->stats.powered = false;
+        entry->stats.off_count++;
+    }
+}
+
+/*******************************************************************************
+* Function Name: pd_manager_deepsleep_callback
+********************************************************************************
+* Summary:
+*  DeepSleep callback. Before the transition, powers down referenced domains
+*  that allow it. They stay off after wake-up until they are used again.
+*
+* Parameters:
+*  callbackParams - callback parameters (unused)
+*  mode           - callback mode
+*
+* Return:
+*  cy_en_syspm_status_t - CY_SYSPM_SUCCESS
+*
+*******************************************************************************/
+static cy_en_syspm_status_t pd_manager_deepsleep_callback(
+                                cy_stc_syspm_callback_params_t *callbackParams,
+                                cy_en_syspm_callback_mode_t mode)
+{
+    uint32_t i;
+
+    CY_UNUSED_PARAMETER(callbackParams);
+
+    if (CY_SYSPM_BEFORE_TRANSITION == mode)
+    {
+        for (i = 0U; i < PD_MANAGER_MAX_DOMAINS; i++)
+        {
+            pd_domain_entry_t *entry = &pd_domains[i];
+
+            if ((NULL != entry->ops) && entry->ops->drop_in_deepsleep &&
+                entry->stats.powered)
+            {
+                pd_manager_power_off(entry);
+                entry->dropped = true;
+                entry->stats.deepsleep_drops++;
+            }
+        }
+    }
+
+    return CY_SYSPM_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: pd_manager_init
+********************************************************************************
+* Summary:
+*  Registers the built-in domains and the DeepSleep callback.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void pd_manager_init(void)
+{
+    (void)pd_manager_register(PD_DOMAIN_PD1, &pd1_ops);
+
+    Cy_SysPm_RegisterCallback(&pd_ds_cback);
+}
+
+/*******************************************************************************
+* Function Name: pd_manager_register
+********************************************************************************
+* Summary:
+*  Registers the operations of a power domain.
+*
+* Parameters:
+*  domain - domain id
+*  ops    - domain operations, must stay valid
+*
+* Return:
+*  cy_rslt_t - CY_RSLT_SUCCESS or PD_MANAGER_RSLT_ERR_BAD_DOMAIN
+*
+*******************************************************************************/
+cy_rslt_t pd_manager_register(pd_domain_t domain, const pd_domain_ops_t *ops)
+{
+    pd_domain_entry_t *entry;
+
+    if (((uint32_t)domain >= PD_MANAGER_MAX_DOMAINS) || (NULL == ops) ||
+        (NULL == ops->power_on) || (NULL == ops->power_off))
+    {
+        return PD_MANAGER_RSLT_ERR_BAD_DOMAIN;
+    }
+
+    entry = &pd_domains[domain];
+    entry->ops = ops;
+    entry->stats.ref_count = 0U;
+    entry->stats.powered = ops->on_at_boot;
+    entry->dropped = false;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: pd_manager_acquire
+********************************************************************************
+* Summary:
+*  Takes a reference on a domain and powers it on if it is off.
+*
+* Parameters:
+*  domain - domain id
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void pd_manager_acquire(pd_domain_t domain)
+{
+    pd_domain_entry_t *entry = pd_manager_get_entry(domain);
+    uint32_t intr_state;
+
+    CY_ASSERT(NULL != entry);
+
+    intr_state = Cy_SysLib_EnterCriticalSection();
+    entry->stats.ref_count++;
+    pd_manager_power_on(entry);
+    Cy_SysLib_ExitCriticalSection(intr_state);
+}
+
+/*******************************************************************************
+* Function Name: pd_manager_release
+********************************************************************************
+* Summary:
+*  Drops a reference on a domain and powers it off when no reference is left.
+*
+* Parameters:
+*  domain - domain id
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void pd_manager_release(pd_domain_t domain)
+{
+    pd_domain_entry_t *entry = pd_manager_get_entry(domain);
+    uint32_t intr_state;
+
+    CY_ASSERT(NULL != entry);
+
+    intr_state = Cy_SysLib_EnterCriticalSection();
+    CY_ASSERT(0U != entry->stats.ref_count);
+    if (0U != entry->stats.ref_count)
+    {
+        entry->stats.ref_count--;
+        if (0U == entry->stats.ref_count)
+        {
+            pd_manager_power_off(entry);
+            entry->dropped = false;
+        }
+    }
+    Cy_SysLib_ExitCriticalSection(intr_state);
+}
+
+/*******************************************************************************
+* Function Name: pd_manager_use
+********************************************************************************
+* Summary:
+*  Restores a referenced domain that was dropped before DeepSleep.
+*
+* Parameters:
+*  domain - domain id
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void pd_manager_use(pd_domain_t domain)
+{
+    pd_domain_entry_t *entry = pd_manager_get_entry(domain);
+    uint32_t intr_state;
+
+    CY_ASSERT(NULL != entry);
+
+    /* Fast path: nothing to do unless the domain was dropped */
+    if (!entry->dropped)
+    {
+        return;
+    }
+
+    intr_state = Cy_SysLib_EnterCriticalSection();
+    if (0U != entry->stats.ref_count)
+    {
+        pd_manager_power_on(entry);
+    }
+    Cy_SysLib_ExitCriticalSection(intr_state);
+}
+
+/*******************************************************************************
+* Function Name: pd_manager_release_unused
+********************************************************************************
+* Summary:
+*  Powers off all domains that are on without a reference, such as domains
+*  powered by the boot code that the application does not use.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void pd_manager_release_unused(void)
+{
+    uint32_t intr_state;
+    uint32_t i;
+
+    intr_state = Cy_SysLib_EnterCriticalSection();
+    for (i = 0U; i < PD_MANAGER_MAX_DOMAINS; i++)
+    {
+        if ((NULL != pd_domains[i].ops) && (0U == pd_domains[i].stats.ref_count))
+        {
+            pd_manager_power_off(&pd_domains[i]);
+        }
+    }
+    Cy_SysLib_ExitCriticalSection(intr_state);
+}
+
+/*******************************************************************************
+* Function Name: pd_manager_get_stats
+********************************************************************************
+* Summary:
+*  Copies the statistics of a domain.
+*
+* Parameters:
+*  domain - domain id
+*  stats  - destination of the statistics
+*
+* Return:
+*  cy_rslt_t - CY_RSLT_SUCCESS or PD_MANAGER_RSLT_ERR_BAD_DOMAIN
+*
+*******************************************************************************/
+cy_rslt_t pd_manager_get_stats(pd_domain_t domain, pd_domain_stats_t *stats)
+{
+    pd_domain_entry_t *entry = pd_manager_get_entry(domain);
+    uint32_t intr_state;
+
+    if (NULL == entry)
+    {
+        return PD_MANAGER_RSLT_ERR_BAD_DOMAIN;
+    }
+
+    intr_state = Cy_SysLib_EnterCriticalSection();
+    *stats = entry->stats;
+    Cy_SysLib_ExitCriticalSection(intr_state);
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: pd_manager_get_name
+********************************************************************************
+* Summary:
+*  Returns the name of a domain.
+*
+* Parameters:
+*  domain - domain id
+*
+* Return:
+*  const char* - domain name, or NULL if the domain is not registered
+*
+*******************************************************************************/
+const char *pd_manager_get_name(pd_domain_t domain)
+{
+    pd_domain_entry_t *entry = pd_manager_get_entry(domain);
+
+    return (NULL != entry) ? entry->ops->name : NULL;
+}
+
+/* [] END OF FILE */
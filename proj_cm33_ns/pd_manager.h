@@ -0,0 +1,131 @@
+/*****************************************************************************
+* File Name        : pd_manager.h
+*
+* Description      : This file contains the interface of the reference
+*                    counted power domain manager
+*
+* Related Document : See README.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+#ifndef PD_MANAGER_H
+#define PD_MANAGER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "cy_result.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Maximum number of power domains, built-in and registered */
+#define PD_MANAGER_MAX_DOMAINS          (8U)
+
+/* Domain id is out of range or has no operations registered */
+#define PD_MANAGER_RSLT_ERR_BAD_DOMAIN  \
+    (CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_MIDDLEWARE_BASE, 0x10U))
+
+/*******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+/* Power domain ids. Ids from PD_DOMAIN_FIRST_USER on are free for drivers
+ * to register their own domains, e.g. peripheral group clock gates. */
+typedef enum
+{
+    PD_DOMAIN_PD1        = 0U,  /* CM55 core, SOCMEM and their peripherals */
+    PD_DOMAIN_SRAM_SPARE = 1U,  /* SRAM macros without live data, registered
+                                 * by sram_retention.c */
+    PD_DOMAIN_FIRST_USER = 2U
+} pd_domain_t;
+
+/* Power domain operations */
+typedef struct
+{
+    /* Name used in statistics output */
+    const char *name;
+
+    /* Powers the domain on and off. Called with interrupts masked, must not
+     * block. */
+    void (*power_on)(void);
+    void (*power_off)(void);
+
+    /* Power the domain down before DeepSleep even if it is referenced. It is
+     * restored on the first pd_manager_acquire() or pd_manager_use() after
+     * wake-up. Set to false for domains that must keep their state. */
+    bool drop_in_deepsleep;
+
+    /* Powered by the boot code */
+    bool on_at_boot;
+} pd_domain_ops_t;
+
+/* Power domain statistics */
+typedef struct
+{
+    uint32_t ref_count;
+    bool powered;
+    uint32_t on_count;
+    uint32_t off_count;
+    uint32_t deepsleep_drops;
+    uint32_t lazy_restores;
+} pd_domain_stats_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+/* Initializes the manager, registers the built-in domains and the DeepSleep
+ * callback. Domains keep their boot state until pd_manager_release_unused(). */
+void pd_manager_init(void);
+
+/* Registers a power domain */
+cy_rslt_t pd_manager_register(pd_domain_t domain, const pd_domain_ops_t *ops);
+
+/* Takes a reference on a domain and powers it on if needed */
+void pd_manager_acquire(pd_domain_t domain);
+
+/* Drops a reference on a domain and powers it off at zero */
+void pd_manager_release(pd_domain_t domain);
+
+/* Restores a referenced domain that was dropped for DeepSleep. Holders call
+ * it before they access the domain after a possible DeepSleep. */
+void pd_manager_use(pd_domain_t domain);
+
+/* Powers off every domain that has no reference. Called once at the end of
+ * the start-up, after all users took their references. */
+void pd_manager_release_unused(void);
+
+/* Copies the statistics of a domain */
+cy_rslt_t pd_manager_get_stats(pd_domain_t domain, pd_domain_stats_t *stats);
+
+/* Returns the name of a domain, or NULL if it is not registered */
+const char *pd_manager_get_name(pd_domain_t domain);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PD_MANAGER_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,289 @@
+/*****************************************************************************
+* File Name        : perf_counter.c
+*
+* Description      : This source file implements the DWT based cycle counter
+*                    used to measure latencies in the CM33 non-secure
+*                    application
+*
+* Related Document : See README.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+
+#include <string.h>
+
+#include "cy_pdl.h"
+#include "perf_counter.h"
+#include "wake_path.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+#define CYCLES_PER_USEC_MIN (1U)
+
+/*******************************************************************************
+* Function Name: perf_counter_init
+********************************************************************************
+* Summary:
+*  Enables the trace block and starts the DWT cycle counter.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void perf_counter_init(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0U;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+/*******************************************************************************
+* Function Name: perf_counter_get
+********************************************************************************
+* Summary:
+*  Returns the current cycle count.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t - cycle count
+*
+*******************************************************************************/
+WAKE_PATH_FUNC_BEGIN
+uint32_t perf_counter_get(void)
+{
+    return DWT->CYCCNT;
+}
+WAKE_PATH_FUNC_END
+
+/*******************************************************************************
+* Function Name: perf_counter_cycles_to_us
+********************************************************************************
+* Summary:
+*  Converts CPU cycles into microseconds using the current core clock.
+*
+* Parameters:
+*  cycles - number of CPU cycles
+*
+* Return:
+*  uint32_t - duration in microseconds
+*
+*******************************************************************************/
+WAKE_PATH_FUNC_BEGIN
+uint32_t perf_counter_cycles_to_us(uint32_t cycles)
+{
+    uint32_t cycles_per_usec = SystemCoreClock / 1000000U;
+
+    if (cycles_per_usec < CYCLES_PER_USEC_MIN)
+    {
+        cycles_per_usec = CYCLES_PER_USEC_MIN;
+    }
+
+    return cycles / cycles_per_usec;
+}
+WAKE_PATH_FUNC_END
+
+/*******************************************************************************
+* Function Name: perf_stat_add
+********************************************************************************
+* Summary:
+*  Adds one latency sample to the statistics.
+*
+* Parameters:
+*  stat   - statistics to update
+*  cycles - measured latency in CPU cycles
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void perf_stat_add(perf_stat_t *stat, uint32_t cycles)
+{
+    if ((0U == stat->count) || (cycles < stat->min))
+    {
+        stat->min = cycles;
+    }
+    if (cycles > stat->max)
+    {
+        stat->max = cycles;
+    }
+    stat->last = cycles;
+    stat->total += cycles;
+    stat->count++;
+}
+
+/*******************************************************************************
+* Function Name: perf_stat_reset
+********************************************************************************
+* Summary:
+*  Clears the statistics.
+*
+* Parameters:
+*  stat - statistics to clear
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void perf_stat_reset(perf_stat_t *stat)
+{
+    stat->count = 0U;
+    stat->min = 0U;
+    stat->max = 0U;
+    stat->last = 0U;
+    stat->total = 0U;
+}
+
+/*******************************************************************************
+* Function Name: perf_hist_bucket
+********************************************************************************
+* Summary:
+*  Returns the histogram bucket of a value. Values below
+*  PERF_HIST_SUB_BUCKETS have a bucket each, above that every power of two
+*  is split into PERF_HIST_SUB_BUCKETS linear buckets.
+*
+* Parameters:
+*  value - sample
+*
+* Return:
+*  uint32_t - bucket index
+*
+*******************************************************************************/
+static uint32_t perf_hist_bucket(uint32_t value)
+{
+    uint32_t shift;
+
+    if (value < PERF_HIST_SUB_BUCKETS)
+    {
+        return value;
+    }
+
+    shift = (31U - __CLZ(value)) - PERF_HIST_SUB_BUCKET_BITS;
+    return ((shift + 1U) << PERF_HIST_SUB_BUCKET_BITS) +
+           ((value >> shift) & (PERF_HIST_SUB_BUCKETS - 1U));
+}
+
+/*******************************************************************************
+* Function Name: perf_hist_bucket_upper
+********************************************************************************
+* Summary:
+*  Returns the largest value that falls into a histogram bucket.
+*
+* Parameters:
+*  bucket - bucket index
+*
+* Return:
+*  uint32_t - value
+*
+*******************************************************************************/
+static uint32_t perf_hist_bucket_upper(uint32_t bucket)
+{
+    uint32_t shift;
+    uint32_t sub;
+
+    if (bucket < PERF_HIST_SUB_BUCKETS)
+    {
+        return bucket;
+    }
+
+    shift = (bucket >> PERF_HIST_SUB_BUCKET_BITS) - 1U;
+    sub = bucket & (PERF_HIST_SUB_BUCKETS - 1U);
+    return ((PERF_HIST_SUB_BUCKETS + sub) << shift) + ((1UL << shift) - 1U);
+}
+
+/*******************************************************************************
+* Function Name: perf_hist_add
+********************************************************************************
+* Summary:
+*  Adds one sample to the histogram.
+*
+* Parameters:
+*  hist  - histogram to update
+*  value - sample
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void perf_hist_add(perf_hist_t *hist, uint32_t value)
+{
+    hist->buckets[perf_hist_bucket(value)]++;
+    hist->count++;
+}
+
+/*******************************************************************************
+* Function Name: perf_hist_reset
+********************************************************************************
+* Summary:
+*  Clears the histogram.
+*
+* Parameters:
+*  hist - histogram to clear
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void perf_hist_reset(perf_hist_t *hist)
+{
+    memset(hist, 0, sizeof(*hist));
+}
+
+/*******************************************************************************
+* Function Name: perf_hist_percentile
+********************************************************************************
+* Summary:
+*  Returns the value below which the given share of the samples lies.
+*
+* Parameters:
+*  hist      - histogram
+*  per_mille - share of the samples, 0 to 1000
+*
+* Return:
+*  uint32_t - upper bound of the bucket, 0 if there are no samples
+*
+*******************************************************************************/
+uint32_t perf_hist_percentile(const perf_hist_t *hist, uint32_t per_mille)
+{
+    uint64_t rank = ((uint64_t)hist->count * per_mille + 999U) / 1000U;
+    uint64_t seen = 0U;
+    uint32_t bucket;
+
+    for (bucket = 0U; (0U != rank) && (bucket < PERF_HIST_BUCKETS); bucket++)
+    {
+        seen += hist->buckets[bucket];
+        if (seen >= rank)
+        {
+            return perf_hist_bucket_upper(bucket);
+        }
+    }
+
+    return 0U;
+}
+
+/* [] END OF FILE */
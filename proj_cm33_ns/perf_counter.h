@@ -0,0 +1,106 @@
+/*****************************************************************************
+* File Name        : perf_counter.h
+*
+* Description      : This file contains the interface of the cycle counter
+*                    used to measure latencies in the CM33 non-secure
+*                    application
+*
+* Related Document : See README.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+#ifndef PERF_COUNTER_H
+#define PERF_COUNTER_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Log-linear histogram: 8 linear sub-buckets per power of two, which keeps the
+ * percentile error below 12.5 %. Covers the whole uint32_t range. */
+#define PERF_HIST_SUB_BUCKET_BITS   (3U)
+#define PERF_HIST_SUB_BUCKETS       (1UL << PERF_HIST_SUB_BUCKET_BITS)
+#define PERF_HIST_BUCKETS           \
+    ((32U - PERF_HIST_SUB_BUCKET_BITS + 1U) * PERF_HIST_SUB_BUCKETS)
+
+/*******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+/* Min/max/total statistics of a measured latency, in CPU cycles */
+typedef struct
+{
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint32_t last;
+    uint64_t total;
+} perf_stat_t;
+
+/* Distribution of a measured value, see PERF_HIST_SUB_BUCKET_BITS */
+typedef struct
+{
+    uint32_t count;
+    uint32_t buckets[PERF_HIST_BUCKETS];
+} perf_hist_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+/* Enables the DWT cycle counter. Call once before any measurement. */
+void perf_counter_init(void);
+
+/* Returns the current value of the free running cycle counter. The counter
+ * does not run in DeepSleep, so intervals must not span a DeepSleep entry. */
+uint32_t perf_counter_get(void);
+
+/* Converts a number of CPU cycles into microseconds at SystemCoreClock */
+uint32_t perf_counter_cycles_to_us(uint32_t cycles);
+
+/* Adds one sample to the statistics */
+void perf_stat_add(perf_stat_t *stat, uint32_t cycles);
+
+/* Clears the statistics */
+void perf_stat_reset(perf_stat_t *stat);
+
+/* Adds one sample to the histogram */
+void perf_hist_add(perf_hist_t *hist, uint32_t value);
+
+/* Clears the histogram */
+void perf_hist_reset(perf_hist_t *hist);
+
+/* Returns the value below which the given share of the samples lies, in per
+ * mille (500 = median, 990 = p99). The result is the upper bound of the
+ * histogram bucket, 0 if there are no samples. */
+uint32_t perf_hist_percentile(const perf_hist_t *hist, uint32_t per_mille);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PERF_COUNTER_H */
+
+/* [] END OF FILE */
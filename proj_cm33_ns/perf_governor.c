@@ -0,0 +1,540 @@
+/*****************************************************************************
+* File Name        : perf_governor.c
+*
+* Description      : This source file implements the runtime system
+*                    performance mode governor. It switches the system power
+*                    mode (HP/LP/ULP) and the core clock according to the
+*                    performance policy.
+*
+* Related Document : See README.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+
+#include "cybsp.h"
+#include "cy_pdl.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+#include "timers.h"
+
+#include "perf_governor.h"
+#include "deferred_work.h"
+#include "energy_monitor.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* CLK_HF instance feeding the CM33 core */
+#define PERF_GOVERNOR_CLKHF             (0U)
+
+/* CLK_HF dividers applied in each mode. The HP divider is the one of
+ * hfclk[0] in design.modus; LP and ULP must keep CLK_HF within the limits
+ * the datasheet gives for the mode. */
+#define PERF_GOVERNOR_DIV_HP            (CY_SYSCLK_CLKHF_DIVIDE_BY_2)
+#define PERF_GOVERNOR_DIV_LP            (CY_SYSCLK_CLKHF_DIVIDE_BY_4)
+#define PERF_GOVERNOR_DIV_ULP           (CY_SYSCLK_CLKHF_DIVIDE_BY_8)
+
+/* Callbacks run after the other application callbacks on the way down and
+ * before them on the way up, so that drivers see the final clock. Every
+ * callback of the application has an order of its own. */
+#define PERF_GOVERNOR_HP_ORDER          (240U)
+#define PERF_GOVERNOR_LP_ORDER          (241U)
+#define PERF_GOVERNOR_ULP_ORDER         (242U)
+
+/* Shortest time before a failed transition is tried again, so that a
+ * callback that keeps rejecting it does not load the CPU */
+#define PERF_GOVERNOR_RETRY_MS          (100U)
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+static cy_en_syspm_status_t perf_governor_callback(
+                                cy_stc_syspm_callback_params_t *callbackParams,
+                                cy_en_syspm_callback_mode_t mode);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+static perf_policy_t perf_policy;
+static perf_governor_stats_t perf_stats;
+static SemaphoreHandle_t perf_mutex;
+static TimerHandle_t perf_downshift_timer;
+static TickType_t perf_mode_entry_tick;
+
+/* Mode that the running transition moves to */
+static perf_mode_t perf_transition_to;
+
+static cy_stc_syspm_callback_params_t perf_cback_params =
+{
+    .base = NULL,
+    .context = NULL
+};
+
+static cy_stc_syspm_callback_t perf_hp_cback =
+{
+    .callback = perf_governor_callback,
+    .type = CY_SYSPM_HP,
+    .skipMode = ~(CY_SYSPM_BEFORE_TRANSITION | CY_SYSPM_AFTER_TRANSITION),
+    .callbackParams = &perf_cback_params,
+    .prevItm = NULL,
+    .nextItm = NULL,
+    .order = PERF_GOVERNOR_HP_ORDER
+};
+
+static cy_stc_syspm_callback_t perf_lp_cback =
+{
+    .callback = perf_governor_callback,
+    .type = CY_SYSPM_LP,
+    .skipMode = ~(CY_SYSPM_BEFORE_TRANSITION | CY_SYSPM_AFTER_TRANSITION),
+    .callbackParams = &perf_cback_params,
+    .prevItm = NULL,
+    .nextItm = NULL,
+    .order = PERF_GOVERNOR_LP_ORDER
+};
+
+static cy_stc_syspm_callback_t perf_ulp_cback =
+{
+    .callback = perf_governor_callback,
+    .type = CY_SYSPM_ULP,
+    .skipMode = ~(CY_SYSPM_BEFORE_TRANSITION | CY_SYSPM_AFTER_TRANSITION),
+    .callbackParams = &perf_cback_params,
+    .prevItm = NULL,
+    .nextItm = NULL,
+    .order = PERF_GOVERNOR_ULP_ORDER
+};
+
+/*******************************************************************************
+* Function Name: perf_governor_set_clock
+********************************************************************************
+* Summary:
+*  Sets the core clock divider of a mode and reconfigures the peripherals that
+*  depend on the core clock. The SysTick reload value is recomputed so that
+*  the RTOS tick keeps its period. In design.modus, CLK_HF0 also clocks the
+*  PERI0 bus groups 0, 2 and 4 and the trace clock divider of group 7, which
+*  only run slower. The peripheral clock dividers of group 1, among them
+*  the debug UART and the TCPWM, are rooted at CLK_HF10, and the LPTimer
+*  used for tickless idle runs from CLK_LF; they are not affected.
+*
+* Parameters:
+*  mode - performance mode
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void perf_governor_set_clock(perf_mode_t mode)
+{
+    static const cy_en_clkhf_dividers_t dividers[PERF_MODE_COUNT] =
+    {
+        PERF_GOVERNOR_DIV_ULP,
+        PERF_GOVERNOR_DIV_LP,
+        PERF_GOVERNOR_DIV_HP
+    };
+
+    Cy_SysClk_ClkHfSetDivider(PERF_GOVERNOR_CLKHF, dividers[mode]);
+    SystemCoreClockUpdate();
+
+    SysTick->LOAD = (SystemCoreClock / configTICK_RATE_HZ) - 1UL;
+    SysTick->VAL = 0UL;
+}
+
+/*******************************************************************************
+* Function Name: perf_governor_callback
+********************************************************************************
+* Summary:
+*  SysPm callback of the HP, LP and ULP transitions. The clock is lowered
+*  before a transition to a lower mode, while the regulator still supports
+*  the higher frequency, and raised after a transition to a higher mode. It
+*  changes nothing in CHECK_READY, so it has nothing to undo in CHECK_FAIL.
+*
+* Parameters:
+*  callbackParams - callback parameters (unused)
+*  mode           - callback mode
+*
+* Return:
+*  cy_en_syspm_status_t - CY_SYSPM_SUCCESS
+*
+*******************************************************************************/
+static cy_en_syspm_status_t perf_governor_callback(
+                                cy_stc_syspm_callback_params_t *callbackParams,
+                                cy_en_syspm_callback_mode_t mode)
+{
+    CY_UNUSED_PARAMETER(callbackParams);
+
+    switch (mode)
+    {
+        case CY_SYSPM_BEFORE_TRANSITION:
+            if (perf_transition_to < perf_policy.mode)
+            {
+                perf_governor_set_clock(perf_transition_to);
+            }
+            break;
+        case CY_SYSPM_AFTER_TRANSITION:
+            if (perf_transition_to > perf_policy.mode)
+            {
+                perf_governor_set_clock(perf_transition_to);
+            }
+            break;
+        default:
+            break;
+    }
+
+    return CY_SYSPM_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: perf_governor_enter
+********************************************************************************
+* Summary:
+*  Moves the system one step towards a mode through the PDL SysPm API.
+*
+* Parameters:
+*  mode - destination mode, adjacent to the current mode
+*
+* Return:
+*  cy_en_syspm_status_t - PDL status
+*
+*******************************************************************************/
+static cy_en_syspm_status_t perf_governor_enter(perf_mode_t mode)
+{
+    cy_en_syspm_status_t status;
+
+    perf_transition_to = mode;
+
+    switch (mode)
+    {
+        case PERF_MODE_HP:
+            status = Cy_SysPm_SystemEnterHp();
+            break;
+        case PERF_MODE_LP:
+            status = Cy_SysPm_SystemEnterLp();
+            break;
+        default:
+            status = Cy_SysPm_SystemEnterUlp();
+            break;
+    }
+
+    return status;
+}
+
+/*******************************************************************************
+* Function Name: perf_governor_apply
+********************************************************************************
+* Summary:
+*  Moves the system to a mode one step at a time and records the transition
+*  latency and the residency of the mode that is left. Must be called with
+*  the governor mutex held.
+*
+* Parameters:
+*  target - destination mode
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void perf_governor_apply(perf_mode_t target)
+{
+    perf_mode_t current = perf_policy.mode;
+    TickType_t now;
+    uint32_t start;
+
+    while (current != target)
+    {
+        perf_mode_t next = (target > current) ? (perf_mode_t)(current + 1U) :
+                                                (perf_mode_t)(current - 1U);
+
+        start = perf_counter_get();
+        if (CY_SYSPM_SUCCESS != perf_governor_enter(next))
+        {
+            /* A failed step down may have lowered the clock already; the
+             * system stays in the current mode */
+            if (next < current)
+            {
+                perf_governor_set_clock(current);
+            }
+            perf_stats.failed_transitions++;
+            break;
+        }
+        perf_stat_add(&perf_stats.transition[next], perf_counter_get() - start);
+
+        now = xTaskGetTickCount();
+        perf_stats.residency_ticks[current] += (uint32_t)(now - perf_mode_entry_tick);
+        perf_mode_entry_tick = now;
+
+        current = next;
+        perf_policy.mode = current;
+        energy_monitor_set_perf_mode(current);
+    }
+}
+
+/*******************************************************************************
+* Function Name: perf_governor_evaluate
+********************************************************************************
+* Summary:
+*  Evaluates the policy and applies the resulting mode. A pending downshift
+*  is re-evaluated by the downshift timer once the hold time has passed. A
+*  transition that failed is retried the same way.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void perf_governor_evaluate(void)
+{
+    uint32_t now_ms;
+    uint32_t wait_ms;
+    perf_mode_t current;
+    perf_mode_t target;
+
+    xSemaphoreTake(perf_mutex, portMAX_DELAY);
+
+    now_ms = xTaskGetTickCount() * portTICK_PERIOD_MS;
+    wait_ms = perf_policy.config.downshift_hold_ms;
+
+    /* perf_policy_update() makes the result the current mode; the governor
+     * commits it only once the hardware transition succeeded */
+    current = perf_policy.mode;
+    target = perf_policy_update(&perf_policy, now_ms);
+    perf_policy.mode = current;
+
+    perf_governor_apply(target);
+
+    /* perf_policy_update() has cleared the pending downshift. If the
+     * transition failed, it is held again, so that the timer retries it; a
+     * failed upshift is retried by the same evaluation. */
+    if (perf_policy.mode != target)
+    {
+        perf_policy.downshift_pending = true;
+        perf_policy.downshift_since_ms = now_ms;
+        if (wait_ms < PERF_GOVERNOR_RETRY_MS)
+        {
+            wait_ms = PERF_GOVERNOR_RETRY_MS;
+        }
+    }
+
+    if (perf_policy.downshift_pending)
+    {
+        xTimerChangePeriod(perf_downshift_timer, pdMS_TO_TICKS(wait_ms) + 1U, 0U);
+    }
+
+    xSemaphoreGive(perf_mutex);
+}
+
+/*******************************************************************************
+* Function Name: perf_governor_deferred_evaluate
+********************************************************************************
+* Summary:
+*  Deferred work job of the downshift timer. Evaluates the policy.
+*
+* Parameters:
+*  arg - unused
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void perf_governor_deferred_evaluate(void *arg)
+{
+    CY_UNUSED_PARAMETER(arg);
+
+    perf_governor_evaluate();
+}
+
+/*******************************************************************************
+* Function Name: perf_governor_timer_callback
+********************************************************************************
+* Summary:
+*  Downshift timer callback. It runs in the timer service task, which must
+*  not wait for the governor mutex or run a SysPm transition, so the
+*  evaluation is queued as deferred work. If the queue is full, the timer is
+*  started again.
+*
+* Parameters:
+*  timer - timer handle
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void perf_governor_timer_callback(TimerHandle_t timer)
+{
+    if (!deferred_work_submit(perf_governor_deferred_evaluate, NULL, 0U))
+    {
+        xTimerChangePeriod(timer, pdMS_TO_TICKS(PERF_GOVERNOR_RETRY_MS), 0U);
+    }
+}
+
+/*******************************************************************************
+* Function Name: perf_governor_init
+********************************************************************************
+* Summary:
+*  Initializes the policy, creates the governor mutex and downshift timer
+*  and registers the SysPm callbacks.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void perf_governor_init(void)
+{
+    perf_policy_config_t config;
+
+    perf_policy_get_default_config(&config);
+    perf_policy_init(&perf_policy, &config);
+    perf_transition_to = perf_policy.mode;
+    perf_mode_entry_tick = xTaskGetTickCount();
+
+    perf_mutex = xSemaphoreCreateMutex();
+    perf_downshift_timer = xTimerCreate("PerfGov",
+                                        pdMS_TO_TICKS(config.downshift_hold_ms),
+                                        pdFALSE, NULL,
+                                        perf_governor_timer_callback);
+    configASSERT(NULL != perf_mutex);
+    configASSERT(NULL != perf_downshift_timer);
+
+    Cy_SysPm_RegisterCallback(&perf_hp_cback);
+    Cy_SysPm_RegisterCallback(&perf_lp_cback);
+    Cy_SysPm_RegisterCallback(&perf_ulp_cback);
+}
+
+/*******************************************************************************
+* Function Name: perf_governor_add_client
+********************************************************************************
+* Summary:
+*  Adds a demand client.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  int32_t - client id, or -1 if no client is free
+*
+*******************************************************************************/
+int32_t perf_governor_add_client(void)
+{
+    int32_t client;
+
+    xSemaphoreTake(perf_mutex, portMAX_DELAY);
+    client = perf_policy_add_client(&perf_policy);
+    xSemaphoreGive(perf_mutex);
+
+    return client;
+}
+
+/*******************************************************************************
+* Function Name: perf_governor_set_demand
+********************************************************************************
+* Summary:
+*  Declares the minimum mode a client needs and re-evaluates the policy.
+*
+* Parameters:
+*  client - client id returned by perf_governor_add_client()
+*  mode   - minimum mode the client needs
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void perf_governor_set_demand(int32_t client, perf_mode_t mode)
+{
+    xSemaphoreTake(perf_mutex, portMAX_DELAY);
+    perf_policy_set_demand(&perf_policy, client, mode);
+    xSemaphoreGive(perf_mutex);
+
+    perf_governor_evaluate();
+}
+
+/*******************************************************************************
+* Function Name: perf_governor_set_app_state
+********************************************************************************
+* Summary:
+*  Informs the governor about an application state change and re-evaluates
+*  the policy.
+*
+* Parameters:
+*  state - new application state
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void perf_governor_set_app_state(en_app_state_t state)
+{
+    xSemaphoreTake(perf_mutex, portMAX_DELAY);
+    perf_policy_set_app_state(&perf_policy, state);
+    xSemaphoreGive(perf_mutex);
+
+    perf_governor_evaluate();
+}
+
+/*******************************************************************************
+* Function Name: perf_governor_get_mode
+********************************************************************************
+* Summary:
+*  Returns the current performance mode.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  perf_mode_t - current mode
+*
+*******************************************************************************/
+perf_mode_t perf_governor_get_mode(void)
+{
+    return perf_policy.mode;
+}
+
+/*******************************************************************************
+* Function Name: perf_governor_get_stats
+********************************************************************************
+* Summary:
+*  Copies the governor statistics.
+*
+* Parameters:
+*  stats - destination of the statistics
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void perf_governor_get_stats(perf_governor_stats_t *stats)
+{
+    xSemaphoreTake(perf_mutex, portMAX_DELAY);
+    *stats = perf_stats;
+    stats->residency_ticks[perf_policy.mode] +=
+        (uint32_t)(xTaskGetTickCount() - perf_mode_entry_tick);
+    xSemaphoreGive(perf_mutex);
+}
+
+/* [] END OF FILE */
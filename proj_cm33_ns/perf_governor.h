@@ -0,0 +1,89 @@
+/*****************************************************************************
+* File Name        : perf_governor.h
+*
+* Description      : This file contains the interface of the runtime system
+*                    performance mode governor (HP/LP/ULP)
+*
+* Related Document : See README.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+#ifndef PERF_GOVERNOR_H
+#define PERF_GOVERNOR_H
+
+#include <stdint.h>
+
+#include "app_state.h"
+#include "perf_counter.h"
+#include "perf_policy.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+/* Governor statistics */
+typedef struct
+{
+    /* Transition latency into each mode, in CPU cycles. The core clock
+     * changes during a transition; cycles are counted at the clock that
+     * is in effect while the CPU runs the transition code. */
+    perf_stat_t transition[PERF_MODE_COUNT];
+
+    /* Time spent in each mode, in RTOS ticks */
+    uint32_t residency_ticks[PERF_MODE_COUNT];
+
+    /* Number of transitions rejected by a SysPm callback */
+    uint32_t failed_transitions;
+} perf_governor_stats_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+/* Initializes the governor and registers its SysPm callbacks. The system
+ * stays in the boot mode (HP) until the first evaluation. */
+void perf_governor_init(void);
+
+/* Adds a demand client. Returns the client id, or -1 when all are in use. */
+int32_t perf_governor_add_client(void);
+
+/* Declares the minimum mode a client needs, e.g. PERF_MODE_HP for a burst.
+ * Declaring PERF_MODE_ULP withdraws the demand. */
+void perf_governor_set_demand(int32_t client, perf_mode_t mode);
+
+/* Informs the governor about an application state change */
+void perf_governor_set_app_state(en_app_state_t state);
+
+/* Returns the current performance mode */
+perf_mode_t perf_governor_get_mode(void);
+
+/* Copies the governor statistics */
+void perf_governor_get_stats(perf_governor_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PERF_GOVERNOR_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,266 @@
+/*****************************************************************************
+* File Name        : perf_policy.c
+*
+* Description      : This source file implements the performance mode policy
+*                    that maps the application state and the declared task
+*                    demand to a system power mode
+*
+* Related Document : See README.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+
+#include <stddef.h>
+#include "perf_policy.h"
+
+/*******************************************************************************
+* Function Name: perf_policy_get_default_config
+********************************************************************************
+* Summary:
+*  Fills the default policy configuration.
+*
+* Parameters:
+*  config - configuration to fill
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void perf_policy_get_default_config(perf_policy_config_t *config)
+{
+    config->active_floor = PERF_MODE_LP;
+    config->idle_floor = PERF_MODE_ULP;
+    config->downshift_hold_ms = PERF_POLICY_DOWNSHIFT_HOLD_MS;
+}
+
+/*******************************************************************************
+* Function Name: perf_policy_init
+********************************************************************************
+* Summary:
+*  Initializes the policy state.
+*
+* Parameters:
+*  policy - policy state
+*  config - policy configuration
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void perf_policy_init(perf_policy_t *policy, const perf_policy_config_t *config)
+{
+    uint32_t i;
+
+    policy->config = *config;
+    policy->app_state = APP_STATE_ACTIVE;
+    for (i = 0U; i < PERF_POLICY_MAX_CLIENTS; i++)
+    {
+        policy->demand[i] = PERF_MODE_ULP;
+    }
+    policy->client_count = 0U;
+    policy->mode = PERF_MODE_HP;
+    policy->app_state_changed = false;
+    policy->downshift_pending = false;
+    policy->downshift_since_ms = 0U;
+}
+
+/*******************************************************************************
+* Function Name: perf_policy_add_client
+********************************************************************************
+* Summary:
+*  Allocates a demand client.
+*
+* Parameters:
+*  policy - policy state
+*
+* Return:
+*  int32_t - client id, or -1 if no client is free
+*
+*******************************************************************************/
+int32_t perf_policy_add_client(perf_policy_t *policy)
+{
+    if (policy->client_count >= PERF_POLICY_MAX_CLIENTS)
+    {
+        return -1;
+    }
+
+    return (int32_t)policy->client_count++;
+}
+
+/*******************************************************************************
+* Function Name: perf_policy_set_demand
+********************************************************************************
+* Summary:
+*  Sets the minimum mode a client needs.
+*
+* Parameters:
+*  policy - policy state
+*  client - client id returned by perf_policy_add_client()
+*  mode   - minimum mode the client needs
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void perf_policy_set_demand(perf_policy_t *policy, int32_t client, perf_mode_t mode)
+{
+    if ((client >= 0) && ((uint32_t)client < policy->client_count) &&
+        (mode < PERF_MODE_COUNT))
+    {
+        policy->demand[client] = mode;
+    }
+}
+
+/*******************************************************************************
+* Function Name: perf_policy_set_app_state
+********************************************************************************
+* Summary:
+*  Sets the current application state.
+*
+* Parameters:
+*  policy - policy state
+*  state  - application state
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void perf_policy_set_app_state(perf_policy_t *policy, en_app_state_t state)
+{
+    if (state != policy->app_state)
+    {
+        policy->app_state = state;
+        policy->app_state_changed = true;
+    }
+}
+
+/*******************************************************************************
+* Function Name: perf_policy_get_target
+********************************************************************************
+* Summary:
+*  Returns the highest of the application state floor and all client demands.
+*
+* Parameters:
+*  policy - policy state
+*
+* Return:
+*  perf_mode_t - target mode
+*
+*******************************************************************************/
+perf_mode_t perf_policy_get_target(const perf_policy_t *policy)
+{
+    perf_mode_t target;
+    uint32_t i;
+
+    target = (APP_STATE_ACTIVE == policy->app_state) ?
+             policy->config.active_floor : policy->config.idle_floor;
+
+    for (i = 0U; i < policy->client_count; i++)
+    {
+        if (policy->demand[i] > target)
+        {
+            target = policy->demand[i];
+        }
+    }
+
+    return target;
+}
+
+/*******************************************************************************
+* Function Name: perf_policy_update
+********************************************************************************
+* Summary:
+*  Evaluates the policy. Higher targets are applied at once so that bursts
+*  get their performance without delay. Lower targets are applied only after
+*  they have been requested for the downshift hold time, which keeps short
+*  gaps between bursts from causing back-to-back transitions. A lower target
+*  that follows an application state change is applied at once: the state
+*  change is a deliberate decision, and a hold timer running into IDLE would
+*  wake the system from DeepSleep just to step down.
+*
+* Parameters:
+*  policy - policy state
+*  now_ms - current time in milliseconds
+*
+* Return:
+*  perf_mode_t - mode the system should be in
+*
+*******************************************************************************/
+perf_mode_t perf_policy_update(perf_policy_t *policy, uint32_t now_ms)
+{
+    perf_mode_t target = perf_policy_get_target(policy);
+    bool state_changed = policy->app_state_changed;
+
+    policy->app_state_changed = false;
+
+    if ((target >= policy->mode) || state_changed)
+    {
+        policy->mode = target;
+        policy->downshift_pending = false;
+    }
+    else if (!policy->downshift_pending)
+    {
+        policy->downshift_pending = true;
+        policy->downshift_since_ms = now_ms;
+    }
+    else if ((uint32_t)(now_ms - policy->downshift_since_ms) >=
+             policy->config.downshift_hold_ms)
+    {
+        policy->mode = target;
+        policy->downshift_pending = false;
+    }
+    else
+    {
+        /* Hold the current mode */
+    }
+
+    /* A zero hold time steps down on the first evaluation */
+    if (policy->downshift_pending && (0U == policy->config.downshift_hold_ms))
+    {
+        policy->mode = target;
+        policy->downshift_pending = false;
+    }
+
+    return policy->mode;
+}
+
+/*******************************************************************************
+* Function Name: perf_policy_mode_name
+********************************************************************************
+* Summary:
+*  Returns the name of a mode.
+*
+* Parameters:
+*  mode - performance mode
+*
+* Return:
+*  const char* - mode name
+*
+*******************************************************************************/
+const char *perf_policy_mode_name(perf_mode_t mode)
+{
+    static const char *const names[PERF_MODE_COUNT] = { "ULP", "LP", "HP" };
+
+    return (mode < PERF_MODE_COUNT) ? names[mode] : "?";
+}
+
+/* [] END OF FILE */
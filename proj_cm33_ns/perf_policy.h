@@ -0,0 +1,125 @@
+/*****************************************************************************
+* File Name        : perf_policy.h
+*
+* Description      : This file contains the interface of the performance
+*                    mode policy. The policy has no hardware dependency so
+*                    that it can be exercised by the host simulation.
+*
+* Related Document : See README.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+#ifndef PERF_POLICY_H
+#define PERF_POLICY_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "app_state.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Maximum number of clients that can declare a demand */
+#define PERF_POLICY_MAX_CLIENTS         (8U)
+
+/* Default time the target must stay below the current mode before the
+ * policy steps down. Upshifts, and downshifts caused by an application
+ * state change, are applied at once. */
+#define PERF_POLICY_DOWNSHIFT_HOLD_MS   (100U)
+
+/*******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+/* System performance modes, ordered by increasing performance */
+typedef enum
+{
+    PERF_MODE_ULP = 0U,     /* System ULP, lowest core clock */
+    PERF_MODE_LP  = 1U,     /* System LP, reduced core clock */
+    PERF_MODE_HP  = 2U,     /* System HP, full core clock */
+    PERF_MODE_COUNT
+} perf_mode_t;
+
+/* Policy configuration */
+typedef struct
+{
+    /* Lowest mode allowed in each application state */
+    perf_mode_t active_floor;
+    perf_mode_t idle_floor;
+
+    /* Time the target must stay lower before stepping down */
+    uint32_t downshift_hold_ms;
+} perf_policy_config_t;
+
+/* Policy state */
+typedef struct
+{
+    perf_policy_config_t config;
+    en_app_state_t app_state;
+    perf_mode_t demand[PERF_POLICY_MAX_CLIENTS];
+    uint32_t client_count;
+    perf_mode_t mode;
+    bool app_state_changed;
+    bool downshift_pending;
+    uint32_t downshift_since_ms;
+} perf_policy_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+/* Fills the default configuration: ACTIVE runs at LP, IDLE at ULP */
+void perf_policy_get_default_config(perf_policy_config_t *config);
+
+/* Initializes the policy. The initial mode is HP, the boot configuration. */
+void perf_policy_init(perf_policy_t *policy, const perf_policy_config_t *config);
+
+/* Adds a demand client. Returns the client id, or -1 when all are in use. */
+int32_t perf_policy_add_client(perf_policy_t *policy);
+
+/* Sets the minimum mode a client needs. PERF_MODE_ULP withdraws the demand. */
+void perf_policy_set_demand(perf_policy_t *policy, int32_t client, perf_mode_t mode);
+
+/* Sets the current application state */
+void perf_policy_set_app_state(perf_policy_t *policy, en_app_state_t state);
+
+/* Returns the mode the state floor and client demands ask for, ignoring
+ * hysteresis */
+perf_mode_t perf_policy_get_target(const perf_policy_t *policy);
+
+/* Evaluates the policy at time now_ms and returns the mode the system
+ * should be in. The returned mode becomes the current mode. */
+perf_mode_t perf_policy_update(perf_policy_t *policy, uint32_t now_ms);
+
+/* Returns the name of a mode */
+const char *perf_policy_mode_name(perf_mode_t mode);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PERF_POLICY_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,283 @@
+/*****************************************************************************
+* File Name        : power_event.c
+*
+* Description      : This source file implements the power event bus. Events
+*                    are written to a ring of records that subscribers read
+*                    in place; a publisher notifies only the subscribers
+*                    whose filter matches.
+*
+* Related Document : See README.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+
+#include "cy_pdl.h"
+
+#include "perf_counter.h"
+#include "power_event.h"
+#include "wake_path.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+#define POWER_EVENT_RING_MASK           (POWER_EVENT_RING_SIZE - 1U)
+
+#if ((POWER_EVENT_RING_SIZE & POWER_EVENT_RING_MASK) != 0U)
+#error "POWER_EVENT_RING_SIZE must be a power of two"
+#endif
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+static power_event_t power_event_ring[POWER_EVENT_RING_SIZE];
+
+/* Publication number of the next record */
+static uint32_t power_event_head = 0U;
+
+/* Subscribers in priority order */
+static power_event_sub_t *power_event_subs = NULL;
+
+static power_event_stats_t power_event_stats;
+
+/*******************************************************************************
+* Function Name: power_event_match
+********************************************************************************
+* Summary:
+*  Checks a record against the filter of a subscriber.
+*
+* Parameters:
+*  sub   - subscriber
+*  event - record
+*
+* Return:
+*  bool - true if the subscriber takes the record
+*
+*******************************************************************************/
+WAKE_PATH_FUNC_BEGIN
+static bool power_event_match(const power_event_sub_t *sub,
+                              const power_event_t *event)
+{
+    if (0U == (sub->type_mask & POWER_EVENT_MASK(event->type)))
+    {
+        return false;
+    }
+
+    return (POWER_EVENT_WAKE != event->type) || (0U == sub->source_mask) ||
+           (0U != (sub->source_mask & event->sources));
+}
+WAKE_PATH_FUNC_END
+
+/*******************************************************************************
+* Function Name: power_event_subscribe
+********************************************************************************
+* Summary:
+*  Adds a subscriber behind those of a lower or the same priority.
+*
+* Parameters:
+*  sub - subscriber
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void power_event_subscribe(power_event_sub_t *sub)
+{
+    power_event_sub_t **link = &power_event_subs;
+    uint32_t irq = Cy_SysLib_EnterCriticalSection();
+
+    while ((NULL != *link) && ((*link)->priority <= sub->priority))
+    {
+        link = &(*link)->next;
+    }
+    sub->next_seq = power_event_head;
+    sub->lost = 0U;
+    sub->next = *link;
+    *link = sub;
+
+    Cy_SysLib_ExitCriticalSection(irq);
+}
+
+/*******************************************************************************
+* Function Name: power_event_unsubscribe
+********************************************************************************
+* Summary:
+*  Removes a subscriber.
+*
+* Parameters:
+*  sub - subscriber
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void power_event_unsubscribe(power_event_sub_t *sub)
+{
+    power_event_sub_t **link = &power_event_subs;
+    uint32_t irq = Cy_SysLib_EnterCriticalSection();
+
+    while ((NULL != *link) && (sub != *link))
+    {
+        link = &(*link)->next;
+    }
+    if (NULL != *link)
+    {
+        *link = sub->next;
+        sub->next = NULL;
+    }
+
+    Cy_SysLib_ExitCriticalSection(irq);
+}
+
+/*******************************************************************************
+* Function Name: power_event_publish
+********************************************************************************
+* Summary:
+*  Writes the record and serves the matching subscribers in priority order.
+*
+* Parameters:
+*  type    - event type
+*  sources - wake-up sources of a WAKE event, 0 otherwise
+*  arg     - event argument
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+WAKE_PATH_FUNC_BEGIN
+void power_event_publish(power_event_type_t type, uint32_t sources,
+                         uint32_t arg)
+{
+    power_event_t *event;
+    power_event_sub_t *sub;
+    uint32_t irq;
+
+    if ((uint32_t)type >= (uint32_t)POWER_EVENT_TYPE_COUNT)
+    {
+        return;
+    }
+
+    irq = Cy_SysLib_EnterCriticalSection();
+
+    event = &power_event_ring[power_event_head & POWER_EVENT_RING_MASK];
+    event->seq = power_event_head;
+    event->type = type;
+    event->cycles = perf_counter_get();
+    event->sources = sources;
+    event->arg = arg;
+    power_event_head++;
+    power_event_stats.published[type]++;
+
+    for (sub = power_event_subs; NULL != sub; sub = sub->next)
+    {
+        if (!power_event_match(sub, event))
+        {
+            power_event_stats.filtered++;
+            continue;
+        }
+        if (NULL != sub->callback)
+        {
+            sub->callback(event, sub->arg);
+        }
+        if (NULL != sub->task)
+        {
+            xTaskNotifyGive(sub->task);
+        }
+        power_event_stats.delivered++;
+    }
+
+    Cy_SysLib_ExitCriticalSection(irq);
+}
+WAKE_PATH_FUNC_END
+
+/*******************************************************************************
+* Function Name: power_event_take
+********************************************************************************
+* Summary:
+*  Copies the next matching record the subscriber has not taken. Records
+*  of other types or sources are skipped. The copy is made with interrupts
+*  masked, so a publication cannot overwrite the record while it is read.
+*
+* Parameters:
+*  sub   - subscriber
+*  event - destination
+*
+* Return:
+*  bool - false if there is no such record
+*
+*******************************************************************************/
+bool power_event_take(power_event_sub_t *sub, power_event_t *event)
+{
+    const power_event_t *next;
+    bool taken = false;
+    uint32_t missed;
+    uint32_t irq = Cy_SysLib_EnterCriticalSection();
+
+    missed = power_event_head - sub->next_seq;
+    if (missed > POWER_EVENT_RING_SIZE)
+    {
+        missed -= POWER_EVENT_RING_SIZE;
+        sub->lost += missed;
+        power_event_stats.lost += missed;
+        sub->next_seq += missed;
+    }
+
+    while (!taken && (sub->next_seq != power_event_head))
+    {
+        next = &power_event_ring[sub->next_seq & POWER_EVENT_RING_MASK];
+        sub->next_seq++;
+        if (power_event_match(sub, next))
+        {
+            *event = *next;
+            taken = true;
+        }
+    }
+
+    Cy_SysLib_ExitCriticalSection(irq);
+
+    return taken;
+}
+
+/*******************************************************************************
+* Function Name: power_event_get_stats
+********************************************************************************
+* Summary:
+*  Returns a copy of the statistics.
+*
+* Parameters:
+*  stats - destination
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void power_event_get_stats(power_event_stats_t *stats)
+{
+    uint32_t irq = Cy_SysLib_EnterCriticalSection();
+
+    *stats = power_event_stats;
+    Cy_SysLib_ExitCriticalSection(irq);
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,144 @@
+/*****************************************************************************
+* File Name        : power_event.h
+*
+* Description      : This file contains the interface of the power event bus.
+*                    The DeepSleep callbacks and the App State Manager publish
+*                    DeepSleep entries, wake-ups and application state changes;
+*                    NS tasks and drivers subscribe to the events they need.
+*
+* Related Document : See README.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+
+#ifndef POWER_EVENT_H
+#define POWER_EVENT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Event records kept for the subscribers, a power of two. A record stays
+ * valid until this many later events are published. */
+#define POWER_EVENT_RING_SIZE           (16U)
+
+/* Type mask of a subscriber */
+#define POWER_EVENT_MASK(type)          (1UL << (uint32_t)(type))
+
+/*******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+/* Event types */
+typedef enum
+{
+    POWER_EVENT_SLEEP_ENTRY = 0U,   /* DeepSleep entry, before the transition */
+    POWER_EVENT_WAKE        = 1U,   /* DeepSleep exit, or an entry aborted
+                                     * for a wake-up event */
+    POWER_EVENT_APP_STATE   = 2U,   /* application state change */
+    POWER_EVENT_TYPE_COUNT
+} power_event_type_t;
+
+/* Event record */
+typedef struct
+{
+    uint32_t seq;               /* publication number */
+    power_event_type_t type;
+    uint32_t cycles;            /* cycle counter at the publication */
+    uint32_t sources;           /* WAKE: WAKEUP_SOURCE_x bits, 0 if none */
+    uint32_t arg;               /* WAKE: wake-up event sequence number,
+                                 * APP_STATE: new en_app_state_t */
+} power_event_t;
+
+typedef struct power_event_sub power_event_sub_t;
+
+/* Subscriber callback. Runs in the context of the publisher, which may be a
+ * DeepSleep callback with interrupts masked; it must not block. */
+typedef void (*power_event_fn_t)(const power_event_t *event, void *arg);
+
+/* Subscriber, owned by the caller like a SysPm callback structure. Fill in
+ * the fields above the line before power_event_subscribe(). */
+struct power_event_sub
+{
+    uint32_t type_mask;         /* POWER_EVENT_MASK() of the types taken */
+    uint32_t source_mask;       /* wake-up sources of the WAKE events taken,
+                                 * 0 for all, including none */
+    uint32_t priority;          /* lower values are served first */
+    TaskHandle_t task;          /* given a task notification, or NULL */
+    power_event_fn_t callback;  /* called with the record, or NULL */
+    void *arg;                  /* argument of the callback */
+    /* ---------------------------------------------------------------- */
+    uint32_t next_seq;          /* next record for power_event_take() */
+    uint32_t lost;              /* records overwritten before taken */
+    power_event_sub_t *next;
+};
+
+/* Bus statistics */
+typedef struct
+{
+    uint32_t published[POWER_EVENT_TYPE_COUNT];
+    uint32_t delivered;         /* callbacks and notifications */
+    uint32_t filtered;          /* subscribers passed over */
+    uint32_t lost;              /* records overwritten before taken */
+} power_event_stats_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+/* Adds a subscriber in priority order; subscribers of the same priority are
+ * served in the order they subscribed. It takes events published from now
+ * on. Call from a task or before the scheduler starts. */
+void power_event_subscribe(power_event_sub_t *sub);
+
+/* Removes a subscriber */
+void power_event_unsubscribe(power_event_sub_t *sub);
+
+/* Publishes an event. Never blocks: the record overwrites the oldest one,
+ * then every matching subscriber gets its callback and its task
+ * notification in priority order. Call from a task or a SysPm callback, not
+ * from an interrupt handler. */
+void power_event_publish(power_event_type_t type, uint32_t sources,
+                         uint32_t arg);
+
+/* Copies the next matching record the subscriber has not taken to event.
+ * Returns false if there is none. Records overwritten before they were taken
+ * are counted as lost. */
+bool power_event_take(power_event_sub_t *sub, power_event_t *event);
+
+/* Returns a copy of the statistics */
+void power_event_get_stats(power_event_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* POWER_EVENT_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,348 @@
+/*****************************************************************************
+* File Name        : spe_profiler.c
+*
+* Description      : This source file implements the secure world residency
+*                    profiler. NS interrupts are masked while the CPU is in
+*                    the SPE, so every secure call and every secure interrupt
+*                    delays NS interrupts by its duration.
+*
+*                    Secure calls are timed around the call. Secure
+*                    interrupts cannot be seen from the NS side directly; they
+*                    show up as a tick period that is longer than nominal,
+*                    because the SysTick interrupt stays pending until the SPE
+*                    returns. Such a blackout outside a secure call is
+*                    counted as a secure interrupt.
+*
+* Related Document : See README.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+
+#include <string.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "cy_pdl.h"
+#include "perf_counter.h"
+#include "power_manager_api.h"
+#include "spe_profiler.h"
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+static spe_profiler_stats_t spe_stats[SPE_PROFILER_SERVICE_COUNT];
+static perf_hist_t spe_hist[SPE_PROFILER_SERVICE_COUNT];
+
+static const char *const spe_service_names[SPE_PROFILER_SERVICE_COUNT] =
+{
+    "POWER_MANAGER",
+    "Platform",
+    "Secure ISR"
+};
+
+/* Worst blackout over all causes */
+static uint32_t spe_worst_us = 0U;
+static spe_profiler_service_t spe_worst_service = SPE_PROFILER_POWER_MANAGER;
+
+/* Secure calls between enter and exit. A task can be preempted after
+ * spe_profiler_enter(), before it enters the SPE. */
+static volatile uint32_t spe_calls_active = 0U;
+
+/* Previous tick, 0 cycles if there is none to compare with */
+static uint32_t spe_tick_cycles = 0U;
+static TickType_t spe_tick_count = 0U;
+static uint32_t spe_tick_clock_hz = 0U;
+
+/*******************************************************************************
+* Function Name: spe_profiler_record
+********************************************************************************
+* Summary:
+*  Adds one residency sample. Must be called in a critical section.
+*
+* Parameters:
+*  service - cause of the residency
+*  us      - duration in microseconds
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void spe_profiler_record(spe_profiler_service_t service, uint32_t us)
+{
+    spe_profiler_stats_t *stats = &spe_stats[service];
+
+    perf_hist_add(&spe_hist[service], us);
+    stats->count++;
+    stats->total_us += us;
+    if (us > stats->max_us)
+    {
+        stats->max_us = us;
+    }
+    if (us > spe_worst_us)
+    {
+        spe_worst_us = us;
+        spe_worst_service = service;
+    }
+}
+
+/*******************************************************************************
+* Function Name: spe_profiler_call_enter
+********************************************************************************
+* Summary:
+*  POWER_MANAGER API hook called before a secure call.
+*
+*******************************************************************************/
+static uint32_t spe_profiler_call_enter(void)
+{
+    return spe_profiler_enter();
+}
+
+/*******************************************************************************
+* Function Name: spe_profiler_call_exit
+********************************************************************************
+* Summary:
+*  POWER_MANAGER API hook called after a secure call.
+*
+*******************************************************************************/
+static void spe_profiler_call_exit(uint32_t start)
+{
+    spe_profiler_exit(SPE_PROFILER_POWER_MANAGER, start);
+}
+
+/*******************************************************************************
+* Function Name: spe_profiler_init
+********************************************************************************
+* Summary:
+*  Clears the statistics and registers the hooks of the POWER_MANAGER API.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void spe_profiler_init(void)
+{
+    uint32_t intr_state = Cy_SysLib_EnterCriticalSection();
+
+    memset(spe_stats, 0, sizeof(spe_stats));
+    memset(spe_hist, 0, sizeof(spe_hist));
+    spe_worst_us = 0U;
+    spe_worst_service = SPE_PROFILER_POWER_MANAGER;
+    spe_tick_cycles = 0U;
+    Cy_SysLib_ExitCriticalSection(intr_state);
+
+    power_manager_set_call_hooks(spe_profiler_call_enter, spe_profiler_call_exit);
+}
+
+/*******************************************************************************
+* Function Name: spe_profiler_enter
+********************************************************************************
+* Summary:
+*  Marks the start of a secure call.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t - start time for spe_profiler_exit()
+*
+*******************************************************************************/
+uint32_t spe_profiler_enter(void)
+{
+    uint32_t intr_state = Cy_SysLib_EnterCriticalSection();
+
+    spe_calls_active++;
+    Cy_SysLib_ExitCriticalSection(intr_state);
+
+    return perf_counter_get();
+}
+
+/*******************************************************************************
+* Function Name: spe_profiler_exit
+********************************************************************************
+* Summary:
+*  Records the duration of a secure call.
+*
+* Parameters:
+*  service - cause of the secure call
+*  start   - value returned by spe_profiler_enter()
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void spe_profiler_exit(spe_profiler_service_t service, uint32_t start)
+{
+    uint32_t us = perf_counter_cycles_to_us(perf_counter_get() - start);
+    uint32_t intr_state = Cy_SysLib_EnterCriticalSection();
+
+    spe_profiler_record(service, us);
+    spe_calls_active--;
+    Cy_SysLib_ExitCriticalSection(intr_state);
+}
+
+/*******************************************************************************
+* Function Name: spe_profiler_on_tick
+********************************************************************************
+* Summary:
+*  Compares the time since the previous tick with the tick period. The
+*  sample is dropped when ticks were suppressed by the tickless idle, when the
+*  core clock changed in between and while a secure call is in progress,
+*  whose own duration is recorded by spe_profiler_exit().
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void spe_profiler_on_tick(void)
+{
+    uint32_t now = perf_counter_get();
+    TickType_t tick = xTaskGetTickCountFromISR();
+    uint32_t clock_hz = SystemCoreClock;
+    uint32_t period_us = 1000000UL / configTICK_RATE_HZ;
+    uint32_t intr_state;
+    uint32_t us;
+
+    if ((0U != spe_tick_cycles) && ((TickType_t)(spe_tick_count + 1U) == tick) &&
+        (clock_hz == spe_tick_clock_hz) && (0U == spe_calls_active))
+    {
+        us = perf_counter_cycles_to_us(now - spe_tick_cycles);
+        if (us > (period_us + SPE_PROFILER_TICK_SLACK_US))
+        {
+            intr_state = Cy_SysLib_EnterCriticalSection();
+            spe_profiler_record(SPE_PROFILER_SECURE_ISR, us - period_us);
+            Cy_SysLib_ExitCriticalSection(intr_state);
+        }
+    }
+
+    spe_tick_cycles = now;
+    spe_tick_count = tick;
+    spe_tick_clock_hz = clock_hz;
+}
+
+/*******************************************************************************
+* Function Name: spe_profiler_get_stats
+********************************************************************************
+* Summary:
+*  Returns a copy of the statistics of a cause.
+*
+* Parameters:
+*  service - cause
+*  stats   - destination
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void spe_profiler_get_stats(spe_profiler_service_t service,
+                            spe_profiler_stats_t *stats)
+{
+    uint32_t intr_state = Cy_SysLib_EnterCriticalSection();
+
+    *stats = spe_stats[service];
+    Cy_SysLib_ExitCriticalSection(intr_state);
+}
+
+/*******************************************************************************
+* Function Name: spe_profiler_percentile_us
+********************************************************************************
+* Summary:
+*  Returns the residency below which the given share of the samples of a
+*  cause lies.
+*
+* Parameters:
+*  service   - cause
+*  per_mille - share of the samples, 0 to 1000
+*
+* Return:
+*  uint32_t - residency in microseconds, 0 if there are no samples
+*
+*******************************************************************************/
+uint32_t spe_profiler_percentile_us(spe_profiler_service_t service,
+                                    uint32_t per_mille)
+{
+    uint32_t intr_state = Cy_SysLib_EnterCriticalSection();
+    uint32_t result = perf_hist_percentile(&spe_hist[service], per_mille);
+
+    if (result > spe_stats[service].max_us)
+    {
+        result = spe_stats[service].max_us;
+    }
+    Cy_SysLib_ExitCriticalSection(intr_state);
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: spe_profiler_worst_blackout_us
+********************************************************************************
+* Summary:
+*  Returns the longest NS interrupt blackout seen and its cause.
+*
+* Parameters:
+*  service - set to the cause, may be NULL
+*
+* Return:
+*  uint32_t - blackout in microseconds
+*
+*******************************************************************************/
+uint32_t spe_profiler_worst_blackout_us(spe_profiler_service_t *service)
+{
+    uint32_t intr_state = Cy_SysLib_EnterCriticalSection();
+    uint32_t result = spe_worst_us;
+
+    if (NULL != service)
+    {
+        *service = spe_worst_service;
+    }
+    Cy_SysLib_ExitCriticalSection(intr_state);
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: spe_profiler_service_name
+********************************************************************************
+* Summary:
+*  Returns the name of a cause.
+*
+* Parameters:
+*  service - cause
+*
+* Return:
+*  const char * - name
+*
+*******************************************************************************/
+const char *spe_profiler_service_name(spe_profiler_service_t service)
+{
+    return (service < SPE_PROFILER_SERVICE_COUNT) ? spe_service_names[service] : "Unknown";
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,105 @@
+/*****************************************************************************
+* File Name        : spe_profiler.h
+*
+* Description      : This file contains the interface of the secure world
+*                    residency profiler, which measures how long NS
+*                    interrupts are masked inside the SPE
+*
+* Related Document : See README.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+#ifndef SPE_PROFILER_H
+#define SPE_PROFILER_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* A tick period longer than the nominal one by more than this is counted as
+ * an NS interrupt blackout */
+#ifndef SPE_PROFILER_TICK_SLACK_US
+#define SPE_PROFILER_TICK_SLACK_US  (20U)
+#endif
+
+/*******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+/* Causes of SPE residency */
+typedef enum
+{
+    SPE_PROFILER_POWER_MANAGER,     /* POWER_MANAGER secure calls */
+    SPE_PROFILER_PLATFORM,          /* platform secure calls, e.g. LOG() */
+    SPE_PROFILER_SECURE_ISR,        /* tick blackouts outside a secure call */
+    SPE_PROFILER_SERVICE_COUNT
+} spe_profiler_service_t;
+
+/* Residency statistics of one cause, in microseconds */
+typedef struct
+{
+    uint32_t count;
+    uint32_t max_us;
+    uint64_t total_us;
+} spe_profiler_stats_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+/* Clears the statistics and hooks the profiler into the POWER_MANAGER API.
+ * Call after perf_counter_init(). */
+void spe_profiler_init(void);
+
+/* Brackets a secure call. spe_profiler_enter() returns the start time that
+ * must be passed to spe_profiler_exit(). */
+uint32_t spe_profiler_enter(void);
+void spe_profiler_exit(spe_profiler_service_t service, uint32_t start);
+
+/* Measures the tick period. Called from vApplicationTickHook(). */
+void spe_profiler_on_tick(void);
+
+/* Returns a copy of the statistics of a cause */
+void spe_profiler_get_stats(spe_profiler_service_t service,
+                            spe_profiler_stats_t *stats);
+
+/* Returns the residency below which the given share of the samples of a cause
+ * lies, in per mille (500 = median, 990 = p99), capped at the maximum seen */
+uint32_t spe_profiler_percentile_us(spe_profiler_service_t service,
+                                    uint32_t per_mille);
+
+/* Returns the longest NS interrupt blackout seen and its cause */
+uint32_t spe_profiler_worst_blackout_us(spe_profiler_service_t *service);
+
+/* Returns the name of a cause */
+const char *spe_profiler_service_name(spe_profiler_service_t service);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SPE_PROFILER_H */
+
+/* [] END OF FILE */
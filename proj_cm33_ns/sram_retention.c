@@ -0,0 +1,349 @@
+/*****************************************************************************
+* File Name        : sram_retention.c
+*
+* Description      : This source file implements the SRAM retention manager.
+*                    The RAM sections of the image and the ranges registered
+*                    by drivers are mapped to the SRAM macros through the
+*                    retention map; the macros that nothing maps to are a
+*                    power domain that is dropped for DeepSleep and stays
+*                    off until a range registered later needs it.
+*
+* Related Document : See README.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+
+#include "cybsp.h"
+#include "cy_pdl.h"
+
+#include "pd_manager.h"
+#include "retention_map.h"
+#include "sram_retention.h"
+#include "wake_path.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* RAM sections of the image: the vector table, .data and .bss, the heap
+ * with the RTOS objects and task stacks (heap_3) and the main stack. The
+ * defaults are the symbols of the GCC linker script of the BSP; define
+ * SRAM_RETENTION_SECTIONS for other toolchains. The RAM functions are
+ * covered by the m33_code region of the retention map, see wake_path.h. */
+#if !defined(SRAM_RETENTION_SECTIONS)
+extern uint32_t __ram_vectors_start__[];
+extern uint32_t __ram_vectors_end__[];
+extern uint32_t __data_start__[];
+extern uint32_t __bss_end__[];
+extern uint32_t __HeapBase[];
+extern uint32_t __HeapLimit[];
+extern uint32_t __StackLimit[];
+extern uint32_t __StackTop[];
+
+#define SRAM_RETENTION_SECTIONS \
+    { "vectors", __ram_vectors_start__, __ram_vectors_end__ }, \
+    { "data",    __data_start__,        __bss_end__         }, \
+    { "heap",    __HeapBase,            __HeapLimit         }, \
+    { "stack",   __StackLimit,          __StackTop          }
+#endif
+
+/*******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+typedef struct
+{
+    const char *name;
+    const void *start;
+    const void *end;
+} sram_section_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+static void sram_retention_power_on(void);
+static void sram_retention_power_off(void);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+static const sram_section_t sram_sections[] = { SRAM_RETENTION_SECTIONS };
+
+static retention_extent_t sram_extents[SRAM_RETENTION_MAX_EXTENTS];
+static uint32_t sram_extent_count = 0U;
+
+static sram_retention_stats_t sram_stats;
+
+/* Macros powered down by sram_retention_power_off() */
+static uint32_t sram_off_now = 0U;
+
+/* The macros without live data are a power domain of the power domain
+ * manager. It drops them before every DeepSleep entry and leaves them off
+ * after the wake-up until a range registered later needs them. */
+static const pd_domain_ops_t sram_spare_ops =
+{
+    .name = "SRAM spare",
+    .power_on = sram_retention_power_on,
+    .power_off = sram_retention_power_off,
+    .drop_in_deepsleep = true,
+    .on_at_boot = true
+};
+
+#if (APP_RAM_WAKE_PATH != 0)
+/*******************************************************************************
+* Function Name: sram_retention_ramfunc_probe
+********************************************************************************
+* Summary:
+*  Empty function of the wake path. Its address shows where the RAM functions
+*  of the image are.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+WAKE_PATH_FUNC_BEGIN
+static void sram_retention_ramfunc_probe(void)
+{
+}
+WAKE_PATH_FUNC_END
+#endif /* APP_RAM_WAKE_PATH */
+
+/*******************************************************************************
+* Function Name: sram_retention_update
+********************************************************************************
+* Summary:
+*  Recomputes the macros to retain from the registered extents.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void sram_retention_update(void)
+{
+    const retention_memory_t *sram = &retention_map_sram;
+
+    sram_stats.keep_mask = retention_map_keep_mask(sram, sram_extents,
+                                                   sram_extent_count);
+    sram_stats.off_mask = retention_map_all_macros(sram) & ~sram_stats.keep_mask;
+    sram_stats.off_kb = retention_map_kb(sram, sram_stats.off_mask);
+    sram_stats.retained_kb = retention_map_kb(sram, sram_stats.keep_mask);
+    sram_stats.retained_na = retention_map_leakage_na(sram, sram_stats.keep_mask);
+    sram_stats.saved_na = retention_map_leakage_na(sram, sram_stats.off_mask);
+}
+
+/*******************************************************************************
+* Function Name: sram_retention_set_macros
+********************************************************************************
+* Summary:
+*  Powers the macros of a mask up or down.
+*
+* Parameters:
+*  mask - macros
+*  mode - power mode
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void sram_retention_set_macros(uint32_t mask,
+                                      cy_en_syspm_sram_pwr_mode_t mode)
+{
+    uint32_t macro;
+
+    for (macro = 0U; 0U != mask; macro++, mask >>= 1U)
+    {
+        if (0U != (mask & 1U))
+        {
+            (void)Cy_SysPm_SetSRAMMacroPwrMode(
+                (macro < SRAM_RETENTION_MACROS_PER_SRAM) ?
+                    CY_SYSPM_SRAM0_MEMORY : CY_SYSPM_SRAM1_MEMORY,
+                macro % SRAM_RETENTION_MACROS_PER_SRAM, mode);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: sram_retention_power_off
+********************************************************************************
+* Summary:
+*  Powers down the macros without live data. Called by the power domain
+*  manager before the DeepSleep entry, with interrupts masked.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void sram_retention_power_off(void)
+{
+    sram_off_now = sram_stats.off_mask;
+    sram_retention_set_macros(sram_off_now, CY_SYSPM_SRAM_PWR_MODE_OFF);
+    sram_stats.power_downs++;
+}
+
+/*******************************************************************************
+* Function Name: sram_retention_power_on
+********************************************************************************
+* Summary:
+*  Powers up the macros powered down by sram_retention_power_off(). Called by
+*  the power domain manager with interrupts masked.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void sram_retention_power_on(void)
+{
+    sram_retention_set_macros(sram_off_now, CY_SYSPM_SRAM_PWR_MODE_ON);
+    sram_off_now = 0U;
+}
+
+/*******************************************************************************
+* Function Name: sram_retention_init
+********************************************************************************
+* Summary:
+*  Registers the RAM sections of the image and the domain of the macros
+*  without live data, and holds it. With APP_RAM_WAKE_PATH, it asserts that
+*  the RAM functions are in retained macros. Call after pd_manager_init().
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void sram_retention_init(void)
+{
+#if (APP_RAM_WAKE_PATH != 0)
+    const retention_memory_t *sram = &retention_map_sram;
+    uintptr_t ramfunc;
+#endif
+    uint32_t i;
+
+    (void)pd_manager_register(PD_DOMAIN_SRAM_SPARE, &sram_spare_ops);
+    pd_manager_acquire(PD_DOMAIN_SRAM_SPARE);
+
+    for (i = 0U; i < (sizeof(sram_sections) / sizeof(sram_sections[0])); i++)
+    {
+        (void)sram_retention_add(sram_sections[i].name, sram_sections[i].start,
+                                 (uint32_t)((const uint8_t *)sram_sections[i].end -
+                                            (const uint8_t *)sram_sections[i].start));
+    }
+
+#if (APP_RAM_WAKE_PATH != 0)
+    /* A wake path in powered down macros would execute garbage */
+    ramfunc = (uintptr_t)&sram_retention_ramfunc_probe;
+    if ((ramfunc >= SRAM_RETENTION_SRAM_BASE) &&
+        ((ramfunc - SRAM_RETENTION_SRAM_BASE) <
+         ((uintptr_t)sram->macro_size * sram->macro_count)))
+    {
+        CY_ASSERT(0U != (sram_stats.keep_mask &
+                         retention_map_range_macros(sram,
+                             (uint32_t)(ramfunc - SRAM_RETENTION_SRAM_BASE), 1U)));
+    }
+#endif
+}
+
+/*******************************************************************************
+* Function Name: sram_retention_add
+********************************************************************************
+* Summary:
+*  Registers a range with live data. A range outside of the SRAM, e.g. in
+*  the TCM or in external memory, needs no retention and is ignored.
+*
+* Parameters:
+*  name  - name used in reports
+*  start - start address
+*  size  - size in bytes
+*
+* Return:
+*  cy_rslt_t - CY_RSLT_SUCCESS or SRAM_RETENTION_RSLT_ERR_FULL
+*
+*******************************************************************************/
+cy_rslt_t sram_retention_add(const char *name, const void *start, uint32_t size)
+{
+    const retention_memory_t *sram = &retention_map_sram;
+    uintptr_t addr = (uintptr_t)start;
+    uint32_t irq;
+
+    if ((addr < SRAM_RETENTION_SRAM_BASE) ||
+        ((addr - SRAM_RETENTION_SRAM_BASE) >=
+         ((uintptr_t)sram->macro_size * sram->macro_count)))
+    {
+        return CY_RSLT_SUCCESS;
+    }
+
+    irq = Cy_SysLib_EnterCriticalSection();
+    if (sram_extent_count >= SRAM_RETENTION_MAX_EXTENTS)
+    {
+        Cy_SysLib_ExitCriticalSection(irq);
+        return SRAM_RETENTION_RSLT_ERR_FULL;
+    }
+    sram_extents[sram_extent_count].name = name;
+    sram_extents[sram_extent_count].offset = (uint32_t)(addr - SRAM_RETENTION_SRAM_BASE);
+    sram_extents[sram_extent_count].size = size;
+    sram_extent_count++;
+    /* The range may lie in macros dropped for an earlier DeepSleep */
+    pd_manager_use(PD_DOMAIN_SRAM_SPARE);
+    sram_retention_update();
+    Cy_SysLib_ExitCriticalSection(irq);
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: sram_retention_get_stats
+********************************************************************************
+* Summary:
+*  Copies the retention state.
+*
+* Parameters:
+*  stats - destination
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void sram_retention_get_stats(sram_retention_stats_t *stats)
+{
+    uint32_t irq = Cy_SysLib_EnterCriticalSection();
+
+    *stats = sram_stats;
+    Cy_SysLib_ExitCriticalSection(irq);
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,104 @@
+/*****************************************************************************
+* File Name        : sram_retention.h
+*
+* Description      : This file contains the interface of the SRAM retention
+*                    manager. It powers down the SRAM macros that hold no
+*                    live data of any image before a DeepSleep entry, so that
+*                    they draw no retention current, and powers them up again
+*                    after the wake-up.
+*
+* Related Document : See README.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+
+#ifndef SRAM_RETENTION_H
+#define SRAM_RETENTION_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "cy_result.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Ranges with live data, the sections of the image included */
+#define SRAM_RETENTION_MAX_EXTENTS      (8U)
+
+/* No free extent left */
+#define SRAM_RETENTION_RSLT_ERR_FULL    \
+    (CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_MIDDLEWARE_BASE, 0x20U))
+
+/* Address of SRAM0 in the memory map of this image */
+#if !defined(SRAM_RETENTION_SRAM_BASE)
+#define SRAM_RETENTION_SRAM_BASE        (0x24000000UL)
+#endif
+
+/* SRAM macros per SRAM instance */
+#define SRAM_RETENTION_MACROS_PER_SRAM  (8U)
+
+/*******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+/* Retention state */
+typedef struct
+{
+    uint32_t keep_mask;         /* macros retained in DeepSleep */
+    uint32_t off_mask;          /* macros powered down from the next
+                                 * DeepSleep entry on */
+    uint32_t off_kb;            /* size of off_mask */
+    uint32_t retained_kb;       /* size of keep_mask */
+    uint32_t retained_na;       /* retention current of keep_mask, 0 if the
+                                 * SRAM is not characterized */
+    uint32_t saved_na;          /* retention current of off_mask, ditto */
+    uint32_t power_downs;       /* DeepSleep entries that powered macros
+                                 * down; they stay off after the wake-up */
+} sram_retention_stats_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+/* Registers the RAM sections of the image and the power domain of the
+ * macros without live data. Call once at start-up, after pd_manager_init(). */
+void sram_retention_init(void);
+
+/* Registers a range with live data that the sections of the image do not
+ * cover, e.g. a buffer placed by address. Powers the macros dropped for an
+ * earlier DeepSleep up again; those it touches are retained from the next
+ * DeepSleep entry on. */
+cy_rslt_t sram_retention_add(const char *name, const void *start, uint32_t size);
+
+/* Copies the retention state */
+void sram_retention_get_stats(sram_retention_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SRAM_RETENTION_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,194 @@
+/*****************************************************************************
+* File Name        : tickless_idle.c
+*
+* Description      : This source file implements the tickless idle span
+*                    limiter. Every tickless idle period is bounded to the
+*                    span of the LPTimer counters before it is passed to the
+*                    tickless idle implementation of the RTOS abstraction
+*                    library.
+*
+* Related Document : See README.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+
+#include <string.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "cy_pdl.h"
+#include "tickless_idle.h"
+#include "wake_path.h"
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+static tickless_idle_stats_t tickless_stats;
+
+/* Longest tickless idle period with the configured counters, in ticks */
+static uint32_t tickless_max_ticks = 0U;
+
+/*******************************************************************************
+* Function Name: counts_to_ticks
+********************************************************************************
+* Summary:
+*  Converts an LPTimer count into RTOS ticks, rounded down.
+*
+* Parameters:
+*  counts - LPTimer counts
+*  lf_hz  - CLK_LF frequency, the clock of the MCWDT
+*
+* Return:
+*  uint32_t - ticks
+*
+*******************************************************************************/
+static uint32_t counts_to_ticks(uint32_t counts, uint32_t lf_hz)
+{
+    return (uint32_t)(((uint64_t)counts * configTICK_RATE_HZ) / lf_hz);
+}
+
+/*******************************************************************************
+* Function Name: tickless_idle_init
+********************************************************************************
+* Summary:
+*  Sets the LPTimer span and clears the statistics. Call before the scheduler
+*  starts, after the clocks are configured. Without a CLK_LF frequency the
+*  span is left to the library.
+*
+* Parameters:
+*  cascaded - true if counters 0 and 1 of the MCWDT are cascaded
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void tickless_idle_init(bool cascaded)
+{
+    uint32_t lf_hz = Cy_SysClk_ClkLfGetFrequency();
+
+    memset(&tickless_stats, 0, sizeof(tickless_stats));
+    tickless_max_ticks = 0U;
+    if (0U != lf_hz)
+    {
+        tickless_max_ticks = counts_to_ticks(cascaded ?
+                                             TICKLESS_IDLE_CASCADE_MAX_COUNTS :
+                                             TICKLESS_IDLE_SINGLE_MAX_COUNTS,
+                                             lf_hz);
+    }
+}
+
+/*******************************************************************************
+* Function Name: tickless_idle_max_suppressible_ticks
+********************************************************************************
+* Summary:
+*  Returns the number of ticks one tickless idle period can suppress.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t - ticks
+*
+*******************************************************************************/
+uint32_t tickless_idle_max_suppressible_ticks(void)
+{
+    return tickless_max_ticks;
+}
+
+/*******************************************************************************
+* Function Name: tickless_idle_sleep
+********************************************************************************
+* Summary:
+*  Sleeps for the expected idle time, at most for the LPTimer span. A period
+*  that ends at the span while no task is due is an overflow wake: the idle
+*  task runs once and sleeps again.
+*
+* Parameters:
+*  expected_idle_ticks - ticks until the next task unblocks
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+WAKE_PATH_FUNC_BEGIN
+void tickless_idle_sleep(uint32_t expected_idle_ticks)
+{
+    TickType_t start = xTaskGetTickCount();
+    uint32_t sleep_ticks = expected_idle_ticks;
+    uint32_t slept_ticks;
+
+#if defined(configPRE_SLEEP_PROCESSING)
+    /* The port default of portSUPPRESS_TICKS_AND_SLEEP() is replaced, so the
+     * hook is called here. It may skip the sleep by setting the time to 0. */
+    configPRE_SLEEP_PROCESSING(sleep_ticks);
+    if (0U == sleep_ticks)
+    {
+        return;
+    }
+#endif
+
+    /* Not initialized: leave the limit to the library */
+    if ((0U != tickless_max_ticks) && (sleep_ticks > tickless_max_ticks))
+    {
+        sleep_ticks = tickless_max_ticks;
+    }
+
+    vApplicationSleep(sleep_ticks);
+
+    slept_ticks = (uint32_t)(xTaskGetTickCount() - start);
+    tickless_stats.sleeps++;
+    if (slept_ticks > tickless_stats.longest_sleep_ticks)
+    {
+        tickless_stats.longest_sleep_ticks = slept_ticks;
+    }
+    if ((sleep_ticks < expected_idle_ticks) && (slept_ticks >= sleep_ticks))
+    {
+        tickless_stats.overflow_wakes++;
+    }
+}
+WAKE_PATH_FUNC_END
+
+/*******************************************************************************
+* Function Name: tickless_idle_get_stats
+********************************************************************************
+* Summary:
+*  Returns a copy of the statistics.
+*
+* Parameters:
+*  stats - destination
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void tickless_idle_get_stats(tickless_idle_stats_t *stats)
+{
+    uint32_t intr_state = Cy_SysLib_EnterCriticalSection();
+
+    *stats = tickless_stats;
+    Cy_SysLib_ExitCriticalSection(intr_state);
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,87 @@
+/*****************************************************************************
+* File Name        : tickless_idle.h
+*
+* Description      : This file contains the interface of the tickless idle
+*                    span limiter. It bounds every tickless idle period to
+*                    the span of the LPTimer counters and counts the overflow
+*                    wakes this causes.
+*
+* Related Document : See README.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+
+#ifndef TICKLESS_IDLE_H
+#define TICKLESS_IDLE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Longest LPTimer delay with counter 0 alone (16 bits) and with counters 0
+ * and 1 cascaded (32 bits). The cascaded delay stays below 2^32 so that both
+ * counters never wrap at the same time. */
+#define TICKLESS_IDLE_SINGLE_MAX_COUNTS     (0x0000FFFFUL)
+#define TICKLESS_IDLE_CASCADE_MAX_COUNTS    (0xFFF0FFFFUL)
+
+/*******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+/* Tickless idle statistics. An overflow wake ends a tickless idle period at
+ * the LPTimer span while no task was due yet. */
+typedef struct
+{
+    uint32_t sleeps;                /* tickless idle periods */
+    uint32_t overflow_wakes;        /* periods ended by the LPTimer span */
+    uint32_t longest_sleep_ticks;
+} tickless_idle_stats_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+/* Sets the LPTimer span from the counter cascading of the MCWDT used by
+ * tickless idle and from the CLK_LF frequency, and clears the statistics */
+void tickless_idle_init(bool cascaded);
+
+/* Returns the number of ticks one tickless idle period can suppress */
+uint32_t tickless_idle_max_suppressible_ticks(void);
+
+/* Tickless idle hook, called by the idle task through
+ * portSUPPRESS_TICKS_AND_SLEEP() with the scheduler suspended */
+void tickless_idle_sleep(uint32_t expected_idle_ticks);
+
+/* Returns a copy of the statistics */
+void tickless_idle_get_stats(tickless_idle_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TICKLESS_IDLE_H */
+
+/* [] END OF FILE */
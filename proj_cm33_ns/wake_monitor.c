@@ -0,0 +1,277 @@
+/*****************************************************************************
+* File Name        : wake_monitor.c
+*
+* Description      : This source file implements the wake path monitor.
+*                    It checks every wake-up against the secure event
+*                    sequence number of the POWER_MANAGER partition and
+*                    records the wake-to-task latency distribution.
+*
+* Related Document : See README.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+
+#include <string.h>
+
+#include "cy_pdl.h"
+#include "power_manager_defs.h"
+#include "perf_counter.h"
+#include "wake_path.h"
+#include "wake_monitor.h"
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+static wake_monitor_stats_t wake_stats;
+static perf_hist_t wake_latency_hist;
+
+/* Cycle counter at the last DeepSleep exit not yet seen by the task */
+static uint32_t wake_exit_cycles;
+static bool wake_exit_pending = false;
+
+/*******************************************************************************
+* Function Name: wake_monitor_init
+********************************************************************************
+* Summary:
+*  Clears the statistics.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void wake_monitor_init(void)
+{
+    uint32_t intr_state = Cy_SysLib_EnterCriticalSection();
+
+    memset(&wake_stats, 0, sizeof(wake_stats));
+    perf_hist_reset(&wake_latency_hist);
+    wake_exit_pending = false;
+    Cy_SysLib_ExitCriticalSection(intr_state);
+}
+
+/*******************************************************************************
+* Function Name: wake_monitor_on_wakeup
+********************************************************************************
+* Summary:
+*  Records a DeepSleep exit and classifies it by the number of wake-up events
+*  since the previous exit. An exit by a secure timed wake-up is not
+*  spurious.
+*
+* Parameters:
+*  sources     - wake-up source bitfield read from the partition
+*  event_seq   - wake-up event sequence number read from the partition
+*  exit_cycles - cycle counter at the start of the DeepSleep callback
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+WAKE_PATH_FUNC_BEGIN
+void wake_monitor_on_wakeup(uint32_t sources, uint32_t event_seq,
+                            uint32_t exit_cycles)
+{
+    uint32_t intr_state = Cy_SysLib_EnterCriticalSection();
+    uint32_t delta = event_seq - wake_stats.last_seq;
+
+    wake_stats.wakes++;
+    if (0U != (sources & WAKEUP_SOURCE_TIMER))
+    {
+        wake_stats.timer_wakes++;
+    }
+
+    if ((int32_t)delta < 0)
+    {
+        /* Partition restarted, count from the new value */
+        wake_stats.seq_regressions++;
+    }
+    else if (0U == delta)
+    {
+        if (0U != (sources & WAKEUP_SOURCE_TIMER))
+        {
+            /* Timed wake-up, no button event expected */
+        }
+        else if (0U != (sources & (WAKEUP_SOURCE_USER_BTN1 | WAKEUP_SOURCE_USER_BTN2)))
+        {
+            wake_stats.duplicate_wakes++;
+        }
+        else
+        {
+            wake_stats.spurious_wakes++;
+        }
+    }
+    else
+    {
+        wake_stats.events += delta;
+        wake_stats.events_coalesced += delta - 1U;
+    }
+    wake_stats.last_seq = event_seq;
+
+    wake_exit_cycles = exit_cycles;
+    wake_exit_pending = true;
+    Cy_SysLib_ExitCriticalSection(intr_state);
+}
+WAKE_PATH_FUNC_END
+
+/*******************************************************************************
+* Function Name: wake_monitor_on_abort
+********************************************************************************
+* Summary:
+*  Records a DeepSleep entry aborted by a pending event and the time spent in
+*  the callbacks until the abort.
+*
+* Parameters:
+*  start_cycles - cycle counter at the first CHECK_READY callback
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void wake_monitor_on_abort(uint32_t start_cycles)
+{
+    uint32_t abort_us = perf_counter_cycles_to_us(perf_counter_get() - start_cycles);
+    uint32_t intr_state = Cy_SysLib_EnterCriticalSection();
+
+    wake_stats.aborts++;
+    wake_stats.abort_us += abort_us;
+    Cy_SysLib_ExitCriticalSection(intr_state);
+}
+
+/*******************************************************************************
+* Function Name: wake_monitor_on_wasted_sleep
+********************************************************************************
+* Summary:
+*  Records a DeepSleep period too short to save the energy of the
+*  transition.
+*
+* Parameters:
+*  sleep_us - time from the DeepSleep entry to the exit
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+WAKE_PATH_FUNC_BEGIN
+void wake_monitor_on_wasted_sleep(uint32_t sleep_us)
+{
+    uint32_t intr_state = Cy_SysLib_EnterCriticalSection();
+
+    wake_stats.wasted_sleeps++;
+    wake_stats.wasted_us += sleep_us;
+    Cy_SysLib_ExitCriticalSection(intr_state);
+}
+WAKE_PATH_FUNC_END
+
+/*******************************************************************************
+* Function Name: wake_monitor_on_task_wake
+********************************************************************************
+* Summary:
+*  Records a wake of the application task and the latency from the last
+*  DeepSleep exit.
+*
+* Parameters:
+*  notifications - value returned by ulTaskNotifyTake(pdTRUE, ...)
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void wake_monitor_on_task_wake(uint32_t notifications)
+{
+    uint32_t now = perf_counter_get();
+    uint32_t intr_state = Cy_SysLib_EnterCriticalSection();
+    uint32_t latency_us;
+
+    wake_stats.task_wakes++;
+    if (notifications > 1U)
+    {
+        wake_stats.notify_collapsed += notifications - 1U;
+    }
+
+    if (wake_exit_pending)
+    {
+        latency_us = perf_counter_cycles_to_us(now - wake_exit_cycles);
+        perf_hist_add(&wake_latency_hist, latency_us);
+        wake_stats.latency_samples++;
+        if (latency_us > wake_stats.latency_max_us)
+        {
+            wake_stats.latency_max_us = latency_us;
+        }
+        wake_exit_pending = false;
+    }
+    Cy_SysLib_ExitCriticalSection(intr_state);
+}
+
+/*******************************************************************************
+* Function Name: wake_monitor_get_stats
+********************************************************************************
+* Summary:
+*  Returns a copy of the statistics.
+*
+* Parameters:
+*  stats - destination
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void wake_monitor_get_stats(wake_monitor_stats_t *stats)
+{
+    uint32_t intr_state = Cy_SysLib_EnterCriticalSection();
+
+    *stats = wake_stats;
+    Cy_SysLib_ExitCriticalSection(intr_state);
+}
+
+/*******************************************************************************
+* Function Name: wake_monitor_latency_percentile_us
+********************************************************************************
+* Summary:
+*  Returns the wake-to-task latency below which the given share of the
+*  samples lies.
+*
+* Parameters:
+*  per_mille - share of the samples, 0 to 1000
+*
+* Return:
+*  uint32_t - latency in microseconds, 0 if there are no samples
+*
+*******************************************************************************/
+uint32_t wake_monitor_latency_percentile_us(uint32_t per_mille)
+{
+    uint32_t intr_state = Cy_SysLib_EnterCriticalSection();
+    uint32_t result = perf_hist_percentile(&wake_latency_hist, per_mille);
+
+    if (result > wake_stats.latency_max_us)
+    {
+        result = wake_stats.latency_max_us;
+    }
+    Cy_SysLib_ExitCriticalSection(intr_state);
+
+    return result;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,124 @@
+/*****************************************************************************
+* File Name        : wake_monitor.h
+*
+* Description      : This file contains the interface of the wake path
+*                    monitor. It checks every wake-up against the secure
+*                    event sequence number and records the wake-to-task
+*                    latency distribution.
+*
+* Related Document : See README.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+
+#ifndef WAKE_MONITOR_H
+#define WAKE_MONITOR_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+/* Wake path statistics.
+ *
+ * Every wake-up interrupt increments the event sequence number of the
+ * POWER_MANAGER partition. The DeepSleep exit callback reads it and the
+ * difference to the previous read is the number of events behind the wake:
+ *  - 1 event : the normal case
+ *  - n > 1   : n - 1 events were coalesced into one task wake, either because
+ *              they came while the application was ACTIVE or because several
+ *              came during one DeepSleep exit
+ *  - 0, no wake-up source set : the wake had another cause (a timer)
+ *  - 0, wake-up source set    : the same event was reported twice
+ * A sequence number that goes backwards means the partition state was lost.
+ *
+ * An event that comes while the DeepSleep callbacks run makes the sleep
+ * useless. Up to the last CHECK_READY callback the entry is aborted and the
+ * event is handled like a wake; later, the system enters DeepSleep and
+ * wakes again at once. Both costs are counted.
+ */
+typedef struct
+{
+    uint32_t wakes;             /* DeepSleep exits and entries aborted for an
+                                 * event, seen by the callbacks */
+    uint32_t task_wakes;        /* wakes of the application task */
+    uint32_t notify_collapsed;  /* task notifications merged by
+                                 * ulTaskNotifyTake(pdTRUE) */
+    uint32_t events;            /* wake-up events behind the wakes */
+    uint32_t events_coalesced;  /* events without a wake of their own */
+    uint32_t spurious_wakes;    /* wakes without a wake-up event */
+    uint32_t duplicate_wakes;   /* wakes that reported an event again */
+    uint32_t timer_wakes;       /* wakes by a secure timed wake-up */
+    uint32_t seq_regressions;   /* sequence number went backwards */
+    uint32_t last_seq;          /* last sequence number read */
+    uint32_t latency_samples;
+    uint32_t latency_max_us;
+    uint32_t aborts;            /* DeepSleep entries aborted by a pending
+                                 * event */
+    uint32_t abort_us;          /* time in the callbacks of aborted entries */
+    uint32_t wasted_sleeps;     /* DeepSleep periods shorter than the
+                                 * DeepSleep latency */
+    uint32_t wasted_us;         /* time in wasted DeepSleep periods */
+} wake_monitor_stats_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+/* Clears the statistics */
+void wake_monitor_init(void);
+
+/* Records a DeepSleep exit. Called from the DeepSleep callback with the wake
+ * information read from the POWER_MANAGER partition and the cycle counter
+ * value at the start of the callback. */
+void wake_monitor_on_wakeup(uint32_t sources, uint32_t event_seq,
+                            uint32_t exit_cycles);
+
+/* Records a DeepSleep entry aborted by a pending event. start_cycles is the
+ * cycle counter value at the first CHECK_READY callback. */
+void wake_monitor_on_abort(uint32_t start_cycles);
+
+/* Records a DeepSleep period too short to save the energy of the
+ * transition */
+void wake_monitor_on_wasted_sleep(uint32_t sleep_us);
+
+/* Records a wake of the application task. notifications is the value
+ * returned by ulTaskNotifyTake(pdTRUE, ...). */
+void wake_monitor_on_task_wake(uint32_t notifications);
+
+/* Returns a copy of the statistics */
+void wake_monitor_get_stats(wake_monitor_stats_t *stats);
+
+/* Returns the wake-to-task latency below which the given share of the
+ * samples lies, in per mille (500 = median, 990 = p99). The result is the
+ * upper bound of the histogram bucket, capped at the maximum seen. */
+uint32_t wake_monitor_latency_percentile_us(uint32_t per_mille);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* WAKE_MONITOR_H */
+
+/* [] END OF FILE */
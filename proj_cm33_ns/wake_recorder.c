@@ -0,0 +1,421 @@
+/*****************************************************************************
+* File Name        : wake_recorder.c
+*
+* Description      : This source file implements the wake recorder. A power
+*                    event subscriber writes the records to a RAM ring; the
+*                    readers turn them into timeline lines.
+*
+* Related Document : See README.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+
+#include <stdio.h>
+
+#include "cy_pdl.h"
+
+#include "power_manager_defs.h"
+#include "energy_monitor.h"
+#include "power_event.h"
+#include "wake_recorder.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+#define WAKE_RECORDER_MASK              (WAKE_RECORDER_SIZE - 1U)
+
+#if ((WAKE_RECORDER_SIZE & WAKE_RECORDER_MASK) != 0U)
+#error "WAKE_RECORDER_SIZE must be a power of two"
+#endif
+
+/* Wake-up sources counted as button wakes */
+#define WAKE_RECORDER_BUTTONS           (WAKEUP_SOURCE_USER_BTN1 | WAKEUP_SOURCE_USER_BTN2)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/* Keywords of the record types, indexed by type */
+static const char *const wake_recorder_names[WAKE_RECORDER_TYPES] =
+{
+    "sleep",
+    "wake",
+    "state",
+    "cycle",
+    "lost"
+};
+
+#if (APP_WAKE_RECORDER != 0)
+
+static void wake_recorder_on_event(const power_event_t *event, void *arg);
+
+static wake_recorder_record_t wake_recorder_ring[WAKE_RECORDER_SIZE];
+
+/* Number of the next record */
+static uint32_t wake_recorder_head = 0U;
+
+static wake_recorder_summary_t wake_recorder_summary;
+
+/* Takes every event, after the other subscribers */
+static power_event_sub_t wake_recorder_sub =
+{
+    .type_mask = POWER_EVENT_MASK(POWER_EVENT_SLEEP_ENTRY) |
+                 POWER_EVENT_MASK(POWER_EVENT_WAKE) |
+                 POWER_EVENT_MASK(POWER_EVENT_APP_STATE),
+    .source_mask = 0U,
+    .priority = UINT32_MAX,
+    .task = NULL,
+    .callback = wake_recorder_on_event,
+    .arg = NULL
+};
+
+/*******************************************************************************
+* Function Name: wake_recorder_add
+********************************************************************************
+* Summary:
+*  Writes a record stamped with the LPTimer time. Called with interrupts
+*  masked.
+*
+* Parameters:
+*  type  - WAKE_RECORDER_x record type
+*  value - value of the record
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void wake_recorder_add(uint32_t type, uint32_t value)
+{
+    wake_recorder_record_t *record =
+        &wake_recorder_ring[wake_recorder_head & WAKE_RECORDER_MASK];
+
+    record->time_ms = (uint32_t)(energy_monitor_get_time_us() / 1000U);
+    record->type_value = WAKE_RECORDER_PACK(type, value);
+    wake_recorder_head++;
+    wake_recorder_account(&wake_recorder_summary, record);
+}
+
+/*******************************************************************************
+* Function Name: wake_recorder_on_event
+********************************************************************************
+* Summary:
+*  Power event callback. Records the event.
+*
+* Parameters:
+*  event - record of the power event bus
+*  arg   - unused
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void wake_recorder_on_event(const power_event_t *event, void *arg)
+{
+    CY_UNUSED_PARAMETER(arg);
+
+    wake_recorder_add((uint32_t)event->type,
+                      (POWER_EVENT_APP_STATE == event->type) ? event->arg :
+                                                               event->sources);
+}
+
+#endif /* APP_WAKE_RECORDER */
+
+/*******************************************************************************
+* Function Name: wake_recorder_init
+********************************************************************************
+* Summary:
+*  Subscribes to the power event bus when built with APP_WAKE_RECORDER.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void wake_recorder_init(void)
+{
+#if (APP_WAKE_RECORDER != 0)
+    power_event_subscribe(&wake_recorder_sub);
+#endif
+}
+
+/*******************************************************************************
+* Function Name: wake_recorder_add_cycle
+********************************************************************************
+* Summary:
+*  Records the energy of an ACTIVE + IDLE cycle.
+*
+* Parameters:
+*  energy_uj - energy of the cycle
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void wake_recorder_add_cycle(uint32_t energy_uj)
+{
+#if (APP_WAKE_RECORDER != 0)
+    uint32_t irq = Cy_SysLib_EnterCriticalSection();
+
+    wake_recorder_add(WAKE_RECORDER_CYCLE, (energy_uj > WAKE_RECORDER_VALUE_MAX) ?
+                                           WAKE_RECORDER_VALUE_MAX : energy_uj);
+    Cy_SysLib_ExitCriticalSection(irq);
+#else
+    CY_UNUSED_PARAMETER(energy_uj);
+#endif
+}
+
+/*******************************************************************************
+* Function Name: wake_recorder_pending
+********************************************************************************
+* Summary:
+*  Returns the number of records the reader has not read, including those
+*  already overwritten.
+*
+* Parameters:
+*  reader - reader
+*
+* Return:
+*  uint32_t - number of records
+*
+*******************************************************************************/
+uint32_t wake_recorder_pending(const wake_recorder_reader_t *reader)
+{
+#if (APP_WAKE_RECORDER != 0)
+    return wake_recorder_head - reader->next;
+#else
+    CY_UNUSED_PARAMETER(reader);
+    return 0U;
+#endif
+}
+
+/*******************************************************************************
+* Function Name: wake_recorder_read_line
+********************************************************************************
+* Summary:
+*  Writes the next unread record as a timeline line:
+*
+*    WREC <time_ms> sleep
+*    WREC <time_ms> wake 0x<sources> [slept <ms>]
+*    WREC <time_ms> state <en_app_state_t>
+*    WREC <time_ms> cycle <uJ>
+*    WREC <time_ms> lost <records>
+*
+*  A wake-up after a DeepSleep entry of the same reader shows the time in
+*  DeepSleep; one without is an aborted entry.
+*
+* Parameters:
+*  reader - reader
+*  line   - destination
+*  size   - size of line, WAKE_RECORDER_LINE_SIZE is enough
+*
+* Return:
+*  bool - false if there is no unread record
+*
+*******************************************************************************/
+bool wake_recorder_read_line(wake_recorder_reader_t *reader, char *line,
+                             size_t size)
+{
+#if (APP_WAKE_RECORDER != 0)
+    wake_recorder_record_t record;
+    uint32_t lost;
+    uint32_t type;
+    uint32_t irq = Cy_SysLib_EnterCriticalSection();
+
+    if (reader->next == wake_recorder_head)
+    {
+        Cy_SysLib_ExitCriticalSection(irq);
+        return false;
+    }
+
+    lost = wake_recorder_head - reader->next;
+    lost = (lost > WAKE_RECORDER_SIZE) ? (lost - WAKE_RECORDER_SIZE) : 0U;
+    reader->next += lost;
+    record = wake_recorder_ring[reader->next & WAKE_RECORDER_MASK];
+    if (0U != lost)
+    {
+        /* Reported at the time of the first record still kept */
+        record.type_value = WAKE_RECORDER_PACK(WAKE_RECORDER_LOST, lost);
+    }
+    else
+    {
+        reader->next++;
+    }
+    Cy_SysLib_ExitCriticalSection(irq);
+
+    type = WAKE_RECORDER_TYPE(&record);
+    switch (type)
+    {
+        case WAKE_RECORDER_SLEEP:
+            (void)snprintf(line, size, WAKE_RECORDER_TAG " %lu %s",
+                           (unsigned long)record.time_ms, wake_recorder_names[type]);
+            break;
+        case WAKE_RECORDER_WAKE:
+            if (reader->summary.asleep)
+            {
+                (void)snprintf(line, size, WAKE_RECORDER_TAG " %lu %s 0x%02lx slept %lu",
+                               (unsigned long)record.time_ms, wake_recorder_names[type],
+                               (unsigned long)WAKE_RECORDER_VALUE(&record),
+                               (unsigned long)(record.time_ms - reader->summary.entry_ms));
+            }
+            else
+            {
+                (void)snprintf(line, size, WAKE_RECORDER_TAG " %lu %s 0x%02lx",
+                               (unsigned long)record.time_ms, wake_recorder_names[type],
+                               (unsigned long)WAKE_RECORDER_VALUE(&record));
+            }
+            break;
+        default:
+            (void)snprintf(line, size, WAKE_RECORDER_TAG " %lu %s %lu",
+                           (unsigned long)record.time_ms, wake_recorder_names[type],
+                           (unsigned long)WAKE_RECORDER_VALUE(&record));
+            break;
+    }
+    wake_recorder_account(&reader->summary, &record);
+
+    return true;
+#else
+    CY_UNUSED_PARAMETER(reader);
+    CY_UNUSED_PARAMETER(line);
+    CY_UNUSED_PARAMETER(size);
+    return false;
+#endif
+}
+
+/*******************************************************************************
+* Function Name: wake_recorder_account
+********************************************************************************
+* Summary:
+*  Adds a record to a summary. A wake-up is counted by its strongest source:
+*  a button, then the secure timer. After lost records the next wake-up is
+*  not matched with a DeepSleep entry.
+*
+* Parameters:
+*  summary - totals
+*  record  - record
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void wake_recorder_account(wake_recorder_summary_t *summary,
+                           const wake_recorder_record_t *record)
+{
+    uint32_t value = WAKE_RECORDER_VALUE(record);
+
+    summary->end_ms = record->time_ms;
+    switch (WAKE_RECORDER_TYPE(record))
+    {
+        case WAKE_RECORDER_SLEEP:
+            summary->sleeps++;
+            summary->entry_ms = record->time_ms;
+            summary->asleep = true;
+            break;
+        case WAKE_RECORDER_WAKE:
+            if (summary->asleep)
+            {
+                summary->sleep_ms += record->time_ms - summary->entry_ms;
+            }
+            else
+            {
+                summary->aborts++;
+            }
+            summary->asleep = false;
+            if (0U != (value & WAKE_RECORDER_BUTTONS))
+            {
+                summary->button_wakes++;
+            }
+            else if (0U != (value & WAKEUP_SOURCE_TIMER))
+            {
+                summary->timer_wakes++;
+            }
+            else
+            {
+                summary->other_wakes++;
+            }
+            break;
+        case WAKE_RECORDER_APP_STATE:
+            summary->state_changes++;
+            break;
+        case WAKE_RECORDER_CYCLE:
+            summary->cycles++;
+            summary->energy_uj += value;
+            break;
+        case WAKE_RECORDER_LOST:
+            summary->lost += value;
+            summary->asleep = false;
+            return;
+        default:
+            return;
+    }
+    summary->records++;
+}
+
+/*******************************************************************************
+* Function Name: wake_recorder_type_name
+********************************************************************************
+* Summary:
+*  Returns the keyword of a record type in the timeline lines.
+*
+* Parameters:
+*  type - WAKE_RECORDER_x record type
+*
+* Return:
+*  const char* - keyword, NULL for an unknown type
+*
+*******************************************************************************/
+const char *wake_recorder_type_name(uint32_t type)
+{
+    return (type < WAKE_RECORDER_TYPES) ? wake_recorder_names[type] : NULL;
+}
+
+/*******************************************************************************
+* Function Name: wake_recorder_get_summary
+********************************************************************************
+* Summary:
+*  Returns a copy of the totals of all records.
+*
+* Parameters:
+*  summary - destination
+*
+* Return:
+*  bool - false if not built with APP_WAKE_RECORDER
+*
+*******************************************************************************/
+bool wake_recorder_get_summary(wake_recorder_summary_t *summary)
+{
+#if (APP_WAKE_RECORDER != 0)
+    uint32_t irq = Cy_SysLib_EnterCriticalSection();
+
+    *summary = wake_recorder_summary;
+    Cy_SysLib_ExitCriticalSection(irq);
+    return true;
+#else
+    CY_UNUSED_PARAMETER(summary);
+    return false;
+#endif
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,168 @@
+/*****************************************************************************
+* File Name        : wake_recorder.h
+*
+* Description      : This file contains the interface of the wake recorder.
+*                    It keeps the DeepSleep entries, wake-ups and application
+*                    state changes of the power event bus, and the energy of
+*                    each application state cycle, as 8-byte records in a RAM
+*                    ring. The records are read out as text lines, the
+*                    timeline that the host simulation replays, see
+*                    docs/host_simulation.md.
+*
+* Related Document : See README.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+
+#ifndef WAKE_RECORDER_H
+#define WAKE_RECORDER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* 1 records the power events. Set APP_WAKE_RECORDER in common.mk. */
+#if !defined(APP_WAKE_RECORDER)
+#define APP_WAKE_RECORDER               (0)
+#endif
+
+/* Records kept in RAM, a power of two. 8 bytes each. */
+#if !defined(WAKE_RECORDER_SIZE)
+#define WAKE_RECORDER_SIZE              (256U)
+#endif
+
+/* The App State Manager logs the records once this many are unread */
+#if !defined(WAKE_RECORDER_DUMP_RECORDS)
+#define WAKE_RECORDER_DUMP_RECORDS      (WAKE_RECORDER_SIZE / 2U)
+#endif
+
+/* Tag at the start of a timeline line, so that the lines can be taken from
+ * a log with other messages */
+#define WAKE_RECORDER_TAG               "WREC"
+
+/* Longest timeline line, with the terminating zero */
+#define WAKE_RECORDER_LINE_SIZE         (64U)
+
+/* Record types. The first ones are those of the power event bus. */
+#define WAKE_RECORDER_SLEEP             (0U)    /* POWER_EVENT_SLEEP_ENTRY */
+#define WAKE_RECORDER_WAKE              (1U)    /* POWER_EVENT_WAKE */
+#define WAKE_RECORDER_APP_STATE         (2U)    /* POWER_EVENT_APP_STATE */
+#define WAKE_RECORDER_CYCLE             (3U)    /* end of an ACTIVE + IDLE cycle */
+#define WAKE_RECORDER_LOST              (4U)    /* records overwritten before
+                                                 * they were read, in lines
+                                                 * only */
+#define WAKE_RECORDER_TYPES             (5U)
+
+/* Record value: 28 bits below the type */
+#define WAKE_RECORDER_VALUE_MAX         (0x0FFFFFFFUL)
+#define WAKE_RECORDER_PACK(type, value) (((uint32_t)(type) << 28U) | \
+                                         ((uint32_t)(value) & WAKE_RECORDER_VALUE_MAX))
+#define WAKE_RECORDER_TYPE(record)      ((record)->type_value >> 28U)
+#define WAKE_RECORDER_VALUE(record)     ((record)->type_value & WAKE_RECORDER_VALUE_MAX)
+
+/*******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+/* Record */
+typedef struct
+{
+    uint32_t time_ms;           /* LPTimer time since the start-up */
+    uint32_t type_value;        /* WAKE_RECORDER_PACK() of the type and of
+                                 * WAKE: WAKEUP_SOURCE_x bits,
+                                 * APP_STATE: new en_app_state_t,
+                                 * CYCLE: energy in uJ,
+                                 * LOST: number of records */
+} wake_recorder_record_t;
+
+/* Totals of a timeline. The recorder keeps those of all records; a reader
+ * those of the records it has read. */
+typedef struct
+{
+    uint32_t records;
+    uint32_t lost;              /* records overwritten before read */
+    uint32_t sleeps;            /* DeepSleep entries */
+    uint32_t aborts;            /* wake-ups without a DeepSleep entry */
+    uint32_t button_wakes;      /* by USER BTN1 or BTN2 */
+    uint32_t timer_wakes;       /* by the secure timer and no button */
+    uint32_t other_wakes;       /* without a wake-up source */
+    uint32_t state_changes;
+    uint32_t cycles;
+    uint64_t sleep_ms;          /* time in DeepSleep */
+    uint64_t energy_uj;         /* energy of the cycles */
+    uint32_t end_ms;            /* time of the last record */
+    uint32_t entry_ms;          /* time of the DeepSleep entry */
+    bool asleep;                /* a DeepSleep entry without its exit */
+} wake_recorder_summary_t;
+
+/* Reader of the ring, owned by the caller. Zero it before the first read. */
+typedef struct
+{
+    uint32_t next;              /* number of the next record */
+    wake_recorder_summary_t summary;
+} wake_recorder_reader_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+/* Subscribes to the power event bus when built with APP_WAKE_RECORDER. Call
+ * once at start-up, after energy_monitor_init(). */
+void wake_recorder_init(void);
+
+/* Records the energy of an ACTIVE + IDLE cycle, from
+ * energy_monitor_end_cycle() */
+void wake_recorder_add_cycle(uint32_t energy_uj);
+
+/* Returns the number of records the reader has not read */
+uint32_t wake_recorder_pending(const wake_recorder_reader_t *reader);
+
+/* Writes the next record the reader has not read to line as a timeline line
+ * without a line end. Records overwritten before they were read are
+ * reported first, as one LOST line. Returns false if there is none. */
+bool wake_recorder_read_line(wake_recorder_reader_t *reader, char *line,
+                             size_t size);
+
+/* Adds a record to a summary. Used by the recorder and by the host tools
+ * that read a timeline. */
+void wake_recorder_account(wake_recorder_summary_t *summary,
+                           const wake_recorder_record_t *record);
+
+/* Returns the keyword of a record type in the timeline lines, or NULL */
+const char *wake_recorder_type_name(uint32_t type);
+
+/* Returns a copy of the totals of all records; false if not built with
+ * APP_WAKE_RECORDER */
+bool wake_recorder_get_summary(wake_recorder_summary_t *summary);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* WAKE_RECORDER_H */
+
+/* [] END OF FILE */
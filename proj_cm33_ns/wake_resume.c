@@ -0,0 +1,167 @@
+/*****************************************************************************
+* File Name        : wake_resume.c
+*
+* Description      : This source file implements the DeepSleep resume timer.
+*                    A DeepSleep callback of the last order reads the cycle
+*                    counter before the entry and after the exit.
+*
+* Related Document : See README.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+
+#include "cybsp.h"
+#include "cy_pdl.h"
+
+#include "perf_counter.h"
+#include "wake_path.h"
+#include "wake_resume.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Above every other BEFORE_TRANSITION and AFTER_TRANSITION callback, so
+ * that it runs last before the entry and first after the exit. Only the
+ * CHECK_READY callback of main.c has a higher order. */
+#define WAKE_RESUME_CALLBACK_ORDER      (254U)
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+static cy_en_syspm_status_t wake_resume_deepsleep_callback(
+                                cy_stc_syspm_callback_params_t *callbackParams,
+                                cy_en_syspm_callback_mode_t mode);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+static uint32_t wake_resume_entry_cycles;
+
+static wake_resume_stats_t wake_resume_stats;
+
+static cy_stc_syspm_callback_params_t wake_resume_cback_params =
+{
+    .base = NULL,
+    .context = NULL
+};
+
+static cy_stc_syspm_callback_t wake_resume_ds_cback =
+{
+    .callback = wake_resume_deepsleep_callback,
+    .type = CY_SYSPM_DEEPSLEEP,
+    .skipMode = ~(CY_SYSPM_BEFORE_TRANSITION | CY_SYSPM_AFTER_TRANSITION),
+    .callbackParams = &wake_resume_cback_params,
+    .prevItm = NULL,
+    .nextItm = NULL,
+    .order = WAKE_RESUME_CALLBACK_ORDER
+};
+
+/*******************************************************************************
+* Function Name: wake_resume_deepsleep_callback
+********************************************************************************
+* Summary:
+*  DeepSleep callback. Reads the cycle counter as the last callback before
+*  the entry and records the cycles up to the first callback after the exit.
+*
+* Parameters:
+*  callbackParams - callback parameters (unused)
+*  mode           - callback mode
+*
+* Return:
+*  cy_en_syspm_status_t - CY_SYSPM_SUCCESS
+*
+*******************************************************************************/
+WAKE_PATH_FUNC_BEGIN
+static cy_en_syspm_status_t wake_resume_deepsleep_callback(
+                                cy_stc_syspm_callback_params_t *callbackParams,
+                                cy_en_syspm_callback_mode_t mode)
+{
+    uint32_t now = perf_counter_get();
+    uint32_t us;
+
+    CY_UNUSED_PARAMETER(callbackParams);
+
+    if (CY_SYSPM_BEFORE_TRANSITION == mode)
+    {
+        wake_resume_entry_cycles = now;
+    }
+    else
+    {
+        us = perf_counter_cycles_to_us(now - wake_resume_entry_cycles);
+        wake_resume_stats.resumes++;
+        wake_resume_stats.last_us = us;
+        wake_resume_stats.total_us += us;
+        if (us > wake_resume_stats.max_us)
+        {
+            wake_resume_stats.max_us = us;
+        }
+    }
+
+    return CY_SYSPM_SUCCESS;
+}
+WAKE_PATH_FUNC_END
+
+/*******************************************************************************
+* Function Name: wake_resume_init
+********************************************************************************
+* Summary:
+*  Clears the statistics and registers the DeepSleep callback.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void wake_resume_init(void)
+{
+    wake_resume_stats.in_ram = (0 != APP_RAM_WAKE_PATH);
+    Cy_SysPm_RegisterCallback(&wake_resume_ds_cback);
+}
+
+/*******************************************************************************
+* Function Name: wake_resume_get_stats
+********************************************************************************
+* Summary:
+*  Returns a copy of the statistics.
+*
+* Parameters:
+*  stats - destination
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void wake_resume_get_stats(wake_resume_stats_t *stats)
+{
+    uint32_t irq = Cy_SysLib_EnterCriticalSection();
+
+    *stats = wake_resume_stats;
+    Cy_SysLib_ExitCriticalSection(irq);
+}
+
+/* [] END OF FILE */
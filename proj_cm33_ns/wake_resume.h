@@ -0,0 +1,76 @@
+/*****************************************************************************
+* File Name        : wake_resume.h
+*
+* Description      : This file contains the interface of the DeepSleep resume
+*                    timer. It measures the CPU cycles from the last DeepSleep
+*                    callback before the entry to the first one after the
+*                    wake-up.
+*
+* Related Document : See README.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+
+#ifndef WAKE_RESUME_H
+#define WAKE_RESUME_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+/* Resume statistics. The cycle counter stops in DeepSleep, so a resume is the
+ * tail of the DeepSleep entry plus the way back to the first instruction of
+ * the application: the secure wake-up handlers and, unless the wake path is
+ * in RAM, the wait for the external flash. */
+typedef struct
+{
+    bool in_ram;                /* built with APP_RAM_WAKE_PATH */
+    uint32_t resumes;           /* DeepSleep exits measured */
+    uint32_t last_us;
+    uint32_t max_us;
+    uint32_t total_us;
+} wake_resume_stats_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+/* Registers the DeepSleep callback. Call once at start-up. Its order is
+ * above that of every other DeepSleep callback with BEFORE_TRANSITION or
+ * AFTER_TRANSITION, so that it runs last before the entry and first after
+ * the exit. */
+void wake_resume_init(void);
+
+/* Returns a copy of the statistics */
+void wake_resume_get_stats(wake_resume_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* WAKE_RESUME_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,165 @@
+/*****************************************************************************
+* File Name        : cm55_wake.c
+*
+* Description      : This source file implements the CM55 wake-up source
+*                    check. It reads and clears the CM55 wake-up sources of
+*                    the POWER_MANAGER partition with one secure call per
+*                    wake-up event; the NS side cache of power_manager_api.c
+*                    answers the checks of other CPU wake-ups.
+*
+* Related Document : See README.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+
+#include "cy_pdl.h"
+
+#include "cm55_wake.h"
+
+#if (APP_CM55_POWER_MANAGER != 0)
+#include "tfm_ns_interface.h"
+#include "os_wrapper/common.h"
+#include "power_manager_api.h"
+#endif
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+static cm55_wake_stats_t cm55_wake_stats;
+
+#if (APP_CM55_POWER_MANAGER != 0)
+/* Wake-up event sequence number of the last check */
+static uint32_t cm55_wake_seq;
+static bool cm55_wake_seq_valid = false;
+#endif
+
+/*******************************************************************************
+* Function Name: cm55_wake_init
+********************************************************************************
+* Summary:
+*  Initializes the TF-M NS interface of CM55 when built with
+*  APP_CM55_POWER_MANAGER. On CM55, the interface forwards the secure calls
+*  to the SPE on CM33 through the NS mailbox.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  bool - false if the interface cannot be initialized
+*
+*******************************************************************************/
+bool cm55_wake_init(void)
+{
+#if (APP_CM55_POWER_MANAGER != 0)
+    if (OS_WRAPPER_SUCCESS != tfm_ns_interface_init())
+    {
+        return false;
+    }
+    cm55_wake_stats.enabled = true;
+#endif
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: cm55_wake_check
+********************************************************************************
+* Summary:
+*  Takes the CM55 wake-up sources from the partition: one secure call reads
+*  and clears them, so no event is lost between the read and the clear.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t - WAKEUP_SOURCE_x bits set since the last check, 0 if none
+*
+*******************************************************************************/
+uint32_t cm55_wake_check(void)
+{
+#if (APP_CM55_POWER_MANAGER != 0)
+    power_manager_wakeup_info_t info;
+
+    if (!cm55_wake_stats.enabled)
+    {
+        return 0U;
+    }
+
+    cm55_wake_stats.checks++;
+    if (PSA_SUCCESS != power_manager_take_wakeup_info(&info))
+    {
+        cm55_wake_stats.failed++;
+        return 0U;
+    }
+
+    if (cm55_wake_seq_valid)
+    {
+        cm55_wake_stats.events += info.event_seq - cm55_wake_seq;
+    }
+    cm55_wake_seq = info.event_seq;
+    cm55_wake_seq_valid = true;
+
+    if (0U != (info.sources & WAKEUP_SOURCE_TIMER))
+    {
+        cm55_wake_stats.timer_wakes++;
+    }
+    cm55_wake_stats.sources |= info.sources;
+
+    return info.sources;
+#else
+    return 0U;
+#endif
+}
+
+/*******************************************************************************
+* Function Name: cm55_wake_get_stats
+********************************************************************************
+* Summary:
+*  Returns a copy of the statistics. The secure calls are the checks the NS
+*  side cache did not answer.
+*
+* Parameters:
+*  stats - destination
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cm55_wake_get_stats(cm55_wake_stats_t *stats)
+{
+#if (APP_CM55_POWER_MANAGER != 0)
+    power_manager_cache_stats_t cache;
+#endif
+    uint32_t irq = Cy_SysLib_EnterCriticalSection();
+
+    *stats = cm55_wake_stats;
+    Cy_SysLib_ExitCriticalSection(irq);
+
+#if (APP_CM55_POWER_MANAGER != 0)
+    power_manager_get_cache_stats(&cache);
+    stats->secure_calls = stats->checks - cache.hits;
+#endif
+}
+
+/* [] END OF FILE */
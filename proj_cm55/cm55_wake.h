@@ -0,0 +1,92 @@
+/*****************************************************************************
+* File Name        : cm55_wake.h
+*
+* Description      : This file contains the interface of the CM55 wake-up
+*                    source check. CM55 asks the POWER_MANAGER partition why
+*                    the system woke up through its own TF-M NS interface,
+*                    which sends secure calls over the NS mailbox, without
+*                    the CM33 non-secure application.
+*
+* Related Document : See README.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+
+#ifndef CM55_WAKE_H
+#define CM55_WAKE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* 1 lets CM55 call the POWER_MANAGER partition. Set APP_CM55_POWER_MANAGER
+ * in common.mk. */
+#if !defined(APP_CM55_POWER_MANAGER)
+#define APP_CM55_POWER_MANAGER          (0)
+#endif
+
+/*******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+/* Wake-up check statistics */
+typedef struct
+{
+    bool enabled;               /* built with APP_CM55_POWER_MANAGER */
+    uint32_t checks;            /* calls of cm55_wake_check() */
+    uint32_t secure_calls;      /* checks that needed a secure call */
+    uint32_t events;            /* wake-up events counted by the partition */
+    uint32_t timer_wakes;       /* checks that found WAKEUP_SOURCE_TIMER */
+    uint32_t failed;            /* failed secure calls */
+    uint32_t sources;           /* WAKEUP_SOURCE_x bits found, ORed */
+} cm55_wake_stats_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+/* Initializes the TF-M NS interface of CM55 when built with
+ * APP_CM55_POWER_MANAGER. Returns false if it fails. Call once at start-up,
+ * before the scheduler starts. */
+bool cm55_wake_init(void);
+
+/* Returns the wake-up sources set since the last check and clears them for
+ * CM55; the sources of the CM33 non-secure application are not changed.
+ * Without a wake-up event of the partition since the last check, it returns 0
+ * from the NS side cache without a secure call, so it can be called after
+ * every CPU wake-up. */
+uint32_t cm55_wake_check(void);
+
+/* Returns a copy of the statistics */
+void cm55_wake_get_stats(cm55_wake_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CM55_WAKE_H */
+
+/* [] END OF FILE */
@@ -46,6 +46,11 @@
 #include "cyabs_rtos.h"
 #include "cyabs_rtos_impl.h"
 
+#include "cm55_boot_status.h"
+#include "cm55_wake.h"
+#include "socmem_retention.h"
+#include "wake_path.h"
+
 /*******************************************************************************
  * Macros
  ******************************************************************************/
@@ -101,7 +106,9 @@ static void handle_app_error(void)
  *******************************************************************************
  * Summary:
  * This is the FreeRTOS task callback function.
- * It Put the CM55 CPU to Deep Sleep
+ * It Put the CM55 CPU to Deep Sleep. After every wake-up it checks the
+ * wake-up sources of the system without waking the CM33 non-secure
+ * application.
  *
  * Parameters:
  *  void * arg
@@ -110,6 +117,7 @@ static void handle_app_error(void)
  *  void
  *
  ******************************************************************************/
+WAKE_PATH_FUNC_BEGIN
 static void cm55_task(void * arg)
 {
     CY_UNUSED_PARAMETER(arg);
@@ -118,8 +126,13 @@ static void cm55_task(void * arg)
     for (;;)
     {
         Cy_SysPm_CpuEnterDeepSleep(CY_SYSPM_WAIT_FOR_INTERRUPT);
+
+        /* The application handles the WAKEUP_SOURCE_x bits returned here;
+         * they are 0 if the wake-up was no POWER_MANAGER event */
+        (void)cm55_wake_check();
     }
 }
+WAKE_PATH_FUNC_END
 
 /*******************************************************************************
 * Function Name: setup_clib_support
@@ -157,10 +170,12 @@ static void setup_clib_support(void)
 *  void
 *
 *******************************************************************************/
+WAKE_PATH_FUNC_BEGIN
 static void lptimer_interrupt_handler(void)
 {
     mtb_hal_lptimer_process_interrupt(&lptimer_obj);
 }
+WAKE_PATH_FUNC_END
 
 /*******************************************************************************
 * Function Name: setup_tickless_idle_timer
@@ -242,10 +257,15 @@ static void setup_tickless_idle_timer(void)
  * Summary:
  * This is the main function for CM55 non-secure application.
  *    1. It initializes the device and board peripherals.
- *    2. It sets up the CLIB support library for CM55 CPU.
- *    3. It sets up the LPTimer instance for CM55 CPU.
- *    4. It creates the FreeRTOS application task 'cm55_task'
- *    5. It starts the RTOS task scheduler.
+ *    2. It registers its RAM sections with the SOCMEM retention manager,
+ *       which switches off the retention of unused partitions before every
+ *       DeepSleep entry.
+ *    3. It sets up the CLIB support library for CM55 CPU.
+ *    4. It sets up the LPTimer instance for CM55 CPU.
+ *    5. It initializes the TF-M NS interface of CM55.
+ *    6. It creates the FreeRTOS application task 'cm55_task'
+ *    7. It reports ready to the CM33 non-secure application.
+ *    8. It starts the RTOS task scheduler.
  *
  * Parameters:
  *  void
@@ -257,6 +277,13 @@ static void setup_tickless_idle_timer(void)
 int main(void)
 {
     cy_rslt_t result;
+    uint32_t main_entry_cycles;
+
+    /* Start the cycle counter to measure the time to ready */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0U;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    main_entry_cycles = DWT->CYCCNT;
 
     /* Initialize the device and board peripherals */
     result = cybsp_init();
@@ -267,6 +294,9 @@ int main(void)
         handle_app_error();
     }
 
+    /* Power down the unused SOCMEM partitions in DeepSleep */
+    socmem_retention_init();
+
     /* Setup CLIB support library. */
     setup_clib_support();
 
@@ -276,6 +306,12 @@ int main(void)
     /* Enable global interrupts */
     __enable_irq();
 
+    /* Initialize the TF-M NS interface to the POWER_MANAGER partition */
+    if (!cm55_wake_init())
+    {
+        handle_app_error();
+    }
+
     /* Create the FreeRTOS Task */
     result = xTaskCreate(cm55_task, "CM55 Task",
                         CM55_TASK_STACK_SIZE, NULL,
@@ -283,6 +319,13 @@ int main(void)
 
     if( pdPASS == result )
     {
+        /* Report ready to CM33, which measures the cold start latency */
+        CM55_BOOT_STATUS.main_to_ready_cycles = DWT->CYCCNT - main_entry_cycles;
+        CM55_BOOT_STATUS.boot_count++;
+        CM55_BOOT_STATUS.ready = CM55_BOOT_STATUS_READY;
+        SCB_CleanDCache_by_Addr((void *)CM55_BOOT_STATUS_ADDR,
+                                sizeof(cm55_boot_status_t));
+
         /* Start the RTOS Scheduler */
         vTaskStartScheduler();
     }
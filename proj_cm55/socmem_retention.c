@@ -0,0 +1,290 @@
+/*****************************************************************************
+* File Name        : socmem_retention.c
+*
+* Description      : This source file implements the SOCMEM retention
+*                    manager of CM55. The RAM sections of the image are
+*                    mapped to the SOCMEM partitions through the retention
+*                    map; a DeepSleep callback switches off the retention of
+*                    the partitions that nothing maps to.
+*
+* Related Document : See README.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+
+#include <stdbool.h>
+
+#include "cy_pdl.h"
+
+#include "retention_map.h"
+#include "socmem_retention.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* RAM sections of the image: the vector table, .data and .bss, the heap with
+ * the RTOS objects and task stacks and the main stack. The defaults are the
+ * symbols of the GCC linker script of the BSP; sections in the TCM map to no
+ * partition. Define SOCMEM_RETENTION_SECTIONS for other toolchains, or when
+ * the image copies code into m55_code_secondary. */
+#if !defined(SOCMEM_RETENTION_SECTIONS)
+extern uint32_t __ram_vectors_start__[];
+extern uint32_t __ram_vectors_end__[];
+extern uint32_t __data_start__[];
+extern uint32_t __bss_end__[];
+extern uint32_t __HeapBase[];
+extern uint32_t __HeapLimit[];
+extern uint32_t __StackLimit[];
+extern uint32_t __StackTop[];
+
+#define SOCMEM_RETENTION_SECTIONS \
+    { "vectors", __ram_vectors_start__, __ram_vectors_end__ }, \
+    { "data",    __data_start__,        __bss_end__         }, \
+    { "heap",    __HeapBase,            __HeapLimit         }, \
+    { "stack",   __StackLimit,          __StackTop          }
+#endif
+
+/*******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+typedef struct
+{
+    const char *name;
+    const void *start;
+    const void *end;
+} socmem_section_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+static cy_en_syspm_status_t socmem_retention_deepsleep_callback(
+                                cy_stc_syspm_callback_params_t *callbackParams,
+                                cy_en_syspm_callback_mode_t mode);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+static const socmem_section_t socmem_sections[] = { SOCMEM_RETENTION_SECTIONS };
+
+static retention_extent_t socmem_extents[SOCMEM_RETENTION_MAX_EXTENTS];
+static uint32_t socmem_extent_count = 0U;
+
+static socmem_retention_stats_t socmem_stats;
+
+/* Partitions whose retention the callback switched off. The first entry
+ * after a cold start sets every partition, as a CM55 reset without PD1
+ * keeps the setting of the previous image. */
+static uint32_t socmem_off_now = 0U;
+static bool socmem_applied = false;
+
+static cy_stc_syspm_callback_params_t socmem_cback_params =
+{
+    .base = NULL,
+    .context = NULL
+};
+
+static cy_stc_syspm_callback_t socmem_ds_cback =
+{
+    .callback = socmem_retention_deepsleep_callback,
+    .type = CY_SYSPM_DEEPSLEEP,
+    .skipMode = ~(CY_SYSPM_BEFORE_TRANSITION),
+    .callbackParams = &socmem_cback_params,
+    .prevItm = NULL,
+    .nextItm = NULL,
+    .order = SOCMEM_RETENTION_CALLBACK_ORDER
+};
+
+/*******************************************************************************
+* Function Name: socmem_retention_update
+********************************************************************************
+* Summary:
+*  Recomputes the partitions to retain from the registered extents.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void socmem_retention_update(void)
+{
+    const retention_memory_t *socmem = &retention_map_socmem;
+
+    socmem_stats.keep_mask = retention_map_keep_mask(socmem, socmem_extents,
+                                                     socmem_extent_count);
+    socmem_stats.off_mask = retention_map_all_macros(socmem) & ~socmem_stats.keep_mask;
+    socmem_stats.off_kb = retention_map_kb(socmem, socmem_stats.off_mask);
+    socmem_stats.retained_kb = retention_map_kb(socmem, socmem_stats.keep_mask);
+}
+
+/*******************************************************************************
+* Function Name: socmem_retention_deepsleep_callback
+********************************************************************************
+* Summary:
+*  DeepSleep callback. Before the entry, sets the DeepSleep power mode of
+*  the partitions whose retention changed since the last entry, of all at
+*  the first entry: off for those without live data, retained for the
+*  others.
+*
+* Parameters:
+*  callbackParams - callback parameters (unused)
+*  mode           - callback mode
+*
+* Return:
+*  cy_en_syspm_status_t - CY_SYSPM_SUCCESS
+*
+*******************************************************************************/
+static cy_en_syspm_status_t socmem_retention_deepsleep_callback(
+                                cy_stc_syspm_callback_params_t *callbackParams,
+                                cy_en_syspm_callback_mode_t mode)
+{
+    uint32_t changed;
+    uint32_t partition;
+
+    CY_UNUSED_PARAMETER(callbackParams);
+
+    if (CY_SYSPM_BEFORE_TRANSITION == mode)
+    {
+        changed = socmem_applied ? (socmem_off_now ^ socmem_stats.off_mask) :
+                                   retention_map_all_macros(&retention_map_socmem);
+        for (partition = 0U; 0U != (changed >> partition); partition++)
+        {
+            if (0U != (changed & (1UL << partition)))
+            {
+                (void)Cy_SysPm_SetSOCMEMPartDsPwrMode(partition,
+                    (0U != (socmem_stats.off_mask & (1UL << partition))) ?
+                        CY_SYSPM_SOCMEM_PWR_MODE_OFF : CY_SYSPM_SOCMEM_PWR_MODE_RET);
+            }
+        }
+        if (0U != changed)
+        {
+            socmem_off_now = socmem_stats.off_mask;
+            socmem_applied = true;
+            socmem_stats.updates++;
+        }
+    }
+
+    return CY_SYSPM_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: socmem_retention_init
+********************************************************************************
+* Summary:
+*  Registers the RAM sections of the image and the DeepSleep callback.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void socmem_retention_init(void)
+{
+    uint32_t i;
+
+    socmem_retention_update();
+    for (i = 0U; i < (sizeof(socmem_sections) / sizeof(socmem_sections[0])); i++)
+    {
+        (void)socmem_retention_add(socmem_sections[i].name, socmem_sections[i].start,
+                                   (uint32_t)((const uint8_t *)socmem_sections[i].end -
+                                              (const uint8_t *)socmem_sections[i].start));
+    }
+
+    Cy_SysPm_RegisterCallback(&socmem_ds_cback);
+}
+
+/*******************************************************************************
+* Function Name: socmem_retention_add
+********************************************************************************
+* Summary:
+*  Registers a range with live data. A range outside of SOCMEM, e.g. in the
+*  TCM, needs no retention and is ignored.
+*
+* Parameters:
+*  name  - name used in reports
+*  start - start address
+*  size  - size in bytes
+*
+* Return:
+*  cy_rslt_t - CY_RSLT_SUCCESS or SOCMEM_RETENTION_RSLT_ERR_FULL
+*
+*******************************************************************************/
+cy_rslt_t socmem_retention_add(const char *name, const void *start, uint32_t size)
+{
+    const retention_memory_t *socmem = &retention_map_socmem;
+    uintptr_t addr = (uintptr_t)start;
+    uint32_t irq;
+
+    if ((addr < SOCMEM_RETENTION_SOCMEM_BASE) ||
+        ((addr - SOCMEM_RETENTION_SOCMEM_BASE) >=
+         ((uintptr_t)socmem->macro_size * socmem->macro_count)))
+    {
+        return CY_RSLT_SUCCESS;
+    }
+
+    irq = Cy_SysLib_EnterCriticalSection();
+    if (socmem_extent_count >= SOCMEM_RETENTION_MAX_EXTENTS)
+    {
+        Cy_SysLib_ExitCriticalSection(irq);
+        return SOCMEM_RETENTION_RSLT_ERR_FULL;
+    }
+    socmem_extents[socmem_extent_count].name = name;
+    socmem_extents[socmem_extent_count].offset =
+        (uint32_t)(addr - SOCMEM_RETENTION_SOCMEM_BASE);
+    socmem_extents[socmem_extent_count].size = size;
+    socmem_extent_count++;
+    socmem_retention_update();
+    Cy_SysLib_ExitCriticalSection(irq);
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: socmem_retention_get_stats
+********************************************************************************
+* Summary:
+*  Copies the retention state.
+*
+* Parameters:
+*  stats - destination
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void socmem_retention_get_stats(socmem_retention_stats_t *stats)
+{
+    uint32_t irq = Cy_SysLib_EnterCriticalSection();
+
+    *stats = socmem_stats;
+    Cy_SysLib_ExitCriticalSection(irq);
+}
+
+/* [] END OF FILE */
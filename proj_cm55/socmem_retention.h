@@ -0,0 +1,98 @@
+/*****************************************************************************
+* File Name        : socmem_retention.h
+*
+* Description      : This file contains the interface of the SOCMEM
+*                    retention manager of CM55. Before every CM55 DeepSleep
+*                    entry, it switches off the DeepSleep retention of the
+*                    SOCMEM partitions that hold no live data of either
+*                    image.
+*
+* Related Document : See README.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+
+#ifndef SOCMEM_RETENTION_H
+#define SOCMEM_RETENTION_H
+
+#include <stdint.h>
+
+#include "cy_result.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Ranges with live data, the sections of the image included */
+#define SOCMEM_RETENTION_MAX_EXTENTS    (8U)
+
+/* No free extent left */
+#define SOCMEM_RETENTION_RSLT_ERR_FULL  \
+    (CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_MIDDLEWARE_BASE, 0x21U))
+
+/* Address of SOCMEM in the memory map of this image */
+#if !defined(SOCMEM_RETENTION_SOCMEM_BASE)
+#define SOCMEM_RETENTION_SOCMEM_BASE    (0x26000000UL)
+#endif
+
+/* Order of the DeepSleep callback, the only one of CM55 */
+#define SOCMEM_RETENTION_CALLBACK_ORDER (255U)
+
+/*******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+/* Retention state */
+typedef struct
+{
+    uint32_t keep_mask;         /* partitions retained in DeepSleep */
+    uint32_t off_mask;          /* partitions without retention from the
+                                 * next DeepSleep entry on */
+    uint32_t off_kb;            /* size of off_mask */
+    uint32_t retained_kb;       /* size of keep_mask */
+    uint32_t updates;           /* DeepSleep entries that changed the
+                                 * retention of a partition */
+} socmem_retention_stats_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+/* Registers the RAM sections of the image and the DeepSleep callback. Call
+ * once at every cold start of CM55, after cybsp_init(). */
+void socmem_retention_init(void);
+
+/* Registers a range with live data that the sections of the image do not
+ * cover. Its partitions are retained from the next DeepSleep entry on. */
+cy_rslt_t socmem_retention_add(const char *name, const void *start, uint32_t size);
+
+/* Copies the retention state */
+void socmem_retention_get_stats(socmem_retention_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SOCMEM_RETENTION_H */
+
+/* [] END OF FILE */
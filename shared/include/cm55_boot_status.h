@@ -0,0 +1,87 @@
+/*****************************************************************************
+* File Name        : cm55_boot_status.h
+*
+* Description      : This file contains the boot status record that the CM55
+*                    application shares with the CM33 non-secure application
+*                    to signal that it is ready after a cold start
+*
+* Related Document : See README.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+#ifndef CM55_BOOT_STATUS_H
+#define CM55_BOOT_STATUS_H
+
+#include <stdint.h>
+#include "cybsp.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Value written to cm55_boot_status_t.ready once CM55 is ready for work */
+#define CM55_BOOT_STATUS_READY      (0x52454459UL)
+
+/* Value written to cm55_boot_status_t.ready by CM33 before CM55 is booted */
+#define CM55_BOOT_STATUS_NOT_READY  (0x00000000UL)
+
+/* The record is at the start of the m33_m55_boot_status region of
+ * design.modus. It is in SRAM, which stays powered and retained when PD1 and
+ * SOCMEM are off, and no section of either linker script is placed in it, so
+ * both images find it at the address of the region. */
+#if defined(CYMEM_CM33_0_m33_m55_boot_status_START)
+#define CM55_BOOT_STATUS_ADDR       ((uintptr_t)CYMEM_CM33_0_m33_m55_boot_status_START)
+#elif defined(CYMEM_CM55_0_m33_m55_boot_status_START)
+#define CM55_BOOT_STATUS_ADDR       ((uintptr_t)CYMEM_CM55_0_m33_m55_boot_status_START)
+#else
+#error "design.modus must define the m33_m55_boot_status memory region"
+#endif
+
+/* Boot status record of both images */
+#define CM55_BOOT_STATUS            (*(cm55_boot_status_t *)CM55_BOOT_STATUS_ADDR)
+
+/*******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+/* Boot status record at CM55_BOOT_STATUS_ADDR */
+typedef struct
+{
+    /* CM55_BOOT_STATUS_READY once CM55 reached its scheduler */
+    volatile uint32_t ready;
+
+    /* Number of CM55 cold starts since power-on */
+    volatile uint32_t boot_count;
+
+    /* CM55 cycles spent from main() entry to ready. Cache and TCM init
+     * happen before main() and are covered by the CM33 side measurement. */
+    volatile uint32_t main_to_ready_cycles;
+} cm55_boot_status_t;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CM55_BOOT_STATUS_H */
+
+/* [] END OF FILE */
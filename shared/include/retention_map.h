@@ -0,0 +1,141 @@
+/*****************************************************************************
+* File Name        : retention_map.h
+*
+* Description      : This file contains the retention map of the on-chip
+*                    RAMs. It maps the memory regions of design.modus to the
+*                    SRAM macros and SOCMEM partitions whose DeepSleep
+*                    retention can be switched off, and computes the
+*                    retention current from measured figures. It is
+*                    hardware independent and used
+*                    by the CM33 non-secure and CM55 applications and by the
+*                    host retention report.
+*
+* Related Document : See README.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+#ifndef RETENTION_MAP_H
+#define RETENTION_MAP_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Macros per memory, one bit each in a retention mask */
+#define RETENTION_MAP_MAX_MACROS        (32U)
+
+/* DeepSleep retention current per KB of SRAM and of SOCMEM in nA. The
+ * datasheet gives no per-macro figure, so they are 0, not characterized,
+ * and only the retained size is reported. Measure the DeepSleep current of
+ * the board with the spare macros retained and powered down, divide the
+ * difference by their size and define the figures in common.mk. */
+#if !defined(RETENTION_MAP_SRAM_NA_PER_KB)
+#define RETENTION_MAP_SRAM_NA_PER_KB    (0U)
+#endif
+
+#if !defined(RETENTION_MAP_SOCMEM_NA_PER_KB)
+#define RETENTION_MAP_SOCMEM_NA_PER_KB  (0U)
+#endif
+
+/*******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+/* Memory region of design.modus */
+typedef struct
+{
+    const char *name;
+    uint32_t offset;            /* from the start of the memory */
+    uint32_t size;
+    /* Retained as a whole, e.g. because it belongs to another image. A region
+     * without it is retained only where the image registered an extent. */
+    bool keep;
+} retention_region_t;
+
+/* Memory whose retention is switched per macro or partition */
+typedef struct
+{
+    const char *name;
+    uint32_t macro_size;        /* bytes per macro */
+    uint32_t macro_count;       /* up to RETENTION_MAP_MAX_MACROS */
+    uint32_t leakage_na_per_kb; /* DeepSleep retention current, 0 if not
+                                 * characterized */
+    const retention_region_t *regions;
+    uint32_t region_count;
+} retention_memory_t;
+
+/* Range of a memory that holds live data of an image */
+typedef struct
+{
+    const char *name;
+    uint32_t offset;            /* from the start of the memory */
+    uint32_t size;
+} retention_extent_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/* SRAM0 and SRAM1 and SOCMEM as laid out by design.modus */
+extern const retention_memory_t retention_map_sram;
+extern const retention_memory_t retention_map_socmem;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+/* Returns the mask of the macros a range touches. The part of the range
+ * beyond the end of the memory is ignored. */
+uint32_t retention_map_range_macros(const retention_memory_t *memory,
+                                    uint32_t offset, uint32_t size);
+
+/* Returns the mask of all macros of a memory */
+uint32_t retention_map_all_macros(const retention_memory_t *memory);
+
+/* Returns the mask of the macros that must keep their contents in DeepSleep:
+ * those touched by a region marked keep or by one of the extents */
+uint32_t retention_map_keep_mask(const retention_memory_t *memory,
+                                 const retention_extent_t *extents,
+                                 uint32_t extent_count);
+
+/* Returns the number of macros in a mask */
+uint32_t retention_map_count(uint32_t mask);
+
+/* Returns the size of the macros in a mask in KB */
+uint32_t retention_map_kb(const retention_memory_t *memory, uint32_t mask);
+
+/* Returns the DeepSleep retention current of the macros in a mask, 0 if the
+ * memory is not characterized */
+uint32_t retention_map_leakage_na(const retention_memory_t *memory,
+                                  uint32_t mask);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RETENTION_MAP_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,70 @@
+/*****************************************************************************
+* File Name        : wake_path.h
+*
+* Description      : This file contains the build option that places the
+*                    DeepSleep wake path of the CM33 non-secure and CM55
+*                    applications in on-chip RAM. Both images execute from
+*                    external flash; after a DeepSleep exit, every instruction
+*                    fetched through the serial memory interface (SMIF) waits
+*                    until the SMIF and the flash have resumed. Functions
+*                    marked with WAKE_PATH_FUNC_BEGIN and WAKE_PATH_FUNC_END
+*                    run without that wait.
+*
+* Related Document : See README.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+#ifndef WAKE_PATH_H
+#define WAKE_PATH_H
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* 1 places the wake path in RAM: the .cy_ramfunc section of the CM33
+ * non-secure image, which the startup code copies to SRAM, and the ITCM of
+ * the CM55. The SRAM retention keeps the m33_code region with it. Set
+ * APP_RAM_WAKE_PATH in common.mk. Experimental: only the functions of this
+ * project move; the PDL and FreeRTOS functions they call stay in the
+ * external flash. */
+#if !defined(APP_RAM_WAKE_PATH)
+#define APP_RAM_WAKE_PATH           (0)
+#endif
+
+/* Enclose the definition of a function of the wake path. Its data needs no
+ * marking: .data and .bss are in SRAM or DTCM already. Without the option
+ * the header needs no PDL, so that sources shared with the host tools can
+ * use it. */
+#if (APP_RAM_WAKE_PATH != 0)
+#include "cy_pdl.h"
+#if defined(COMPONENT_CM55)
+#define WAKE_PATH_FUNC_BEGIN        CY_SECTION_ITCM_BEGIN
+#define WAKE_PATH_FUNC_END          CY_SECTION_ITCM_END
+#else
+#define WAKE_PATH_FUNC_BEGIN        CY_SECTION_RAMFUNC_BEGIN
+#define WAKE_PATH_FUNC_END          CY_SECTION_RAMFUNC_END
+#endif
+#else
+#define WAKE_PATH_FUNC_BEGIN
+#define WAKE_PATH_FUNC_END
+#endif
+
+#endif /* WAKE_PATH_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,268 @@
+/*****************************************************************************
+* File Name        : retention_map.c
+*
+* Description      : This source file implements the retention map of the
+*                    on-chip RAMs shared by the CM33 non-secure and CM55
+*                    applications and the host retention report
+*
+* Related Document : See README.md
+*
+*******************************************************************************
+# \copyright
+# (c) 2024-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+
+#include <stddef.h>
+#include "retention_map.h"
+#include "wake_path.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+#define ARRAY_COUNT(a)                  (sizeof(a) / sizeof((a)[0]))
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/* SRAM regions of design.modus. The secure image, the boot code and the
+ * shared regions are retained as a whole; the CM33 non-secure code and data
+ * regions only where the image has sections. With APP_RAM_WAKE_PATH, the
+ * code region is retained as a whole as well: the linker script of the BSP
+ * may place .cy_ramfunc there rather than in .data, and the image registers
+ * no section for it. */
+static const retention_region_t sram_regions[] =
+{
+    { "extended_boot_sram_reserved", 0x00000000UL, 0x00001000UL, true  },
+    { "m33s_shared",                 0x00001000UL, 0x00001000UL, true  },
+    { "m33s_code",                   0x00002000UL, 0x00035000UL, true  },
+    { "m33s_data",                   0x00037000UL, 0x00021000UL, true  },
+    { "m33_code",                    0x00058000UL, 0x00065000UL, (APP_RAM_WAKE_PATH != 0) },
+    { "m33_data",                    0x000BD000UL, 0x0003E000UL, false },
+    { "m33_m55_pm_gen",              0x000FB000UL, 0x00001000UL, true  },
+    { "m33_m55_boot_status",         0x000FC000UL, 0x00001000UL, true  },
+    { "m33s_allocatable_shared",     0x000FD000UL, 0x00001000UL, true  },
+    { "m33_allocatable_shared",      0x000FE000UL, 0x00001000UL, true  },
+    { "m55_allocatable_shared",      0x000FF000UL, 0x00001000UL, true  }
+};
+
+/* SOCMEM regions of design.modus. The CM55 code and data regions are
+ * retained only where the CM55 image has sections. The application has no
+ * graphics, so nothing lives in gfx_mem. */
+static const retention_region_t socmem_regions[] =
+{
+    { "m55_code_secondary",          0x00000000UL, 0x00040000UL, false },
+    { "m55_data_secondary",          0x00040000UL, 0x002BC000UL, false },
+    { "m33_m55_shared",              0x002FC000UL, 0x00040000UL, true  },
+    { "gfx_mem",                     0x0033C000UL, 0x001C4000UL, false }
+};
+
+/* SRAM0 and SRAM1, 512 KB each in 64 KB macros */
+const retention_memory_t retention_map_sram =
+{
+    .name = "SRAM",
+    .macro_size = 0x00010000UL,
+    .macro_count = 16U,
+    .leakage_na_per_kb = RETENTION_MAP_SRAM_NA_PER_KB,
+    .regions = sram_regions,
+    .region_count = ARRAY_COUNT(sram_regions)
+};
+
+/* SOCMEM, 5 MB in 512 KB partitions */
+const retention_memory_t retention_map_socmem =
+{
+    .name = "SOCMEM",
+    .macro_size = 0x00080000UL,
+    .macro_count = 10U,
+    .leakage_na_per_kb = RETENTION_MAP_SOCMEM_NA_PER_KB,
+    .regions = socmem_regions,
+    .region_count = ARRAY_COUNT(socmem_regions)
+};
+
+/*******************************************************************************
+* Function Name: retention_map_range_macros
+********************************************************************************
+* Summary:
+*  Returns the mask of the macros a range touches.
+*
+* Parameters:
+*  memory - memory the range is in
+*  offset - start of the range, from the start of the memory
+*  size   - size of the range in bytes
+*
+* Return:
+*  uint32_t - macro mask
+*
+*******************************************************************************/
+uint32_t retention_map_range_macros(const retention_memory_t *memory,
+                                    uint32_t offset, uint32_t size)
+{
+    uint32_t end = memory->macro_size * memory->macro_count;
+    uint32_t first;
+    uint32_t last;
+    uint32_t mask = 0U;
+
+    if ((0U == size) || (offset >= end))
+    {
+        return 0U;
+    }
+    if (size > (end - offset))
+    {
+        size = end - offset;
+    }
+
+    first = offset / memory->macro_size;
+    last = (offset + size - 1U) / memory->macro_size;
+    for (; first <= last; first++)
+    {
+        mask |= (1UL << first);
+    }
+
+    return mask;
+}
+
+/*******************************************************************************
+* Function Name: retention_map_all_macros
+********************************************************************************
+* Summary:
+*  Returns the mask of all macros of a memory.
+*
+* Parameters:
+*  memory - memory
+*
+* Return:
+*  uint32_t - macro mask
+*
+*******************************************************************************/
+uint32_t retention_map_all_macros(const retention_memory_t *memory)
+{
+    return (memory->macro_count >= RETENTION_MAP_MAX_MACROS) ?
+           0xFFFFFFFFUL : ((1UL << memory->macro_count) - 1U);
+}
+
+/*******************************************************************************
+* Function Name: retention_map_keep_mask
+********************************************************************************
+* Summary:
+*  Returns the mask of the macros that must keep their contents in
+*  DeepSleep. A macro that no region marked keep and no extent touches holds
+*  no live data, e.g. the part of the code region of an image that runs
+*  from external flash.
+*
+* Parameters:
+*  memory       - memory
+*  extents      - ranges with live data of the image
+*  extent_count - number of extents
+*
+* Return:
+*  uint32_t - macro mask
+*
+*******************************************************************************/
+uint32_t retention_map_keep_mask(const retention_memory_t *memory,
+                                 const retention_extent_t *extents,
+                                 uint32_t extent_count)
+{
+    uint32_t mask = 0U;
+    uint32_t i;
+
+    for (i = 0U; i < memory->region_count; i++)
+    {
+        if (memory->regions[i].keep)
+        {
+            mask |= retention_map_range_macros(memory, memory->regions[i].offset,
+                                               memory->regions[i].size);
+        }
+    }
+    for (i = 0U; i < extent_count; i++)
+    {
+        mask |= retention_map_range_macros(memory, extents[i].offset,
+                                           extents[i].size);
+    }
+
+    return mask;
+}
+
+/*******************************************************************************
+* Function Name: retention_map_count
+********************************************************************************
+* Summary:
+*  Returns the number of macros in a mask.
+*
+* Parameters:
+*  mask - macro mask
+*
+* Return:
+*  uint32_t - number of macros
+*
+*******************************************************************************/
+uint32_t retention_map_count(uint32_t mask)
+{
+    uint32_t count = 0U;
+
+    for (; 0U != mask; mask &= (mask - 1U))
+    {
+        count++;
+    }
+
+    return count;
+}
+
+/*******************************************************************************
+* Function Name: retention_map_kb
+********************************************************************************
+* Summary:
+*  Returns the size of the macros in a mask.
+*
+* Parameters:
+*  memory - memory
+*  mask   - macro mask
+*
+* Return:
+*  uint32_t - size in KB
+*
+*******************************************************************************/
+uint32_t retention_map_kb(const retention_memory_t *memory, uint32_t mask)
+{
+    return retention_map_count(mask & retention_map_all_macros(memory)) *
+           (memory->macro_size / 1024U);
+}
+
+/*******************************************************************************
+* Function Name: retention_map_leakage_na
+********************************************************************************
+* Summary:
+*  Returns the DeepSleep retention current of the macros in a mask.
+*
+* Parameters:
+*  memory - memory
+*  mask   - macro mask
+*
+* Return:
+*  uint32_t - current in nA, 0 if the memory is not characterized
+*
+*******************************************************************************/
+uint32_t retention_map_leakage_na(const retention_memory_t *memory,
+                                  uint32_t mask)
+{
+    return retention_map_kb(memory, mask) * memory->leakage_na_per_kb;
+}
+
+/* [] END OF FILE */
@@ -11,6 +11,157 @@
 #include "power_manager_api.h"
 #include "power_manager_defs.h"
 
+/* Hooks called around every secure call */
+static power_manager_call_enter_t call_enter_hook = NULL;
+static power_manager_call_exit_t call_exit_hook = NULL;
+
+/* NS side cache of the partition state. An entry is valid for the state
+ * generation it was read in. */
+typedef struct
+{
+    uint32_t gen;
+    bool src_valid;
+    bool seq_valid;
+    bool rate_limit_valid;
+    power_manager_wakeup_info_t wakeup_info;
+    uint32_t rate_limit_src;
+    power_manager_rate_limit_t rate_limit;
+} power_manager_cache_t;
+
+static power_manager_cache_t cache;
+static bool cache_enabled = true;
+static power_manager_cache_stats_t cache_stats;
+
+/* Reads the generation word. On a core with a data cache, the line is
+ * invalidated first, as the SPM writes the word from CM33. */
+static uint32_t power_manager_read_gen(void)
+{
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    SCB_InvalidateDCache_by_Addr((void *)(POWER_MANAGER_GEN_ADDR), sizeof(uint32_t));
+#endif
+    return POWER_MANAGER_GEN;
+}
+
+/* Reads the state generation. Returns false if the cache is not used. */
+static bool power_manager_cache_gen(uint32_t *gen)
+{
+    *gen = power_manager_read_gen();
+    return cache_enabled;
+}
+
+/* Locks the cache and drops its entries if the state has changed since they
+ * were read. Returns false, with the cache unlocked, if it is not used. */
+static bool power_manager_cache_lock(uint32_t *gen, uint32_t *intr_state)
+{
+    if (!power_manager_cache_gen(gen))
+    {
+        return false;
+    }
+
+    *intr_state = Cy_SysLib_EnterCriticalSection();
+    if (cache.gen != *gen)
+    {
+        cache.gen = *gen;
+        cache.src_valid = false;
+        cache.seq_valid = false;
+        cache.rate_limit_valid = false;
+    }
+
+    return true;
+}
+
+/* Counts a hit or a miss and unlocks the cache */
+static void power_manager_cache_unlock(uint32_t intr_state, bool hit)
+{
+    if (hit)
+    {
+        cache_stats.hits++;
+    }
+    else
+    {
+        cache_stats.misses++;
+    }
+    Cy_SysLib_ExitCriticalSection(intr_state);
+}
+
+/* Locks the cache for an update after a secure call made in the generation
+ * gen. Returns false, with the cache unlocked, if the state has changed
+ * during the call. */
+static bool power_manager_cache_update(uint32_t gen, uint32_t *intr_state)
+{
+    uint32_t now;
+
+    if (!power_manager_cache_lock(&now, intr_state))
+    {
+        return false;
+    }
+
+    if (now != gen)
+    {
+        Cy_SysLib_ExitCriticalSection(*intr_state);
+        return false;
+    }
+
+    return true;
+}
+
+static psa_status_t power_manager_call(int32_t type,
+                                       const psa_invec *in_vec, size_t in_len,
+                                       psa_outvec *out_vec, size_t out_len)
+{
+    power_manager_call_enter_t enter_fn = call_enter_hook;
+    power_manager_call_exit_t exit_fn = call_exit_hook;
+    uint32_t cookie = 0U;
+    psa_status_t status;
+
+    if ((enter_fn != NULL) && (exit_fn != NULL))
+    {
+        cookie = enter_fn();
+    }
+
+    status = psa_call(POWER_MANAGER_SERVICE_HANDLE, type,
+                      in_vec, in_len, out_vec, out_len);
+
+    if ((enter_fn != NULL) && (exit_fn != NULL))
+    {
+        exit_fn(cookie);
+    }
+
+    return status;
+}
+
+void power_manager_set_cache_enabled(bool enable)
+{
+    uint32_t intr_state = Cy_SysLib_EnterCriticalSection();
+
+    cache_enabled = enable;
+    cache.src_valid = false;
+    cache.seq_valid = false;
+    cache.rate_limit_valid = false;
+    Cy_SysLib_ExitCriticalSection(intr_state);
+}
+
+void power_manager_get_cache_stats(power_manager_cache_stats_t *stats)
+{
+    uint32_t intr_state = Cy_SysLib_EnterCriticalSection();
+
+    *stats = cache_stats;
+    Cy_SysLib_ExitCriticalSection(intr_state);
+}
+
+bool power_manager_get_state_gen(uint32_t *gen)
+{
+    *gen = power_manager_read_gen();
+    return true;
+}
+
+void power_manager_set_call_hooks(power_manager_call_enter_t enter_fn,
+                                  power_manager_call_exit_t exit_fn)
+{
+    call_enter_hook = enter_fn;
+    call_exit_hook = exit_fn;
+}
+
 psa_status_t power_manager_clr_wakeup_src(void)
 {
     psa_invec in_vec[] = {
@@ -21,10 +172,33 @@ psa_status_t power_manager_clr_wakeup_src(void)
         { .base = NULL, .len = 0 }
     };
 
-    return psa_call(POWER_MANAGER_SERVICE_HANDLE,
-                    POWER_MANAGER_CLR_WAKEUP_SOURCE,
-                    in_vec, IOVEC_LEN(in_vec),
-                    out_vec, IOVEC_LEN(out_vec));
+    psa_status_t status;
+    uint32_t intr_state;
+    uint32_t gen;
+
+    if (power_manager_cache_lock(&gen, &intr_state))
+    {
+        if (cache.src_valid && (cache.wakeup_info.sources == 0U))
+        {
+            /* Nothing to clear */
+            power_manager_cache_unlock(intr_state, true);
+            return PSA_SUCCESS;
+        }
+        power_manager_cache_unlock(intr_state, false);
+    }
+
+    status = power_manager_call(POWER_MANAGER_CLR_WAKEUP_SOURCE,
+                                in_vec, IOVEC_LEN(in_vec),
+                                out_vec, IOVEC_LEN(out_vec));
+
+    if ((status == PSA_SUCCESS) && power_manager_cache_update(gen, &intr_state))
+    {
+        cache.wakeup_info.sources = 0U;
+        cache.src_valid = true;
+        Cy_SysLib_ExitCriticalSection(intr_state);
+    }
+
+    return status;
 }
 
 psa_status_t power_manager_get_wakeup_src(uint32_t *wakeup_src)
@@ -37,8 +211,314 @@ psa_status_t power_manager_get_wakeup_src(uint32_t *wakeup_src)
         { .base = wakeup_src, .len = sizeof(*wakeup_src) }
     };
 
-    return psa_call(POWER_MANAGER_SERVICE_HANDLE,
-                    POWER_MANAGER_GET_WAKEUP_SOURCE,
-                    in_vec, IOVEC_LEN(in_vec),
-                    out_vec, IOVEC_LEN(out_vec));
-}
\ No newline at end of file
+    psa_status_t status;
+    uint32_t intr_state;
+    uint32_t gen;
+
+    if (power_manager_cache_lock(&gen, &intr_state))
+    {
+        if (cache.src_valid)
+        {
+            *wakeup_src = cache.wakeup_info.sources;
+            power_manager_cache_unlock(intr_state, true);
+            return PSA_SUCCESS;
+        }
+        power_manager_cache_unlock(intr_state, false);
+    }
+
+    status = power_manager_call(POWER_MANAGER_GET_WAKEUP_SOURCE,
+                                in_vec, IOVEC_LEN(in_vec),
+                                out_vec, IOVEC_LEN(out_vec));
+
+    if ((status == PSA_SUCCESS) && power_manager_cache_update(gen, &intr_state))
+    {
+        cache.wakeup_info.sources = *wakeup_src;
+        cache.src_valid = true;
+        Cy_SysLib_ExitCriticalSection(intr_state);
+    }
+
+    return status;
+}
+
+psa_status_t power_manager_get_wakeup_info(power_manager_wakeup_info_t *info)
+{
+    psa_invec in_vec[] = {
+        { .base = NULL, .len = 0 }
+    };
+
+    psa_outvec out_vec[] = {
+        { .base = info, .len = sizeof(*info) }
+    };
+
+    psa_status_t status;
+    uint32_t intr_state;
+    uint32_t gen;
+
+    if (power_manager_cache_lock(&gen, &intr_state))
+    {
+        if (cache.src_valid && cache.seq_valid)
+        {
+            *info = cache.wakeup_info;
+            power_manager_cache_unlock(intr_state, true);
+            return PSA_SUCCESS;
+        }
+        power_manager_cache_unlock(intr_state, false);
+    }
+
+    status = power_manager_call(POWER_MANAGER_GET_WAKEUP_INFO,
+                                in_vec, IOVEC_LEN(in_vec),
+                                out_vec, IOVEC_LEN(out_vec));
+
+    if ((status == PSA_SUCCESS) && power_manager_cache_update(gen, &intr_state))
+    {
+        cache.wakeup_info = *info;
+        cache.src_valid = true;
+        cache.seq_valid = true;
+        Cy_SysLib_ExitCriticalSection(intr_state);
+    }
+
+    return status;
+}
+
+psa_status_t power_manager_take_wakeup_info(power_manager_wakeup_info_t *info)
+{
+    psa_invec in_vec[] = {
+        { .base = NULL, .len = 0 }
+    };
+
+    psa_outvec out_vec[] = {
+        { .base = info, .len = sizeof(*info) }
+    };
+
+    psa_status_t status;
+    uint32_t intr_state;
+    uint32_t gen;
+
+    if (power_manager_cache_lock(&gen, &intr_state))
+    {
+        if (cache.src_valid && cache.seq_valid && (cache.wakeup_info.sources == 0U))
+        {
+            /* No event since the last take, nothing to clear */
+            *info = cache.wakeup_info;
+            power_manager_cache_unlock(intr_state, true);
+            return PSA_SUCCESS;
+        }
+        power_manager_cache_unlock(intr_state, false);
+    }
+
+    status = power_manager_call(POWER_MANAGER_TAKE_WAKEUP_INFO,
+                                in_vec, IOVEC_LEN(in_vec),
+                                out_vec, IOVEC_LEN(out_vec));
+
+    if ((status == PSA_SUCCESS) && power_manager_cache_update(gen, &intr_state))
+    {
+        cache.wakeup_info.sources = 0U;
+        cache.wakeup_info.event_seq = info->event_seq;
+        cache.src_valid = true;
+        cache.seq_valid = true;
+        Cy_SysLib_ExitCriticalSection(intr_state);
+    }
+
+    return status;
+}
+
+psa_status_t power_manager_get_rate_limit(uint32_t wakeup_src,
+                                          power_manager_rate_limit_t *rate_limit)
+{
+    psa_invec in_vec[] = {
+        { .base = &wakeup_src, .len = sizeof(wakeup_src) }
+    };
+
+    psa_outvec out_vec[] = {
+        { .base = rate_limit, .len = sizeof(*rate_limit) }
+    };
+
+    psa_status_t status;
+    uint32_t intr_state;
+    uint32_t gen;
+
+    if (power_manager_cache_lock(&gen, &intr_state))
+    {
+        if (cache.rate_limit_valid && (cache.rate_limit_src == wakeup_src))
+        {
+            *rate_limit = cache.rate_limit;
+            power_manager_cache_unlock(intr_state, true);
+            return PSA_SUCCESS;
+        }
+        power_manager_cache_unlock(intr_state, false);
+    }
+
+    status = power_manager_call(POWER_MANAGER_GET_RATE_LIMIT,
+                                in_vec, IOVEC_LEN(in_vec),
+                                out_vec, IOVEC_LEN(out_vec));
+
+    if ((status == PSA_SUCCESS) && power_manager_cache_update(gen, &intr_state))
+    {
+        cache.rate_limit_src = wakeup_src;
+        cache.rate_limit = *rate_limit;
+        cache.rate_limit_valid = true;
+        Cy_SysLib_ExitCriticalSection(intr_state);
+    }
+
+    return status;
+}
+
+psa_status_t power_manager_wake_at(uint32_t at_s, uint32_t *timer_id)
+{
+    psa_invec in_vec[] = {
+        { .base = &at_s, .len = sizeof(at_s) }
+    };
+
+    psa_outvec out_vec[] = {
+        { .base = timer_id, .len = sizeof(*timer_id) }
+    };
+
+    return power_manager_call(POWER_MANAGER_WAKE_AT,
+                              in_vec, IOVEC_LEN(in_vec),
+                              out_vec, IOVEC_LEN(out_vec));
+}
+
+psa_status_t power_manager_wake_after(uint32_t delay_s, uint32_t *timer_id)
+{
+    psa_invec in_vec[] = {
+        { .base = &delay_s, .len = sizeof(delay_s) }
+    };
+
+    psa_outvec out_vec[] = {
+        { .base = timer_id, .len = sizeof(*timer_id) }
+    };
+
+    return power_manager_call(POWER_MANAGER_WAKE_AFTER,
+                              in_vec, IOVEC_LEN(in_vec),
+                              out_vec, IOVEC_LEN(out_vec));
+}
+
+psa_status_t power_manager_wake_cancel(uint32_t timer_id)
+{
+    psa_invec in_vec[] = {
+        { .base = &timer_id, .len = sizeof(timer_id) }
+    };
+
+    psa_outvec out_vec[] = {
+        { .base = NULL, .len = 0 }
+    };
+
+    return power_manager_call(POWER_MANAGER_WAKE_CANCEL,
+                              in_vec, IOVEC_LEN(in_vec),
+                              out_vec, IOVEC_LEN(out_vec));
+}
+
+psa_status_t power_manager_batch(const power_manager_cmd_t *cmds,
+                                 power_manager_result_t *results,
+                                 uint32_t count)
+{
+    psa_invec in_vec[] = {
+        { .base = cmds, .len = count * sizeof(*cmds) }
+    };
+
+    psa_outvec out_vec[] = {
+        { .base = results, .len = count * sizeof(*results) }
+    };
+
+    psa_status_t status;
+    bool clears = false;
+    uint32_t intr_state;
+    uint32_t gen;
+    uint32_t i;
+
+    status = power_manager_call(POWER_MANAGER_BATCH,
+                                in_vec, IOVEC_LEN(in_vec),
+                                out_vec, IOVEC_LEN(out_vec));
+
+    /* A clear in the batch changes the cached wake-up source */
+    for (i = 0U; i < count; i++)
+    {
+        if ((cmds[i].op == POWER_MANAGER_CLR_WAKEUP_SOURCE) ||
+            (cmds[i].op == POWER_MANAGER_TAKE_WAKEUP_INFO))
+        {
+            clears = true;
+        }
+    }
+    if (clears && power_manager_cache_lock(&gen, &intr_state))
+    {
+        cache.src_valid = false;
+        Cy_SysLib_ExitCriticalSection(intr_state);
+    }
+
+    return status;
+}
+
+psa_status_t power_manager_record_deepsleep(uint32_t deepsleep_ms)
+{
+    psa_invec in_vec[] = {
+        { .base = &deepsleep_ms, .len = sizeof(deepsleep_ms) }
+    };
+
+    psa_outvec out_vec[] = {
+        { .base = NULL, .len = 0 }
+    };
+
+    return power_manager_call(POWER_MANAGER_RECORD_DEEPSLEEP,
+                              in_vec, IOVEC_LEN(in_vec),
+                              out_vec, IOVEC_LEN(out_vec));
+}
+
+psa_status_t power_manager_record_latency(uint32_t latency_us)
+{
+    psa_invec in_vec[] = {
+        { .base = &latency_us, .len = sizeof(latency_us) }
+    };
+
+    psa_outvec out_vec[] = {
+        { .base = NULL, .len = 0 }
+    };
+
+    return power_manager_call(POWER_MANAGER_RECORD_LATENCY,
+                              in_vec, IOVEC_LEN(in_vec),
+                              out_vec, IOVEC_LEN(out_vec));
+}
+
+psa_status_t power_manager_flush_telemetry(uint32_t flags)
+{
+    psa_invec in_vec[] = {
+        { .base = &flags, .len = sizeof(flags) }
+    };
+
+    psa_outvec out_vec[] = {
+        { .base = NULL, .len = 0 }
+    };
+
+    return power_manager_call(POWER_MANAGER_FLUSH_TELEMETRY,
+                              in_vec, IOVEC_LEN(in_vec),
+                              out_vec, IOVEC_LEN(out_vec));
+}
+
+psa_status_t power_manager_get_log_tx(power_manager_log_tx_t *log_tx)
+{
+    psa_invec in_vec[] = {
+        { .base = NULL, .len = 0 }
+    };
+
+    psa_outvec out_vec[] = {
+        { .base = log_tx, .len = sizeof(*log_tx) }
+    };
+
+    return power_manager_call(POWER_MANAGER_GET_LOG_TX,
+                              in_vec, IOVEC_LEN(in_vec),
+                              out_vec, IOVEC_LEN(out_vec));
+}
+
+psa_status_t power_manager_get_telemetry(power_manager_telemetry_t *telemetry)
+{
+    psa_invec in_vec[] = {
+        { .base = NULL, .len = 0 }
+    };
+
+    psa_outvec out_vec[] = {
+        { .base = telemetry, .len = sizeof(*telemetry) }
+    };
+
+    return power_manager_call(POWER_MANAGER_GET_TELEMETRY,
+                              in_vec, IOVEC_LEN(in_vec),
+                              out_vec, IOVEC_LEN(out_vec));
+}
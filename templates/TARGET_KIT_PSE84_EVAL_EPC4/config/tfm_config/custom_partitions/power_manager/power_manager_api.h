@@ -8,15 +8,70 @@
 #if !defined(POWER_MANAGER_API_H)
 #define POWER_MANAGER_API_H
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
 #include "psa/error.h"
+#include "power_manager_defs.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/* Hooks called before and after every secure call of the API, e.g. to
+ * profile the time NS interrupts are masked in the SPE. The value returned by
+ * the enter hook is passed to the exit hook. */
+typedef uint32_t (*power_manager_call_enter_t)(void);
+typedef void (*power_manager_call_exit_t)(uint32_t cookie);
+
+/**
+ * @brief Sets the hooks called around every secure call of the API.
+ *
+ * @param[in] enter_fn  Called before the secure call, NULL for none.
+ * @param[in] exit_fn   Called after the secure call, NULL for none.
+ */
+void power_manager_set_call_hooks(power_manager_call_enter_t enter_fn,
+                                  power_manager_call_exit_t exit_fn);
+
+/* Reads of the NS side cache of the partition state. A hit is a read or a
+ * clear of the wake-up source answered without a secure call. */
+typedef struct
+{
+    uint32_t hits;
+    uint32_t misses;
+} power_manager_cache_stats_t;
+
+/**
+ * @brief Enables or disables the NS side cache of the partition state.
+ *
+ * The cache is enabled by default. It relies on the state generation that
+ * the SPM publishes at POWER_MANAGER_GEN_ADDR.
+ *
+ * @param[in] enable    true to answer reads of unchanged state from the cache.
+ */
+void power_manager_set_cache_enabled(bool enable);
+
+/**
+ * @brief Returns the hit and miss counts of the NS side cache.
+ *
+ * @param[out] stats    Cache statistics.
+ */
+void power_manager_get_cache_stats(power_manager_cache_stats_t *stats);
+
+/**
+ * @brief Reads the partition state generation published by the SPM.
+ *
+ * The generation changes after every partition interrupt, so a change shows
+ * a wake-up event without a secure call.
+ *
+ * @param[out] gen      State generation.
+ *
+ * @return true, the SPM always publishes the generation
+ *         (POWER_MANAGER_GEN_ADDR).
+ */
+bool power_manager_get_state_gen(uint32_t *gen);
+
 /**
  * @brief Calls the POWER_MANAGER to clear the wake-up source.
  *
@@ -35,6 +90,176 @@ psa_status_t power_manager_clr_wakeup_src(void);
  */
 psa_status_t power_manager_get_wakeup_src(uint32_t *wakeup_src);
 
+/**
+ * @brief Calls the POWER_MANAGER to get the wake-up source and the wake-up
+ *        event sequence number in one call.
+ *
+ * @param[out] info  Pointer to a power_manager_wakeup_info_t where the result
+ *                   will be stored.
+ *
+ * @retval PSA_SUCCESS                  The operation completed successfully.
+ * @retval other PSA error codes are indicating failure.
+ */
+psa_status_t power_manager_get_wakeup_info(power_manager_wakeup_info_t *info);
+
+/**
+ * @brief Calls the POWER_MANAGER to get the wake-up source and the wake-up
+ *        event sequence number and to clear the wake-up source, in one call.
+ *        No wake-up event can be lost between the read and the clear.
+ *
+ * The sources of the info are those set since the last clear by this NS
+ * client; the other core keeps its own. With the NS side cache, the call is
+ * answered without a secure call while no wake-up event has happened since
+ * the last take, so it can be called after every CPU wake-up.
+ *
+ * @param[out] info  Pointer to a power_manager_wakeup_info_t where the result
+ *                   will be stored.
+ *
+ * @retval PSA_SUCCESS                  The operation completed successfully.
+ * @retval other PSA error codes are indicating failure.
+ */
+psa_status_t power_manager_take_wakeup_info(power_manager_wakeup_info_t *info);
+
+/**
+ * @brief Calls the POWER_MANAGER to get the rate limiting state of a wake-up
+ *        source.
+ *
+ * @param[in]  wakeup_src  Wake-up source, one of the WAKEUP_SOURCE_* bits.
+ * @param[out] rate_limit  Pointer to a power_manager_rate_limit_t where the
+ *                         result will be stored.
+ *
+ * @retval PSA_SUCCESS                  The operation completed successfully.
+ * @retval PSA_ERROR_INVALID_ARGUMENT   Unknown wake-up source.
+ * @retval other PSA error codes are indicating failure.
+ */
+psa_status_t power_manager_get_rate_limit(uint32_t wakeup_src,
+                                          power_manager_rate_limit_t *rate_limit);
+
+/**
+ * @brief Calls the POWER_MANAGER to wake the device at an RTC time. The
+ *        wake-up sets WAKEUP_SOURCE_TIMER; it can wake the device from
+ *        DeepSleep. The resolution is one second.
+ *
+ * @param[in]  at_s      RTC time in seconds since 2000-01-01 00:00:00. A time
+ *                       in the past wakes the device within one second.
+ * @param[out] timer_id  Pointer to a uint32_t where the ID of the timed
+ *                       wake-up will be stored.
+ *
+ * @retval PSA_SUCCESS                    The operation completed successfully.
+ * @retval PSA_ERROR_INSUFFICIENT_MEMORY  Too many timed wake-ups are pending.
+ * @retval other PSA error codes are indicating failure.
+ */
+psa_status_t power_manager_wake_at(uint32_t at_s, uint32_t *timer_id);
+
+/**
+ * @brief Calls the POWER_MANAGER to wake the device after a delay. See
+ *        power_manager_wake_at().
+ *
+ * @param[in]  delay_s   Delay in seconds from now.
+ * @param[out] timer_id  Pointer to a uint32_t where the ID of the timed
+ *                       wake-up will be stored.
+ *
+ * @retval PSA_SUCCESS                    The operation completed successfully.
+ * @retval PSA_ERROR_INSUFFICIENT_MEMORY  Too many timed wake-ups are pending.
+ * @retval other PSA error codes are indicating failure.
+ */
+psa_status_t power_manager_wake_after(uint32_t delay_s, uint32_t *timer_id);
+
+/**
+ * @brief Calls the POWER_MANAGER to cancel a pending timed wake-up.
+ *
+ * @param[in] timer_id  ID of the timed wake-up.
+ *
+ * @retval PSA_SUCCESS                  The operation completed successfully.
+ * @retval PSA_ERROR_DOES_NOT_EXIST     The wake-up is not pending, it has
+ *                                      expired or was cancelled.
+ * @retval other PSA error codes are indicating failure.
+ */
+psa_status_t power_manager_wake_cancel(uint32_t timer_id);
+
+/**
+ * @brief Calls the POWER_MANAGER to execute several operations with one
+ *        secure call. The commands are executed in order; a failed command
+ *        does not stop the batch.
+ *
+ * @param[in]  cmds     Array of commands, see power_manager_cmd_t.
+ * @param[out] results  Array of results, one per command.
+ * @param[in]  count    Number of commands, 1 to POWER_MANAGER_BATCH_MAX.
+ *
+ * @retval PSA_SUCCESS                  The batch was executed. The status of
+ *                                      each command is in its result.
+ * @retval PSA_ERROR_INVALID_ARGUMENT   Invalid number of commands.
+ * @retval other PSA error codes are indicating failure.
+ */
+psa_status_t power_manager_batch(const power_manager_cmd_t *cmds,
+                                 power_manager_result_t *results,
+                                 uint32_t count);
+
+/**
+ * @brief Calls the POWER_MANAGER to add DeepSleep residency to the lifetime
+ *        telemetry. The telemetry is written to ITS at most once per
+ *        write period of the partition.
+ *
+ * @param[in] deepsleep_ms  DeepSleep time since the last record, in ms.
+ *
+ * @retval PSA_SUCCESS  The operation completed successfully.
+ * @retval other PSA error codes are indicating failure.
+ */
+psa_status_t power_manager_record_deepsleep(uint32_t deepsleep_ms);
+
+/**
+ * @brief Calls the POWER_MANAGER to record a wake-up to task latency. The
+ *        telemetry keeps the longest one.
+ *
+ * @param[in] latency_us  Latency in microseconds.
+ *
+ * @retval PSA_SUCCESS  The operation completed successfully.
+ * @retval other PSA error codes are indicating failure.
+ */
+psa_status_t power_manager_record_latency(uint32_t latency_us);
+
+/**
+ * @brief Calls the POWER_MANAGER to write changed telemetry to ITS now,
+ *        for example when the battery is low or before a reset or a
+ *        Hibernate entry.
+ *
+ * @param[in] flags  POWER_MANAGER_FLUSH_POWER_LOSS if the partition loses
+ *                   its RAM next, else 0.
+ *
+ * @retval PSA_SUCCESS          The telemetry is written.
+ * @retval PSA_ERROR_BAD_STATE  The last flush was less than the minimum
+ *                              flush interval ago, and this is not the first
+ *                              flush before a power loss of this boot;
+ *                              nothing was written.
+ * @retval other PSA error codes are indicating failure.
+ */
+psa_status_t power_manager_flush_telemetry(uint32_t flags);
+
+/**
+ * @brief Calls the POWER_MANAGER to get the lifetime telemetry, including
+ *        the changes not yet written to ITS.
+ *
+ * @param[out] telemetry  Pointer to a power_manager_telemetry_t where the
+ *                        totals will be stored.
+ *
+ * @retval PSA_SUCCESS  The operation completed successfully.
+ * @retval other PSA error codes are indicating failure.
+ */
+psa_status_t power_manager_get_telemetry(power_manager_telemetry_t *telemetry);
+
+/**
+ * @brief Calls the POWER_MANAGER to get the transmit state of the UART of the
+ *        platform log service, so that the NS side can size its log writes
+ *        to the free TX FIFO space and tell when the last byte has been sent.
+ *
+ * @param[out] log_tx  Pointer to a power_manager_log_tx_t where the state
+ *                     will be stored.
+ *
+ * @retval PSA_SUCCESS  The operation completed successfully.
+ * @retval other PSA error codes are indicating failure.
+ */
+psa_status_t power_manager_get_log_tx(power_manager_log_tx_t *log_tx);
+
 #ifdef __cplusplus
 }
 #endif
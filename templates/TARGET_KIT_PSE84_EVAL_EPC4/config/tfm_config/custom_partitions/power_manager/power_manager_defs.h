@@ -17,10 +17,174 @@ extern "C" {
 
 /* Wake-up sources */
 #define WAKEUP_SOURCE_USER_BTN1  0x01
+#define WAKEUP_SOURCE_TIMER      0x02
+#define WAKEUP_SOURCE_USER_BTN2  0x04
 
 /* POWER_MANAGER Operation types */
 #define POWER_MANAGER_GET_WAKEUP_SOURCE   1001
 #define POWER_MANAGER_CLR_WAKEUP_SOURCE   1002
+#define POWER_MANAGER_GET_WAKEUP_INFO     1003
+#define POWER_MANAGER_GET_RATE_LIMIT      1004
+#define POWER_MANAGER_WAKE_AT             1005
+#define POWER_MANAGER_WAKE_AFTER          1006
+#define POWER_MANAGER_WAKE_CANCEL         1007
+#define POWER_MANAGER_BATCH               1008
+#define POWER_MANAGER_RECORD_DEEPSLEEP    1009
+#define POWER_MANAGER_RECORD_LATENCY      1010
+#define POWER_MANAGER_FLUSH_TELEMETRY     1011
+#define POWER_MANAGER_GET_TELEMETRY       1012
+#define POWER_MANAGER_TAKE_WAKEUP_INFO    1013
+#define POWER_MANAGER_GET_LOG_TX          1014
+
+/* Maximum number of commands in a POWER_MANAGER_BATCH call */
+#define POWER_MANAGER_BATCH_MAX           8
+
+/* NS clients of the POWER_MANAGER. The CM33 NS application calls through the
+ * TrustZone NS agent, the CM55 application through the NS mailbox, which
+ * gives its calls client IDs from POWER_MANAGER_CM55_CLIENT_ID_MIN to
+ * POWER_MANAGER_CM55_CLIENT_ID_MAX. There is no default: set both to the
+ * client ID range of the mailbox NS agent in the TF-M configuration. A
+ * partition built with POWER_MANAGER_CM55_CLIENT fails without them; one
+ * built without counts every call as a CM33 call. Every client has its own
+ * wake-up sources, so a clear by one core does not hide a wake-up event from
+ * the other. */
+#define POWER_MANAGER_CLIENT_CM33         0U
+#define POWER_MANAGER_CLIENT_CM55         1U
+#define POWER_MANAGER_CLIENTS             2U
+
+#if !defined(POWER_MANAGER_CM55_CLIENT)
+#define POWER_MANAGER_CM55_CLIENT         0
+#endif
+#if (POWER_MANAGER_CM55_CLIENT != 0) && \
+    (!defined(POWER_MANAGER_CM55_CLIENT_ID_MIN) || !defined(POWER_MANAGER_CM55_CLIENT_ID_MAX))
+#error "Set POWER_MANAGER_CM55_CLIENT_ID_MIN and POWER_MANAGER_CM55_CLIENT_ID_MAX to the client ID range of the TF-M NS mailbox agent"
+#endif
+
+/* Generation of the partition state. The state a client reads changes only
+ * in its own secure calls and in the partition interrupts, and the SPM
+ * increments the generation after every partition interrupt. It is published
+ * in the first word of the m33_m55_pm_gen region of design.modus, 4 KB of
+ * SRAM that hold nothing else, so that power_manager_api.c can answer reads
+ * of unchanged state without a secure call. The TF-M image and both NS
+ * images take the address from the memory configuration of design.modus;
+ * on CM55 the word shares no data cache line with other data. */
+#if !defined(POWER_MANAGER_GEN_ADDR)
+#if defined(CYMEM_CM33_0_m33_m55_pm_gen_START)
+#define POWER_MANAGER_GEN_ADDR            ((uintptr_t)CYMEM_CM33_0_m33_m55_pm_gen_START)
+#elif defined(CYMEM_CM55_0_m33_m55_pm_gen_START)
+#define POWER_MANAGER_GEN_ADDR            ((uintptr_t)CYMEM_CM55_0_m33_m55_pm_gen_START)
+#else
+#error "design.modus must define the m33_m55_pm_gen memory region"
+#endif
+#endif
+#define POWER_MANAGER_GEN                 (*(volatile uint32_t *)(POWER_MANAGER_GEN_ADDR))
+
+/* The TF-M image is stored in the external flash. Code that the TF-M linker
+ * script leaves in the flash waits for it after a DeepSleep exit, like the NS
+ * images. POWER_MANAGER_RAM_WAKE_PATH, set by the CMake option of the same
+ * name that proj_cm33_s takes from APP_RAM_WAKE_PATH, places the SPM handlers
+ * and the FLIHs of the partition, and the partition functions they call, in
+ * the .cy_ramfunc section, which is in SRAM whatever the linker script does
+ * with .text. The SPM dispatch and the PDL functions they call are not
+ * moved and still wait for the flash, so the option is experimental: it does
+ * not make the wake-up faster yet. */
+#if !defined(POWER_MANAGER_RAM_WAKE_PATH)
+#define POWER_MANAGER_RAM_WAKE_PATH       0
+#endif
+#if (POWER_MANAGER_RAM_WAKE_PATH != 0)
+#define POWER_MANAGER_WAKE_FUNC_BEGIN     CY_SECTION_RAMFUNC_BEGIN
+#define POWER_MANAGER_WAKE_FUNC_END       CY_SECTION_RAMFUNC_END
+#else
+#define POWER_MANAGER_WAKE_FUNC_BEGIN
+#define POWER_MANAGER_WAKE_FUNC_END
+#endif
+
+/* Wake-up sources and the number of wake-up events seen by the partition.
+ * The event sequence number is incremented by every wake-up interrupt and is
+ * never cleared, so the NS side can tell how many events happened between
+ * two reads. */
+typedef struct
+{
+    uint32_t sources;
+    uint32_t event_seq;
+} power_manager_wakeup_info_t;
+
+/* Rate limiting state of one wake-up source. A source that raises more
+ * interrupts than its budget allows is masked and re-enabled by a backoff
+ * timer, so a chattering or stuck input cannot keep the device awake. */
+typedef struct
+{
+    uint32_t throttled_events;  /* interrupts dropped for lack of budget */
+    uint32_t mask_count;        /* times the source was masked */
+    uint32_t masked;            /* 1 while the source is masked */
+    uint32_t backoff_s;         /* backoff of the next mask */
+} power_manager_rate_limit_t;
+
+/* Transmit state of the UART of the platform log service (IFX_TFM_SPM_UART).
+ * The service returns once a message is in the TX FIFO, so a message that
+ * fits into the free FIFO space leaves the SPE without waiting for the
+ * UART. */
+typedef struct
+{
+    uint32_t fifo_size;         /* TX FIFO entries */
+    uint32_t fifo_used;         /* entries not yet moved to the shifter */
+    uint32_t tx_done;           /* 1 once the last byte has left the UART */
+} power_manager_log_tx_t;
+
+/* Wake-up sources counted by the telemetry, one per WAKEUP_SOURCE_* bit */
+#define POWER_MANAGER_TELEMETRY_SOURCES   3
+
+/* Flag of POWER_MANAGER_FLUSH_TELEMETRY: the partition loses its RAM next,
+ * in a reset or a Hibernate entry. The first such flush of a boot is not
+ * subject to the minimum flush interval. */
+#define POWER_MANAGER_FLUSH_POWER_LOSS    (1U)
+
+/* Reset causes counted by the telemetry */
+#define POWER_MANAGER_RESET_POWER_ON      0   /* power-on or XRES, no cause */
+#define POWER_MANAGER_RESET_WATCHDOG      1   /* hardware or multi-counter WDT */
+#define POWER_MANAGER_RESET_FAULT         2   /* Active or DeepSleep fault */
+#define POWER_MANAGER_RESET_SOFTWARE      3   /* software reset */
+#define POWER_MANAGER_RESET_HIBERNATE     4   /* wake-up from Hibernate */
+#define POWER_MANAGER_RESET_OTHER         5
+#define POWER_MANAGER_RESET_CAUSES        6
+
+/* Lifetime power telemetry, kept by the partition in Internal Trusted
+ * Storage. The DeepSleep residency and the wake-up latency are measured and
+ * reported by the NS application. */
+typedef struct
+{
+    uint32_t boots;                 /* partition starts */
+    uint32_t reset_causes[POWER_MANAGER_RESET_CAUSES];
+    uint32_t wake_events[POWER_MANAGER_TELEMETRY_SOURCES];
+    uint32_t throttled_events;      /* interrupts dropped by rate limiting */
+    uint32_t deepsleep_s;           /* DeepSleep residency */
+    uint32_t worst_latency_us;      /* longest wake-up to task latency */
+    uint32_t its_writes;            /* writes to ITS, this one included */
+} power_manager_telemetry_t;
+
+/* Command of a POWER_MANAGER_BATCH call: one of the operation types above
+ * except POWER_MANAGER_BATCH and POWER_MANAGER_GET_TELEMETRY, and its input
+ * (wake-up source, time, delay, timer ID, DeepSleep time in ms, latency in us
+ * or flush flags) if the operation has one. */
+typedef struct
+{
+    uint32_t op;
+    uint32_t arg;
+} power_manager_cmd_t;
+
+/* Result of a command of a POWER_MANAGER_BATCH call. The data is valid if the
+ * status is PSA_SUCCESS. */
+typedef struct
+{
+    int32_t status;
+    union
+    {
+        uint32_t value;             /* wake-up source or timer ID */
+        power_manager_wakeup_info_t wakeup_info;
+        power_manager_rate_limit_t rate_limit;
+        power_manager_log_tx_t log_tx;
+    } data;
+} power_manager_result_t;
 
 #ifdef __cplusplus
 }
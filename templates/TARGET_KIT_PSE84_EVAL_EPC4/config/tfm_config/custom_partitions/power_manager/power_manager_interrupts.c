@@ -12,6 +12,10 @@
 #include "tfm_peripherals_def.h"
 #include "load/interrupt_defs.h"
 #include "static_checks.h"
+#include "power_manager_defs.h"
+#if defined(POWER_MANAGER_ISR_CYCLES)
+#include "tfm_spm_log.h"
+#endif
 
 
 /* Debounce delay */
@@ -20,31 +24,46 @@
 /* User BTN1 IRQ info */
 static struct irq_t user_btn1_irq_info = {0};
 
+/* RTC alarm IRQ info */
+static struct irq_t rtc_alarm_irq_info = {0};
+
+POWER_MANAGER_WAKE_FUNC_BEGIN
 void IFX_IRQ_NAME_TO_HANDLER(CYBSP_USER_BTN1_IRQ)(void)
 {
+#if defined(POWER_MANAGER_ISR_CYCLES)
+    uint32_t start;
+    uint32_t pins;
+#endif
+
     /* Delay to handle de-bouncing  */
     Cy_SysLib_Delay(BTN_DEBOUNCE_DELAY_MS);
 
-    /* Clear CYBSP_USER_BTN1 interrupt source */
-    if(1UL == Cy_GPIO_GetInterruptStatus(CYBSP_USER_BTN1_PORT, CYBSP_USER_BTN1_PIN))
+    /* CYBSP_USER_BTN1 (SW2), CYBSP_USER_BTN2 (SW4) and the other pins of the
+     * port share the same NVIC IRQ line. The POWER_MANAGER partition reads
+     * the pending pins of the port, dispatches them to their wake-up sources
+     * and clears them. The masked status is checked as the partition masks a
+     * pin while it is rate limited. */
+    if(0UL != GPIO_PRT_INTR_MASKED(CYBSP_USER_BTN1_PORT))
     {
-        Cy_GPIO_ClearInterrupt(CYBSP_USER_BTN1_PORT, CYBSP_USER_BTN1_PIN);
-        NVIC_ClearPendingIRQ(CYBSP_USER_BTN1_IRQ);
-
+#if defined(POWER_MANAGER_ISR_CYCLES)
+        /* Cycles of the partition handler, without the debounce delay */
+        pins = GPIO_PRT_INTR_MASKED(CYBSP_USER_BTN1_PORT);
+        start = DWT->CYCCNT;
+#endif
         spm_handle_interrupt(user_btn1_irq_info.p_pt, user_btn1_irq_info.p_ildi);
+#if defined(POWER_MANAGER_ISR_CYCLES)
+        start = DWT->CYCCNT - start;
+        SPMLOG_INFMSGVAL("[POWER_MANAGER] pending pins: ", pins);
+        SPMLOG_INFMSGVAL("[POWER_MANAGER] handler cycles: ", start);
+#endif
+
+        /* Invalidate the NS side cache of the partition state */
+        POWER_MANAGER_GEN++;
     }
 
-    /* CYBSP_USER_BTN1 (SW2) and CYBSP_USER_BTN2 (SW4) share the same port in
-     * the PSOC™ Edge E84 evaluation kit and hence they share the same NVIC IRQ
-     * line. Since both the buttons are configured for falling edge interrupt in
-     * the BSP, pressing any button will trigger the execution of this ISR. Therefore,
-     * we must clear the interrupt flag of the user button (CYBSP_USER_BTN2) to avoid
-     * issues in case if user presses BTN2 by mistake */
-#if defined(CYBSP_USER_BTN2_ENABLED)
-    Cy_GPIO_ClearInterrupt(CYBSP_USER_BTN2_PORT, CYBSP_USER_BTN2_PIN);
-    NVIC_ClearPendingIRQ(CYBSP_USER_BTN2_IRQ);
-#endif
+    NVIC_ClearPendingIRQ(CYBSP_USER_BTN1_IRQ);
 }
+POWER_MANAGER_WAKE_FUNC_END
 
 enum tfm_hal_status_t cybsp_user_btn1_irq_init(void *p_pt, const struct irq_load_info_t *p_ildi)
 {
@@ -73,3 +92,37 @@ enum tfm_hal_status_t cybsp_user_btn1_irq_init(void *p_pt, const struct irq_load
 
     return TFM_HAL_SUCCESS;
 }
+
+POWER_MANAGER_WAKE_FUNC_BEGIN
+void IFX_IRQ_NAME_TO_HANDLER(srss_interrupt_backup_IRQn)(void)
+{
+    /* Only ALARM2 belongs to the POWER_MANAGER partition */
+    if(0UL != (Cy_RTC_GetInterruptStatusMasked() & CY_RTC_INTR_ALARM2))
+    {
+        Cy_RTC_ClearInterrupt(CY_RTC_INTR_ALARM2);
+        NVIC_ClearPendingIRQ(srss_interrupt_backup_IRQn);
+
+        spm_handle_interrupt(rtc_alarm_irq_info.p_pt, rtc_alarm_irq_info.p_ildi);
+
+        POWER_MANAGER_GEN++;
+    }
+}
+POWER_MANAGER_WAKE_FUNC_END
+
+enum tfm_hal_status_t srss_interrupt_backup_irqn_init(void *p_pt, const struct irq_load_info_t *p_ildi)
+{
+    rtc_alarm_irq_info.p_pt   = p_pt;
+    rtc_alarm_irq_info.p_ildi = p_ildi;
+
+    /* Ensure the line targets Secure state */
+    NVIC_ClearTargetState(srss_interrupt_backup_IRQn);
+
+    /* Configure priority within (0, N/2) */
+    NVIC_SetPriority(srss_interrupt_backup_IRQn, DEFAULT_IRQ_PRIORITY);
+
+    /* Make sure nothing is pending at boot */
+    Cy_RTC_ClearInterrupt(CY_RTC_INTR_ALARM2);
+    NVIC_ClearPendingIRQ(srss_interrupt_backup_IRQn);
+
+    return TFM_HAL_SUCCESS;
+}
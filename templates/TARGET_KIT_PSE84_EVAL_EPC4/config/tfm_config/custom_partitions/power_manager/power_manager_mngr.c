@@ -6,73 +6,825 @@
  *
  */
 #include "psa/service.h"
+#include "psa/internal_trusted_storage.h"
 #include "psa_manifest/power_manager.h"
 #include "power_manager_defs.h"
+#include "power_manager_timer.h"
 
 #include <stdio.h>
+#include <string.h>
 #include "tfm_hal_interrupt.h"
 
 
-/* Holds the bitfield value of wake-up sources */
-static uint32_t wakeup_src_flag = 0U;
+/* Wake-up source rate limiting. Every source has a token bucket of
+ * WAKEUP_RATE_BURST interrupts, refilled by one token every
+ * WAKEUP_RATE_REFILL_S seconds. An interrupt that finds the bucket empty is
+ * dropped and its pin is masked for the backoff time, which doubles on every
+ * mask up to WAKEUP_BACKOFF_MAX_S and starts again at WAKEUP_BACKOFF_MIN_S
+ * once the bucket has filled up again. */
+#if !defined(WAKEUP_RATE_BURST)
+#define WAKEUP_RATE_BURST       (8U)
+#endif
+#if !defined(WAKEUP_RATE_REFILL_S)
+#define WAKEUP_RATE_REFILL_S    (1U)
+#endif
+#if !defined(WAKEUP_BACKOFF_MIN_S)
+#define WAKEUP_BACKOFF_MIN_S    (1U)
+#endif
+#if !defined(WAKEUP_BACKOFF_MAX_S)
+#define WAKEUP_BACKOFF_MAX_S    (64U)
+#endif
 
+/* Timed wake-ups the NS application can have pending at the same time */
+#if !defined(POWER_MANAGER_WAKE_TIMERS_MAX)
+#define POWER_MANAGER_WAKE_TIMERS_MAX   (4U)
+#endif
 
+/* Telemetry writes to ITS. Changes are written at most once per
+ * TELEMETRY_WRITE_PERIOD_S to limit flash wear and write energy. The NS
+ * application can ask for an earlier write at low battery, at most once per
+ * TELEMETRY_FLUSH_MIN_S, and before a power loss, which is accepted once
+ * per boot regardless. */
+#if !defined(TELEMETRY_WRITE_PERIOD_S)
+#define TELEMETRY_WRITE_PERIOD_S        (4U * 3600U)
+#endif
+#if !defined(TELEMETRY_FLUSH_MIN_S)
+#define TELEMETRY_FLUSH_MIN_S           (60U)
+#endif
+
+#define TELEMETRY_UID                   ((psa_storage_uid_t)0x504D5401U)
+#define TELEMETRY_VERSION               (2U)
+
+
+/* Rate limiter of a wake-up source */
+typedef struct
+{
+    uint32_t src;
+    GPIO_PRT_Type *port;
+    uint32_t pin;
+    uint32_t tokens;
+    uint32_t refill_s;
+    uint32_t timer_id;
+    power_manager_rate_limit_t stats;
+} wakeup_limiter_t;
+
+/* Telemetry record in ITS */
+typedef struct
+{
+    uint32_t version;
+    uint32_t last_reset_cause;      /* POWER_MANAGER_RESET_* of the last boot */
+    power_manager_telemetry_t totals;
+} telemetry_record_t;
+
+
+/* Holds the bitfield value of wake-up sources of each NS client */
+static uint32_t wakeup_src_flags[POWER_MANAGER_CLIENTS];
+
+/* Number of wake-up interrupts since boot */
+static uint32_t wakeup_event_seq = 0U;
+
+/* Pending timed wake-ups of the NS application */
+static uint32_t wake_timers_pending = 0U;
+
+/* Lifetime telemetry, written to ITS when dirty */
+static power_manager_telemetry_t telemetry;
+static uint32_t telemetry_deepsleep_ms = 0U;
+static bool telemetry_dirty = false;
+static uint32_t telemetry_written_s = 0U;
+static uint32_t telemetry_flushed_s = 0U;
+static uint32_t telemetry_reset_cause_now = POWER_MANAGER_RESET_OTHER;
+static bool telemetry_power_loss_flushed = false;
+
+/* Wake-up pins. All of them are on the port of USER BTN1, which has one
+ * interrupt line for all its pins. */
+static wakeup_limiter_t wakeup_limiters[] =
+{
+    {
+        .src = WAKEUP_SOURCE_USER_BTN1,
+        .port = CYBSP_USER_BTN1_PORT,
+        .pin = CYBSP_USER_BTN1_PIN,
+        .tokens = WAKEUP_RATE_BURST,
+        .stats = { .backoff_s = WAKEUP_BACKOFF_MIN_S }
+    },
+#if defined(CYBSP_USER_BTN2_ENABLED)
+    {
+        .src = WAKEUP_SOURCE_USER_BTN2,
+        .port = CYBSP_USER_BTN2_PORT,
+        .pin = CYBSP_USER_BTN2_PIN,
+        .tokens = WAKEUP_RATE_BURST,
+        .stats = { .backoff_s = WAKEUP_BACKOFF_MIN_S }
+    },
+#endif
+};
+
+#define WAKEUP_LIMITER_COUNT    (sizeof(wakeup_limiters) / sizeof(wakeup_limiters[0]))
+
+/* Wake-up pin of every pin number of the port, NULL for other pins */
+static wakeup_limiter_t *wakeup_pins[CY_GPIO_PINS_MAX];
+
+
+static wakeup_limiter_t *wakeup_limiter_find(uint32_t src)
+{
+    uint32_t i;
+
+    for (i = 0U; i < WAKEUP_LIMITER_COUNT; i++)
+    {
+        if (wakeup_limiters[i].src == src)
+        {
+            return &wakeup_limiters[i];
+        }
+    }
+
+    return NULL;
+}
+
+/* Counts a wake-up event of the given sources */
+POWER_MANAGER_WAKE_FUNC_BEGIN
+static void telemetry_count_wake(uint32_t src)
+{
+    uint32_t i;
+
+    for (i = 0U; i < POWER_MANAGER_TELEMETRY_SOURCES; i++)
+    {
+        if ((src & (1UL << i)) != 0U)
+        {
+            telemetry.wake_events[i]++;
+        }
+    }
+    telemetry_dirty = true;
+}
+POWER_MANAGER_WAKE_FUNC_END
+
+static uint32_t telemetry_reset_cause(uint32_t reason)
+{
+    if (reason == 0U)
+    {
+        return POWER_MANAGER_RESET_POWER_ON;
+    }
+    if ((reason & (CY_SYSLIB_RESET_HWWDT | CY_SYSLIB_RESET_SWWDT0 |
+                   CY_SYSLIB_RESET_SWWDT1)) != 0U)
+    {
+        return POWER_MANAGER_RESET_WATCHDOG;
+    }
+    if ((reason & (CY_SYSLIB_RESET_ACT_FAULT | CY_SYSLIB_RESET_DPSLP_FAULT)) != 0U)
+    {
+        return POWER_MANAGER_RESET_FAULT;
+    }
+    if ((reason & CY_SYSLIB_RESET_SOFT) != 0U)
+    {
+        return POWER_MANAGER_RESET_SOFTWARE;
+    }
+    if ((reason & CY_SYSLIB_RESET_HIB_WAKEUP) != 0U)
+    {
+        return POWER_MANAGER_RESET_HIBERNATE;
+    }
+
+    return POWER_MANAGER_RESET_OTHER;
+}
+
+POWER_MANAGER_WAKE_FUNC_BEGIN
+static void wakeup_limiter_refill(wakeup_limiter_t *limiter, uint32_t now_s)
+{
+    uint32_t refills;
+
+    /* The RTC may be set backwards by the NS application */
+    if ((int32_t)(now_s - limiter->refill_s) < 0)
+    {
+        limiter->refill_s = now_s;
+    }
+
+    refills = (now_s - limiter->refill_s) / WAKEUP_RATE_REFILL_S;
+    if (refills >= (WAKEUP_RATE_BURST - limiter->tokens))
+    {
+        limiter->tokens = WAKEUP_RATE_BURST;
+        limiter->refill_s = now_s;
+    }
+    else
+    {
+        limiter->tokens += refills;
+        limiter->refill_s += refills * WAKEUP_RATE_REFILL_S;
+    }
+}
+POWER_MANAGER_WAKE_FUNC_END
+
+/* Re-enables a source whose backoff has elapsed. Interrupts latched while
+ * masked are discarded and the source starts with one token. */
+POWER_MANAGER_WAKE_FUNC_BEGIN
+static void wakeup_limiter_unmask(uint32_t arg)
+{
+    wakeup_limiter_t *limiter = &wakeup_limiters[arg];
+
+    Cy_GPIO_ClearInterrupt(limiter->port, limiter->pin);
+    Cy_GPIO_SetInterruptMask(limiter->port, limiter->pin, 1UL);
+    limiter->stats.masked = 0U;
+    limiter->timer_id = 0U;
+    limiter->tokens = 1U;
+    limiter->refill_s = power_manager_timer_now_s();
+}
+POWER_MANAGER_WAKE_FUNC_END
+
+/* Takes a token for an interrupt of the source at the RTC time now_s. Masks
+ * the source and returns false if there is none. */
+POWER_MANAGER_WAKE_FUNC_BEGIN
+static bool wakeup_limiter_take(wakeup_limiter_t *limiter, uint32_t now_s)
+{
+    wakeup_limiter_refill(limiter, now_s);
+    if (limiter->tokens == WAKEUP_RATE_BURST)
+    {
+        /* The source has been quiet long enough */
+        limiter->stats.backoff_s = WAKEUP_BACKOFF_MIN_S;
+    }
+
+    if (limiter->tokens > 0U)
+    {
+        limiter->tokens--;
+        return true;
+    }
+
+    limiter->stats.throttled_events++;
+    telemetry.throttled_events++;
+    telemetry_dirty = true;
+
+    /* The queue has a slot for every limiter, but a source must never stay
+     * masked without a timer to unmask it */
+    limiter->timer_id = power_manager_timer_start(now_s + limiter->stats.backoff_s,
+                                                  wakeup_limiter_unmask,
+                                                  (uint32_t)(limiter - wakeup_limiters));
+    if (limiter->timer_id != 0U)
+    {
+        Cy_GPIO_SetInterruptMask(limiter->port, limiter->pin, 0UL);
+        limiter->stats.masked = 1U;
+        limiter->stats.mask_count++;
+        if (limiter->stats.backoff_s < WAKEUP_BACKOFF_MAX_S)
+        {
+            limiter->stats.backoff_s *= 2U;
+        }
+    }
+
+    return false;
+}
+POWER_MANAGER_WAKE_FUNC_END
+
+/* Sets a wake-up source for all NS clients */
+POWER_MANAGER_WAKE_FUNC_BEGIN
+static void wakeup_src_set(uint32_t src)
+{
+    uint32_t client;
+
+    for (client = 0U; client < POWER_MANAGER_CLIENTS; client++)
+    {
+        wakeup_src_flags[client] |= src;
+    }
+}
+POWER_MANAGER_WAKE_FUNC_END
+
+/* Returns the NS client of a caller, see POWER_MANAGER_CLIENTS */
+static uint32_t power_manager_client(int32_t client_id)
+{
+#if (POWER_MANAGER_CM55_CLIENT != 0)
+    if ((client_id >= POWER_MANAGER_CM55_CLIENT_ID_MIN) &&
+        (client_id <= POWER_MANAGER_CM55_CLIENT_ID_MAX))
+    {
+        return POWER_MANAGER_CLIENT_CM55;
+    }
+#else
+    (void)client_id;
+#endif
+
+    return POWER_MANAGER_CLIENT_CM33;
+}
+
+/* Expiry of a timed wake-up of the NS application */
+POWER_MANAGER_WAKE_FUNC_BEGIN
+static void wake_timer_expired(uint32_t arg)
+{
+    (void)arg;
+
+    wake_timers_pending--;
+    wakeup_src_set(WAKEUP_SOURCE_TIMER);
+    telemetry_count_wake(WAKEUP_SOURCE_TIMER);
+}
+POWER_MANAGER_WAKE_FUNC_END
+
+/* Masks the partition interrupts while the SFN accesses the timer queue */
+static psa_irq_status_t power_manager_lock(void)
+{
+    psa_irq_status_t state = 0U;
+
+    if (psa_irq_disable(USER_BTN1_INTERRUPT_SIGNAL) != 0U)
+    {
+        state |= USER_BTN1_INTERRUPT_SIGNAL;
+    }
+    if (psa_irq_disable(RTC_ALARM_INTERRUPT_SIGNAL) != 0U)
+    {
+        state |= RTC_ALARM_INTERRUPT_SIGNAL;
+    }
+
+    return state;
+}
+
+static void power_manager_unlock(psa_irq_status_t state)
+{
+    if ((state & USER_BTN1_INTERRUPT_SIGNAL) != 0U)
+    {
+        psa_irq_enable(USER_BTN1_INTERRUPT_SIGNAL);
+    }
+    if ((state & RTC_ALARM_INTERRUPT_SIGNAL) != 0U)
+    {
+        psa_irq_enable(RTC_ALARM_INTERRUPT_SIGNAL);
+    }
+}
+
+/* Writes the telemetry to ITS. A failed write is retried with the next
+ * write. */
+static psa_status_t telemetry_write(uint32_t now_s)
+{
+    telemetry_record_t record;
+    psa_irq_status_t state;
+    psa_status_t status;
+
+    state = power_manager_lock();
+    record.version = TELEMETRY_VERSION;
+    record.last_reset_cause = telemetry_reset_cause_now;
+    record.totals = telemetry;
+    record.totals.its_writes++;
+    telemetry_dirty = false;
+    power_manager_unlock(state);
+
+    telemetry_written_s = now_s;
+    status = psa_its_set(TELEMETRY_UID, sizeof(record), &record, PSA_STORAGE_FLAG_NONE);
+    if (status == PSA_SUCCESS)
+    {
+        telemetry.its_writes++;
+    }
+    else
+    {
+        telemetry_dirty = true;
+    }
+
+    return status;
+}
+
+/* Writes changed telemetry once the write period has elapsed. Called at the
+ * end of every secure call, as the FLIHs cannot access ITS. */
+static void telemetry_poll(void)
+{
+    uint32_t now_s = power_manager_timer_now_s();
+
+    /* The RTC may be set backwards by the NS application. Set forwards, it
+     * only brings the next write forward. */
+    if ((int32_t)(now_s - telemetry_written_s) < 0)
+    {
+        telemetry_written_s = now_s;
+    }
+
+    if (telemetry_dirty && ((now_s - telemetry_written_s) >= TELEMETRY_WRITE_PERIOD_S))
+    {
+        (void)telemetry_write(now_s);
+    }
+}
+
+/* Writes changed telemetry at once, at most once per TELEMETRY_FLUSH_MIN_S.
+ * The first flush of a boot issued before a power loss is always accepted,
+ * as the telemetry in RAM is lost with the power. */
+static psa_status_t telemetry_flush(uint32_t flags)
+{
+    uint32_t now_s = power_manager_timer_now_s();
+    bool power_loss = ((flags & POWER_MANAGER_FLUSH_POWER_LOSS) != 0U) &&
+                      !telemetry_power_loss_flushed;
+
+    if ((flags & ~POWER_MANAGER_FLUSH_POWER_LOSS) != 0U)
+    {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+    if ((int32_t)(now_s - telemetry_flushed_s) < 0)
+    {
+        telemetry_flushed_s = now_s - TELEMETRY_FLUSH_MIN_S;
+    }
+    if (!power_loss && ((now_s - telemetry_flushed_s) < TELEMETRY_FLUSH_MIN_S))
+    {
+        return PSA_ERROR_BAD_STATE;
+    }
+
+    if (power_loss)
+    {
+        telemetry_power_loss_flushed = true;
+    }
+    telemetry_flushed_s = now_s;
+    return telemetry_dirty ? telemetry_write(now_s) : PSA_SUCCESS;
+}
+
+/* Loads the lifetime totals and counts this start and its reset cause. A
+ * missing or outdated record starts the totals from zero. The start is
+ * written at once if its reset cause differs from that of the last boot, so
+ * that the first reset of a reset loop is recorded, or if the record had to
+ * be created. A Hibernate wake-up, and a repeated reset cause, are only
+ * counted and written with the next write. ITS is initialized before this
+ * partition, as it is a dependency. */
+static void telemetry_init(void)
+{
+    telemetry_record_t record;
+    size_t len = 0U;
+    bool write = true;
+
+    telemetry_reset_cause_now = telemetry_reset_cause(Cy_SysLib_GetResetReason());
+    Cy_SysLib_ClearResetReason();
+
+    memset(&telemetry, 0, sizeof(telemetry));
+    if ((psa_its_get(TELEMETRY_UID, 0U, sizeof(record), &record, &len) == PSA_SUCCESS) &&
+        (len == sizeof(record)) && (record.version == TELEMETRY_VERSION))
+    {
+        telemetry = record.totals;
+        write = (telemetry_reset_cause_now != POWER_MANAGER_RESET_HIBERNATE) &&
+                (telemetry_reset_cause_now != record.last_reset_cause);
+    }
+
+    telemetry.boots++;
+    telemetry.reset_causes[telemetry_reset_cause_now]++;
+    telemetry_dirty = true;
+    telemetry_written_s = power_manager_timer_now_s();
+    telemetry_flushed_s = telemetry_written_s - TELEMETRY_FLUSH_MIN_S;
+    if (write)
+    {
+        (void)telemetry_write(telemetry_written_s);
+    }
+}
+
+/* Starts a timed wake-up at the given RTC time */
+static psa_status_t wake_timer_start(uint32_t at_s, uint32_t *id)
+{
+    psa_irq_status_t state;
+
+    *id = 0U;
+
+    state = power_manager_lock();
+    if (wake_timers_pending < POWER_MANAGER_WAKE_TIMERS_MAX)
+    {
+        *id = power_manager_timer_start(at_s, wake_timer_expired, 0U);
+        if (*id != 0U)
+        {
+            wake_timers_pending++;
+        }
+    }
+    power_manager_unlock(state);
+
+    return (*id != 0U) ? PSA_SUCCESS : PSA_ERROR_INSUFFICIENT_MEMORY;
+}
+
+/* Returns the input and output sizes of an operation, false if the operation
+ * cannot be part of a batch */
+static bool power_manager_op_size(uint32_t op, size_t *in_len, size_t *out_len)
+{
+    *in_len = 0U;
+    *out_len = 0U;
+
+    switch (op)
+    {
+        case POWER_MANAGER_GET_WAKEUP_SOURCE:
+            *out_len = sizeof(uint32_t);
+            break;
+        case POWER_MANAGER_CLR_WAKEUP_SOURCE:
+            break;
+        case POWER_MANAGER_GET_WAKEUP_INFO:
+        case POWER_MANAGER_TAKE_WAKEUP_INFO:
+            *out_len = sizeof(power_manager_wakeup_info_t);
+            break;
+        case POWER_MANAGER_GET_RATE_LIMIT:
+            *in_len = sizeof(uint32_t);
+            *out_len = sizeof(power_manager_rate_limit_t);
+            break;
+        case POWER_MANAGER_WAKE_AT:
+        case POWER_MANAGER_WAKE_AFTER:
+            *in_len = sizeof(uint32_t);
+            *out_len = sizeof(uint32_t);
+            break;
+        case POWER_MANAGER_GET_LOG_TX:
+            *out_len = sizeof(power_manager_log_tx_t);
+            break;
+        case POWER_MANAGER_WAKE_CANCEL:
+        case POWER_MANAGER_RECORD_DEEPSLEEP:
+        case POWER_MANAGER_RECORD_LATENCY:
+        case POWER_MANAGER_FLUSH_TELEMETRY:
+            *in_len = sizeof(uint32_t);
+            break;
+        default:
+            return false;
+    }
+
+    return true;
+}
+
+/* Executes one operation for an NS client. The argument is used by
+ * operations with an input, the result data is valid if PSA_SUCCESS is
+ * returned. */
+static psa_status_t power_manager_exec(uint32_t client, uint32_t op,
+                                       uint32_t arg,
+                                       power_manager_result_t *result)
+{
+    psa_status_t status = PSA_SUCCESS;
+
+    switch (op)
+    {
+        case POWER_MANAGER_GET_WAKEUP_SOURCE:
+        {
+            result->data.value = wakeup_src_flags[client];
+        }
+        break;
+
+        case POWER_MANAGER_CLR_WAKEUP_SOURCE:
+        {
+            /* CLear the wake-up source variable */
+            wakeup_src_flags[client] = 0U;
+        }
+        break;
+
+        case POWER_MANAGER_GET_WAKEUP_INFO:
+        {
+            result->data.wakeup_info.sources = wakeup_src_flags[client];
+            result->data.wakeup_info.event_seq = wakeup_event_seq;
+        }
+        break;
+
+        case POWER_MANAGER_TAKE_WAKEUP_INFO:
+        {
+            /* No event may be set between the read and the clear */
+            psa_irq_status_t state = power_manager_lock();
+
+            result->data.wakeup_info.sources = wakeup_src_flags[client];
+            result->data.wakeup_info.event_seq = wakeup_event_seq;
+            wakeup_src_flags[client] = 0U;
+            power_manager_unlock(state);
+        }
+        break;
+
+        case POWER_MANAGER_GET_RATE_LIMIT:
+        {
+            wakeup_limiter_t *limiter = wakeup_limiter_find(arg);
+
+            if (limiter != NULL)
+            {
+                result->data.rate_limit = limiter->stats;
+            }
+            else
+            {
+                status = PSA_ERROR_INVALID_ARGUMENT;
+            }
+        }
+        break;
+
+        case POWER_MANAGER_WAKE_AT:
+        {
+            status = wake_timer_start(arg, &result->data.value);
+        }
+        break;
+
+        case POWER_MANAGER_WAKE_AFTER:
+        {
+            status = wake_timer_start(arg + power_manager_timer_now_s(),
+                                      &result->data.value);
+        }
+        break;
+
+        case POWER_MANAGER_WAKE_CANCEL:
+        {
+            psa_irq_status_t state = power_manager_lock();
+
+            if (power_manager_timer_stop(arg, wake_timer_expired))
+            {
+                wake_timers_pending--;
+            }
+            else
+            {
+                status = PSA_ERROR_DOES_NOT_EXIST;
+            }
+            power_manager_unlock(state);
+        }
+        break;
+
+        case POWER_MANAGER_RECORD_DEEPSLEEP:
+        {
+            /* DeepSleep residency in milliseconds since the last record */
+            telemetry_deepsleep_ms += arg % 1000U;
+            telemetry.deepsleep_s += (arg / 1000U) + (telemetry_deepsleep_ms / 1000U);
+            telemetry_deepsleep_ms %= 1000U;
+            telemetry_dirty = true;
+        }
+        break;
+
+        case POWER_MANAGER_RECORD_LATENCY:
+        {
+            if (arg > telemetry.worst_latency_us)
+            {
+                telemetry.worst_latency_us = arg;
+                telemetry_dirty = true;
+            }
+        }
+        break;
+
+        case POWER_MANAGER_FLUSH_TELEMETRY:
+        {
+            status = telemetry_flush(arg);
+        }
+        break;
+
+        case POWER_MANAGER_GET_LOG_TX:
+        {
+            /* Status registers of the UART of the platform log service */
+            result->data.log_tx.fifo_size = Cy_SCB_GetFifoSize(IFX_TFM_SPM_UART_HW);
+            result->data.log_tx.fifo_used = Cy_SCB_UART_GetNumInTxFifo(IFX_TFM_SPM_UART_HW);
+            result->data.log_tx.tx_done = Cy_SCB_UART_IsTxComplete(IFX_TFM_SPM_UART_HW) ? 1U : 0U;
+        }
+        break;
+
+        default:
+        {
+            status = PSA_ERROR_NOT_SUPPORTED;
+        }
+        break;
+    }
+
+    return status;
+}
+
+/* Returns the lifetime totals, including changes not yet written */
+static psa_status_t power_manager_get_telemetry(const psa_msg_t *msg)
+{
+    power_manager_telemetry_t totals;
+    psa_irq_status_t state;
+
+    if ((msg->in_size[0] != 0U) || (msg->out_size[0] != sizeof(totals)))
+    {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+
+    state = power_manager_lock();
+    totals = telemetry;
+    power_manager_unlock(state);
+
+    psa_write(msg->handle, 0, &totals, sizeof(totals));
+
+    return PSA_SUCCESS;
+}
+
+/* Executes the commands of a batch in order. A failed command does not stop
+ * the batch; its status is returned in its result. */
+static psa_status_t power_manager_batch(const psa_msg_t *msg)
+{
+    power_manager_cmd_t cmds[POWER_MANAGER_BATCH_MAX];
+    power_manager_result_t results[POWER_MANAGER_BATCH_MAX];
+    uint32_t client = power_manager_client(msg->client_id);
+    size_t count = msg->in_size[0] / sizeof(power_manager_cmd_t);
+    size_t in_len;
+    size_t out_len;
+    size_t i;
+
+    if ((count == 0U) || (count > POWER_MANAGER_BATCH_MAX) ||
+        (msg->in_size[0] != (count * sizeof(power_manager_cmd_t))) ||
+        (msg->out_size[0] < (count * sizeof(power_manager_result_t))) ||
+        (psa_read(msg->handle, 0, cmds, msg->in_size[0]) != msg->in_size[0]))
+    {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+
+    memset(results, 0, count * sizeof(power_manager_result_t));
+    for (i = 0U; i < count; i++)
+    {
+        if (power_manager_op_size(cmds[i].op, &in_len, &out_len))
+        {
+            results[i].status = power_manager_exec(client, cmds[i].op,
+                                                   cmds[i].arg, &results[i]);
+        }
+        else
+        {
+            results[i].status = PSA_ERROR_NOT_SUPPORTED;
+        }
+    }
+
+    psa_write(msg->handle, 0, results, count * sizeof(power_manager_result_t));
+
+    return PSA_SUCCESS;
+}
+
+/* Interrupt of the USER BTN1 port. Reads the pending pins and the RTC once,
+ * dispatches the pins in one pass and clears them with one write. Pins masked by a rate
+ * limiter are not pending; pending pins that are no wake-up pin are only
+ * cleared, like the glitch filter bit above the pins. */
+POWER_MANAGER_WAKE_FUNC_BEGIN
 psa_flih_result_t user_btn1_interrupt_flih(void)
 {
-    /* Update wakeup src bitfield */
-    wakeup_src_flag |= WAKEUP_SOURCE_USER_BTN1;
+    uint32_t pending = GPIO_PRT_INTR_MASKED(CYBSP_USER_BTN1_PORT);
+    uint32_t pins = pending & ((1UL << CY_GPIO_PINS_MAX) - 1U);
+    uint32_t pin = 0U;
+    uint32_t now_s = power_manager_timer_now_s();
+    wakeup_limiter_t *limiter;
+
+    while (pins != 0U)
+    {
+        if ((pins & 1U) != 0U)
+        {
+            limiter = wakeup_pins[pin];
+            if ((limiter != NULL) && wakeup_limiter_take(limiter, now_s))
+            {
+                /* Update wakeup src bitfield */
+                wakeup_src_set(limiter->src);
+                wakeup_event_seq++;
+                telemetry_count_wake(limiter->src);
+            }
+        }
+        pins >>= 1U;
+        pin++;
+    }
+
+    GPIO_PRT_INTR(CYBSP_USER_BTN1_PORT) = pending;
+    /* Read back so that the line is low when the SPM handler returns */
+    (void)GPIO_PRT_INTR(CYBSP_USER_BTN1_PORT);
+
+    return PSA_FLIH_NO_SIGNAL;
+}
+POWER_MANAGER_WAKE_FUNC_END
+
+POWER_MANAGER_WAKE_FUNC_BEGIN
+psa_flih_result_t rtc_alarm_interrupt_flih(void)
+{
+    /* Ends backoffs and timed wake-ups that are due */
+    power_manager_timer_process();
 
     return PSA_FLIH_NO_SIGNAL;
 }
+POWER_MANAGER_WAKE_FUNC_END
 
 psa_status_t power_manager_init(void)
 {
+    uint32_t i;
+
     printf("POWER MANAGER Partition init\r\n");
 
-    /* Enable USE_BTN1 Interrupt */
+    for (i = 0U; i < WAKEUP_LIMITER_COUNT; i++)
+    {
+        wakeup_pins[wakeup_limiters[i].pin] = &wakeup_limiters[i];
+    }
+
+    /* Enable the USER BTN1 port interrupt */
     psa_irq_enable(USER_BTN1_INTERRUPT_SIGNAL);
 
+    /* Enable the RTC alarm of the timer queue */
+    power_manager_timer_init();
+    psa_irq_enable(RTC_ALARM_INTERRUPT_SIGNAL);
+
+    telemetry_init();
+
     return PSA_SUCCESS;
 }
 
 psa_status_t power_manager_service_sfn(const psa_msg_t *msg)
 {
     psa_status_t status = PSA_ERROR_GENERIC_ERROR;
+    power_manager_result_t result;
+    uint32_t arg = 0U;
+    size_t in_len;
+    size_t out_len;
 
     /* Handle messages sent to the POWER_MANAGER */
     switch (msg->type)
     {
-        case POWER_MANAGER_GET_WAKEUP_SOURCE:
+        case POWER_MANAGER_BATCH:
         {
-            if (msg->out_size[0] == sizeof(uint32_t))
-            {
-                /* Populate the outupt with wake-up source */
-                psa_write(msg->handle, 0, &wakeup_src_flag, sizeof(wakeup_src_flag));
-
-                status = PSA_SUCCESS;
-            }
-            else
-            {
-                status = PSA_ERROR_INVALID_ARGUMENT;
-            }
+            status = power_manager_batch(msg);
         }
         break;
 
-        case POWER_MANAGER_CLR_WAKEUP_SOURCE:
+        case POWER_MANAGER_GET_TELEMETRY:
         {
-            /* CLear the wake-up source variable */
-            wakeup_src_flag = 0U;
-
-            status = PSA_SUCCESS;
+            status = power_manager_get_telemetry(msg);
         }
         break;
 
         default:
         {
-            status = PSA_ERROR_NOT_SUPPORTED;
+            if (!power_manager_op_size((uint32_t)msg->type, &in_len, &out_len))
+            {
+                status = PSA_ERROR_NOT_SUPPORTED;
+            }
+            else if ((msg->in_size[0] != in_len) || (msg->out_size[0] != out_len) ||
+                     (psa_read(msg->handle, 0, &arg, in_len) != in_len))
+            {
+                status = PSA_ERROR_INVALID_ARGUMENT;
+            }
+            else
+            {
+                status = power_manager_exec(power_manager_client(msg->client_id),
+                                            (uint32_t)msg->type, arg, &result);
+                if ((status == PSA_SUCCESS) && (out_len != 0U))
+                {
+                    /* Populate the output with the result data */
+                    psa_write(msg->handle, 0, &result.data, out_len);
+                }
+            }
         }
         break;
     }
 
+    telemetry_poll();
+
     return status;
-}
\ No newline at end of file
+}
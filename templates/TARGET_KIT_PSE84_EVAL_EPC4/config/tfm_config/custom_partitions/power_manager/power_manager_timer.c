@@ -0,0 +1,292 @@
+/*
+ * Copyright (c) 2025 Cypress Semiconductor Corporation (an Infineon company)
+ * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+#include "cy_pdl.h"
+#include "cybsp.h"
+#include "power_manager_defs.h"
+#include "power_manager_timer.h"
+
+
+#define SECONDS_PER_MINUTE  (60UL)
+#define SECONDS_PER_HOUR    (3600UL)
+#define SECONDS_PER_DAY     (86400UL)
+
+/* 2000-01-01 was a Saturday */
+#define EPOCH_DAY_OF_WEEK   (CY_RTC_SATURDAY)
+
+
+/* Entry of the timer queue */
+typedef struct
+{
+    uint32_t at_s;
+    uint32_t id;
+    power_manager_timer_cb_t cb;
+    uint32_t arg;
+} timer_entry_t;
+
+
+/* Pending timers, sorted by expiry time */
+static timer_entry_t timer_queue[POWER_MANAGER_TIMER_COUNT];
+static uint32_t timer_count = 0U;
+static uint32_t timer_next_id = 1U;
+
+/* Days before the first of each month in a non-leap year. Read by the
+ * FLIHs, so it is in .data with POWER_MANAGER_RAM_WAKE_PATH. */
+#if (POWER_MANAGER_RAM_WAKE_PATH != 0)
+static uint16_t days_before_month[12] =
+#else
+static const uint16_t days_before_month[12] =
+#endif
+{
+    0U, 31U, 59U, 90U, 120U, 151U, 181U, 212U, 243U, 273U, 304U, 334U
+};
+
+
+POWER_MANAGER_WAKE_FUNC_BEGIN
+static uint32_t days_in_year(uint32_t year)
+{
+    /* Years 2000 to 2099, the range of the RTC */
+    return ((year % 4U) == 0U) ? 366U : 365U;
+}
+POWER_MANAGER_WAKE_FUNC_END
+
+POWER_MANAGER_WAKE_FUNC_BEGIN
+static uint32_t date_to_days(uint32_t year, uint32_t month, uint32_t date)
+{
+    uint32_t days = (year * 365U) + ((year + 3U) / 4U);
+
+    days += days_before_month[month - 1U] + (date - 1U);
+    if ((month > 2U) && ((year % 4U) == 0U))
+    {
+        days++;
+    }
+
+    return days;
+}
+POWER_MANAGER_WAKE_FUNC_END
+
+POWER_MANAGER_WAKE_FUNC_BEGIN
+static void days_to_date(uint32_t days, uint32_t *year, uint32_t *month,
+                         uint32_t *date)
+{
+    uint32_t y = 0U;
+    uint32_t m = 1U;
+    uint32_t leap;
+
+    while (days >= days_in_year(y))
+    {
+        days -= days_in_year(y);
+        y++;
+    }
+
+    leap = ((y % 4U) == 0U) ? 1U : 0U;
+    while ((m < 12U) &&
+           (days >= (days_before_month[m] + ((m >= 2U) ? leap : 0U))))
+    {
+        m++;
+    }
+    days -= days_before_month[m - 1U] + ((m > 2U) ? leap : 0U);
+
+    *year = y;
+    *month = m;
+    *date = days + 1U;
+}
+POWER_MANAGER_WAKE_FUNC_END
+
+void power_manager_timer_init(void)
+{
+    /* The partition owns the RTC, so that the time its timers and rate
+     * limiters run on is not set by the NSPE. The RTC keeps counting in
+     * Hibernate; it is set from the configuration after any other reset. */
+    if ((Cy_SysLib_GetResetReason() & CY_SYSLIB_RESET_HIB_WAKEUP) == 0U)
+    {
+        (void)Cy_RTC_Init(&CYBSP_RTC_config);
+    }
+
+    Cy_RTC_ClearInterrupt(POWER_MANAGER_TIMER_ALARM_INTR);
+    Cy_RTC_SetInterruptMask(Cy_RTC_GetInterruptMask() |
+                            POWER_MANAGER_TIMER_ALARM_INTR);
+}
+
+POWER_MANAGER_WAKE_FUNC_BEGIN
+uint32_t power_manager_timer_now_s(void)
+{
+    cy_stc_rtc_config_t now;
+    uint32_t hour;
+
+    Cy_RTC_GetDateAndTime(&now);
+
+    hour = now.hour;
+    if (now.hrFormat == CY_RTC_12_HOURS)
+    {
+        hour = (hour % 12U) + ((now.amPm == CY_RTC_PM) ? 12U : 0U);
+    }
+
+    return (date_to_days(now.year, now.month, now.date) * SECONDS_PER_DAY) +
+           (hour * SECONDS_PER_HOUR) + (now.min * SECONDS_PER_MINUTE) +
+           now.sec;
+}
+POWER_MANAGER_WAKE_FUNC_END
+
+POWER_MANAGER_WAKE_FUNC_BEGIN
+void power_manager_timer_set_alarm(uint32_t at_s)
+{
+    cy_stc_rtc_alarm_t alarm;
+    uint32_t now_s = power_manager_timer_now_s();
+    uint32_t year;
+    uint32_t month;
+    uint32_t date;
+    uint32_t time_s;
+
+    /* The alarm matches on the calendar, it must lie in the future */
+    if ((int32_t)(at_s - now_s) <= 0)
+    {
+        at_s = now_s + 1U;
+    }
+
+    days_to_date(at_s / SECONDS_PER_DAY, &year, &month, &date);
+    time_s = at_s % SECONDS_PER_DAY;
+
+    alarm.sec = time_s % SECONDS_PER_MINUTE;
+    alarm.secEn = CY_RTC_ALARM_ENABLE;
+    alarm.min = (time_s / SECONDS_PER_MINUTE) % 60U;
+    alarm.minEn = CY_RTC_ALARM_ENABLE;
+    alarm.hour = time_s / SECONDS_PER_HOUR;
+    alarm.hourEn = CY_RTC_ALARM_ENABLE;
+    alarm.dayOfWeek = (((at_s / SECONDS_PER_DAY) + EPOCH_DAY_OF_WEEK - 1U) % 7U) + 1U;
+    alarm.dayOfWeekEn = CY_RTC_ALARM_DISABLE;
+    alarm.date = date;
+    alarm.dateEn = CY_RTC_ALARM_ENABLE;
+    alarm.month = month;
+    alarm.monthEn = CY_RTC_ALARM_ENABLE;
+    alarm.almEn = CY_RTC_ALARM_ENABLE;
+
+    (void)Cy_RTC_SetAlarmDateAndTime(&alarm, POWER_MANAGER_TIMER_ALARM);
+}
+POWER_MANAGER_WAKE_FUNC_END
+
+POWER_MANAGER_WAKE_FUNC_BEGIN
+void power_manager_timer_cancel_alarm(void)
+{
+    cy_stc_rtc_alarm_t alarm = {0};
+
+    alarm.almEn = CY_RTC_ALARM_DISABLE;
+    (void)Cy_RTC_SetAlarmDateAndTime(&alarm, POWER_MANAGER_TIMER_ALARM);
+    Cy_RTC_ClearInterrupt(POWER_MANAGER_TIMER_ALARM_INTR);
+}
+POWER_MANAGER_WAKE_FUNC_END
+
+POWER_MANAGER_WAKE_FUNC_BEGIN
+static void timer_arm(void)
+{
+    if (timer_count > 0U)
+    {
+        power_manager_timer_set_alarm(timer_queue[0].at_s);
+    }
+    else
+    {
+        power_manager_timer_cancel_alarm();
+    }
+}
+POWER_MANAGER_WAKE_FUNC_END
+
+POWER_MANAGER_WAKE_FUNC_BEGIN
+uint32_t power_manager_timer_start(uint32_t at_s, power_manager_timer_cb_t cb,
+                                   uint32_t arg)
+{
+    uint32_t pos;
+
+    if ((timer_count == POWER_MANAGER_TIMER_COUNT) || (cb == NULL))
+    {
+        return 0U;
+    }
+
+    /* Timers with the same expiry time keep their start order */
+    pos = timer_count;
+    while ((pos > 0U) && ((int32_t)(timer_queue[pos - 1U].at_s - at_s) > 0))
+    {
+        timer_queue[pos] = timer_queue[pos - 1U];
+        pos--;
+    }
+
+    timer_queue[pos].at_s = at_s;
+    timer_queue[pos].id = timer_next_id;
+    timer_queue[pos].cb = cb;
+    timer_queue[pos].arg = arg;
+    timer_count++;
+
+    timer_next_id++;
+    if (timer_next_id == 0U)
+    {
+        timer_next_id = 1U;
+    }
+
+    if (pos == 0U)
+    {
+        timer_arm();
+    }
+
+    return timer_queue[pos].id;
+}
+POWER_MANAGER_WAKE_FUNC_END
+
+bool power_manager_timer_stop(uint32_t id, power_manager_timer_cb_t cb)
+{
+    uint32_t pos;
+
+    for (pos = 0U; pos < timer_count; pos++)
+    {
+        if ((timer_queue[pos].id == id) && (timer_queue[pos].cb == cb))
+        {
+            break;
+        }
+    }
+
+    if ((id == 0U) || (pos == timer_count))
+    {
+        return false;
+    }
+
+    timer_count--;
+    for (; pos < timer_count; pos++)
+    {
+        timer_queue[pos] = timer_queue[pos + 1U];
+    }
+
+    /* Re-arming for a later head is not needed, an early alarm finds nothing
+     * to expire and re-arms itself */
+    if (timer_count == 0U)
+    {
+        timer_arm();
+    }
+
+    return true;
+}
+
+POWER_MANAGER_WAKE_FUNC_BEGIN
+void power_manager_timer_process(void)
+{
+    uint32_t now_s = power_manager_timer_now_s();
+    timer_entry_t expired;
+    uint32_t pos;
+
+    while ((timer_count > 0U) && ((int32_t)(timer_queue[0].at_s - now_s) <= 0))
+    {
+        expired = timer_queue[0];
+        timer_count--;
+        for (pos = 0U; pos < timer_count; pos++)
+        {
+            timer_queue[pos] = timer_queue[pos + 1U];
+        }
+
+        /* The callback may start a new timer */
+        expired.cb(expired.arg);
+    }
+
+    timer_arm();
+}
+POWER_MANAGER_WAKE_FUNC_END
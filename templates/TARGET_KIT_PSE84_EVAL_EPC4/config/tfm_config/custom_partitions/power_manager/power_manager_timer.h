@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2025 Cypress Semiconductor Corporation (an Infineon company)
+ * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+#if !defined(POWER_MANAGER_TIMER_H)
+#define POWER_MANAGER_TIMER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Secure time base and timer queue of the POWER_MANAGER partition.
+ *
+ * The RTC keeps counting in DeepSleep and its alarm interrupt is a secure
+ * interrupt owned by the partition, so it can wake the device like USER BTN1.
+ * The partition owns the RTC: power_manager_timer_init() sets it from the
+ * BSP configuration at a cold start, and the NS application does not write
+ * it. The partition uses ALARM2. Time is in seconds since 2000-01-01 00:00:00
+ * of the RTC calendar.
+ *
+ * All timers of the partition are kept in one queue sorted by expiry time.
+ * ALARM2 is always armed for the earliest timer. The queue is not locked:
+ * callers outside the RTC alarm FLIH must mask the partition interrupts. */
+
+/* Alarm used by the partition */
+#define POWER_MANAGER_TIMER_ALARM       CY_RTC_ALARM_2
+#define POWER_MANAGER_TIMER_ALARM_INTR  CY_RTC_INTR_ALARM2
+
+/* Number of timers in the queue */
+#if !defined(POWER_MANAGER_TIMER_COUNT)
+#define POWER_MANAGER_TIMER_COUNT       (8U)
+#endif
+
+/* Timer expiry callback, called from the RTC alarm FLIH */
+typedef void (*power_manager_timer_cb_t)(uint32_t arg);
+
+/**
+ * @brief Sets the RTC from the BSP configuration, unless the reset was a
+ *        Hibernate wake-up, and enables the alarm interrupt of the
+ *        partition. Called before the reset reason is cleared.
+ */
+void power_manager_timer_init(void);
+
+/**
+ * @brief Returns the current RTC time.
+ *
+ * @return Seconds since 2000-01-01 00:00:00.
+ */
+uint32_t power_manager_timer_now_s(void);
+
+/**
+ * @brief Arms the alarm. An alarm that is already armed is replaced.
+ *
+ * @param[in] at_s  Alarm time in seconds since 2000-01-01 00:00:00. A time
+ *                  that is not in the future is moved to the next second.
+ */
+void power_manager_timer_set_alarm(uint32_t at_s);
+
+/**
+ * @brief Disarms the alarm.
+ */
+void power_manager_timer_cancel_alarm(void);
+
+/**
+ * @brief Adds a timer to the queue and re-arms the alarm if it is the
+ *        earliest one.
+ *
+ * @param[in] at_s  Expiry time in seconds since 2000-01-01 00:00:00.
+ * @param[in] cb    Callback called when the timer expires.
+ * @param[in] arg   Argument of the callback.
+ *
+ * @return Timer ID, 0 if the queue is full.
+ */
+uint32_t power_manager_timer_start(uint32_t at_s, power_manager_timer_cb_t cb,
+                                   uint32_t arg);
+
+/**
+ * @brief Removes a timer from the queue.
+ *
+ * @param[in] id  Timer ID returned by power_manager_timer_start().
+ * @param[in] cb  Callback the timer was started with. A timer with another
+ *                callback is not removed.
+ *
+ * @return true if the timer was pending and is removed.
+ */
+bool power_manager_timer_stop(uint32_t id, power_manager_timer_cb_t cb);
+
+/**
+ * @brief Calls the callbacks of all expired timers, removes them from the
+ *        queue and re-arms the alarm for the next one. Called from the RTC
+ *        alarm FLIH.
+ */
+void power_manager_timer_process(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* POWER_MANAGER_TIMER_H */